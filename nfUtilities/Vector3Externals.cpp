@@ -1,29 +1,29 @@
 #include "nfVector3.h"
-#include "nfMath.h"
+#include "nfStringConversion.h"
 
 namespace nfEngineSDK
 {
   String
   Vector3f::toString() const
   {
-    return "{ " + nfToString(x) + ", "
-                + nfToString(y) + ", ";
-                + nfToString(z) + " }";
+    char buffer[StringConversion::maxChars<Vector3f>()];
+    char* end = StringConversion::toChars(buffer, buffer + sizeof(buffer), *this);
+    return String(buffer, end);
   }
 
   String
   Vector3i::toString() const
   {
-    return "{ " + nfToString(x) + ", "
-                + nfToString(y) + ", ";
-                + nfToString(z) + " }";
+    char buffer[StringConversion::maxChars<Vector3i>()];
+    char* end = StringConversion::toChars(buffer, buffer + sizeof(buffer), *this);
+    return String(buffer, end);
   }
 
   String
   Vector3u::toString() const
   {
-    return "{ " + nfToString(x) + ", "
-                + nfToString(y) + ", ";
-                + nfToString(z) + " }";
+    char buffer[StringConversion::maxChars<Vector3u>()];
+    char* end = StringConversion::toChars(buffer, buffer + sizeof(buffer), *this);
+    return String(buffer, end);
   }
 }
\ No newline at end of file
@@ -0,0 +1,426 @@
+/************************************************************************/
+/**
+ * @file nfArchive.h
+ * @author Mara Castellanos
+ * @date 18/10/26
+ * @brief Packed asset archives of compressed chunks, read with random access
+ *        from a memory mapped File.
+ *
+ * @bug Not bug Known.
+ */
+/************************************************************************/
+
+#pragma once
+
+#include "nfPrerequisitesUtilities.h"
+#include "nfFile.h"
+#include "nfSerializer.h"
+
+namespace nfEngineSDK {
+  /**
+   * @brief
+   * How the chunks of an archive are compressed.
+   */
+  namespace ARCHIVE_COMPRESSION {
+    enum E
+    {
+      /*
+       * The bytes as they are.
+       */
+      kNONE = 0,
+      /*
+       * LZ4 block format.
+       */
+      kLZ4 = 1
+    };
+  }
+
+  /**
+   * @brief
+   * An asset inside an archive.
+   */
+  struct ArchiveEntry
+  {
+    /**
+     * @brief
+     * Writes the entry to the table of contents.
+     */
+    void
+    serialize(Serializer& _serializer) const
+    {
+      _serializer.write(name);
+      _serializer.write(size);
+      _serializer.write(hash);
+      _serializer.write(firstChunk);
+      _serializer.write(chunkCount);
+    }
+    /**
+     * @brief
+     * Reads the entry from the table of contents.
+     */
+    void
+    deserialize(Deserializer& _deserializer)
+    {
+      _deserializer.read(name);
+      _deserializer.read(size);
+      _deserializer.read(hash);
+      _deserializer.read(firstChunk);
+      _deserializer.read(chunkCount);
+    }
+
+    /*
+     * The name the asset is found by, usually its path.
+     */
+    String name;
+    /*
+     * The uncompressed size in bytes.
+     */
+    uint64 size = 0;
+    /*
+     * The XXH64 of the uncompressed bytes.
+     */
+    uint64 hash = 0;
+    /*
+     * The index of the first chunk of the asset.
+     */
+    uint32 firstChunk = 0;
+    /*
+     * The number of chunks of the asset.
+     */
+    uint32 chunkCount = 0;
+  };
+
+  /**
+   * @brief
+   * Packs assets into an archive file.
+   *
+   * @description
+   * Every asset is cut in chunks of the same uncompressed size (the last one
+   * can be smaller) compressed on their own, so any range of an asset can be
+   * read decompressing only the chunks it touches. A chunk that doesn't get
+   * smaller is stored as it is.
+   *
+   * The file is the header, the table of contents and the chunks, so the
+   * first read of the archive gets everything needed to find the assets.
+   */
+  class NF_UTILITIES_EXPORT ArchiveWriter
+  {
+   public:
+    /**
+     * @brief
+     * Creates an empty archive.
+     *
+     * @param _chunkSize
+     * The uncompressed size of the chunks. Small chunks read small ranges
+     * faster, big ones compress better.
+     * @param _compression
+     * How the chunks are compressed.
+     */
+    explicit
+    ArchiveWriter(uint32 _chunkSize = kDEFAULT_CHUNK_SIZE,
+                  ARCHIVE_COMPRESSION::E _compression = ARCHIVE_COMPRESSION::kLZ4);
+
+    /**
+     * @brief
+     * Adds an asset, its bytes are copied.
+     *
+     * @param _name
+     * The name of the asset, it replaces an asset added with the same name.
+     * @param _data
+     * The bytes.
+     * @param _size
+     * The number of bytes.
+     */
+    void
+    add(const String& _name, const void* _data, SIZE_T _size);
+    /**
+     * @brief
+     * Adds a file on the disk as an asset.
+     *
+     * @param _name
+     * The name of the asset.
+     * @param _path
+     * The path of the file.
+     *
+     * @return
+     * False if the file couldn't be read.
+     */
+    bool
+    addFile(const String& _name, const String& _path);
+
+    /**
+     * @brief
+     * Compresses the assets and writes the archive.
+     *
+     * @param _path
+     * The path of the archive.
+     * @param _threads
+     * The number of threads to compress with, 0 for all the hardware ones.
+     *
+     * @return
+     * False if the file couldn't be written.
+     */
+    bool
+    save(const String& _path, uint32 _threads = 1) const;
+
+    /**
+     * @brief
+     * Removes all the assets added.
+     */
+    void
+    clear();
+
+    /*
+     * The chunk size when none is given.
+     */
+    static const uint32 kDEFAULT_CHUNK_SIZE = 64 * 1024;
+
+   private:
+    /*
+     * The name and the bytes of every asset, by name.
+     */
+    Map<String, Vector<uint8>> m_assets;
+    /*
+     * The uncompressed size of the chunks.
+     */
+    uint32 m_chunkSize;
+    /*
+     * How the chunks are compressed.
+     */
+    ARCHIVE_COMPRESSION::E m_compression;
+  };
+
+  /**
+   * @brief
+   * Reads the assets of an archive made by ArchiveWriter.
+   *
+   * @description
+   * The archive is a single File, mapped when the platform can, so opening
+   * thousands of assets is a lookup on the table of contents instead of an
+   * open and a close per file. The chunks are decompressed straight from the
+   * map into the buffer of the caller, only the ones cut by the start or the
+   * end of the range go through a temporary chunk.
+   *
+   * Reads are const and can run from many threads at the same time. A big
+   * read can also be split between threads by chunks.
+   */
+  class NF_UTILITIES_EXPORT Archive
+  {
+   public:
+    /**
+     * @brief
+     * The default constructor, no archive open.
+     */
+    Archive() = default;
+    Archive(const Archive&) = delete;
+    /**
+     * @brief
+     * Closes the archive.
+     */
+    ~Archive() = default;
+
+    Archive&
+    operator=(const Archive&) = delete;
+
+    /**
+     * @brief
+     * Opens an archive and reads its table of contents.
+     *
+     * @param _path
+     * The path of the archive.
+     *
+     * @return
+     * False if the file couldn't be opened or is not a valid archive.
+     */
+    bool
+    open(const String& _path);
+
+    /**
+     * @brief
+     * Closes the archive.
+     */
+    void
+    close();
+
+    /**
+     * @brief
+     * Returns true if an archive is open.
+     */
+    FORCEINLINE bool
+    isOpen() const
+    {
+      return m_file.isOpen();
+    }
+
+    /**
+     * @brief
+     * Finds an asset by its name.
+     *
+     * @param _name
+     * The name of the asset.
+     *
+     * @return
+     * The index of the asset, kNOT_FOUND if it is not in the archive.
+     */
+    SIZE_T
+    find(const String& _name) const;
+
+    /**
+     * @brief
+     * Returns the number of assets.
+     */
+    FORCEINLINE SIZE_T
+    getEntryCount() const
+    {
+      return m_entries.size();
+    }
+
+    /**
+     * @brief
+     * Returns an asset, the assets are sorted by name.
+     *
+     * @param _index
+     * The index of the asset.
+     */
+    FORCEINLINE const ArchiveEntry&
+    getEntry(SIZE_T _index) const
+    {
+      return m_entries[_index];
+    }
+
+    /**
+     * @brief
+     * Returns the uncompressed size of the chunks.
+     */
+    FORCEINLINE uint32
+    getChunkSize() const
+    {
+      return m_chunkSize;
+    }
+
+    /**
+     * @brief
+     * Decompresses a range of an asset into a buffer.
+     *
+     * @param _index
+     * The index of the asset.
+     * @param _offset
+     * The first byte of the asset to read.
+     * @param _out
+     * Where the bytes are written.
+     * @param _size
+     * The number of bytes to read.
+     * @param _threads
+     * The number of threads to decompress with, 0 for all the hardware ones.
+     *
+     * @return
+     * The number of bytes read, less than _size only past the end of the
+     * asset. 0 if a chunk is corrupt.
+     */
+    SIZE_T
+    read(SIZE_T _index,
+         SIZE_T _offset,
+         void* _out,
+         SIZE_T _size,
+         uint32 _threads = 1) const;
+    /**
+     * @brief
+     * Decompresses a whole asset.
+     *
+     * @param _index
+     * The index of the asset.
+     * @param _out
+     * Where the bytes are written.
+     * @param _threads
+     * The number of threads to decompress with, 0 for all the hardware ones.
+     *
+     * @return
+     * False if a chunk is corrupt.
+     */
+    bool
+    read(SIZE_T _index, Vector<uint8>& _out, uint32 _threads = 1) const;
+
+    /**
+     * @brief
+     * Decompresses a whole asset and checks it against its hash.
+     *
+     * @param _index
+     * The index of the asset.
+     *
+     * @return
+     * True if the asset is good.
+     */
+    bool
+    verify(SIZE_T _index) const;
+
+    /**
+     * @brief
+     * The XXH64 hash the assets are checked with.
+     *
+     * @param _data
+     * The bytes.
+     * @param _size
+     * The number of bytes.
+     * @param _seed
+     * The seed.
+     *
+     * @return
+     * The hash.
+     */
+    static uint64
+    hash(const void* _data, SIZE_T _size, uint64 _seed = 0);
+
+    /*
+     * The index find() returns for the names that are not in the archive.
+     */
+    static const SIZE_T kNOT_FOUND = static_cast<SIZE_T>(-1);
+
+    /*
+     * The smallest number of chunks given to a thread.
+     */
+    static const SIZE_T kMIN_CHUNKS_PER_THREAD = 4;
+
+    /*
+     * The version of the format written by ArchiveWriter.
+     */
+    static const uint32 kFORMAT_VERSION = 1;
+
+   private:
+    /*
+     * Decompresses the chunks from _begin to _end of a read.
+     */
+    bool
+    readChunks(const ArchiveEntry& _entry,
+               SIZE_T _offset,
+               uint8* _out,
+               SIZE_T _size,
+               SIZE_T _begin,
+               SIZE_T _end) const;
+
+    /*
+     * The archive.
+     */
+    File m_file;
+    /*
+     * The assets, sorted by name.
+     */
+    Vector<ArchiveEntry> m_entries;
+    /*
+     * Where every chunk starts from the first chunk, and one more for the
+     * end of the last one.
+     */
+    Vector<uint64> m_chunkOffsets;
+    /*
+     * The compression of every chunk.
+     */
+    Vector<uint8> m_chunkCompression;
+    /*
+     * The chunks.
+     */
+    FileView m_chunks;
+    /*
+     * The uncompressed size of the chunks.
+     */
+    uint32 m_chunkSize = 0;
+  };
+}
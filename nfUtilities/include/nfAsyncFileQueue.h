@@ -0,0 +1,233 @@
+/************************************************************************/
+/**
+ * @file nfAsyncFileQueue.h
+ * @author Mara Castellanos
+ * @date 18/10/26
+ * @brief Reads of files in the background, with io_uring on Linux and a
+ *        pool of threads on the rest.
+ *
+ * @bug Not bug Known.
+ */
+/************************************************************************/
+
+#pragma once
+
+#include <deque>
+#include <future>
+
+#include "nfPrerequisitesUtilities.h"
+#include "nfFile.h"
+
+namespace nfEngineSDK {
+  /**
+   * @brief
+   * A range of a file to read and where to write it.
+   */
+  struct AsyncReadRequest
+  {
+    /*
+     * The file, open until the read completes. Open it with
+     * File::openStream() to read from the disk instead of the memory.
+     */
+    const File* file;
+    /*
+     * The first byte to read.
+     */
+    SIZE_T offset;
+    /*
+     * The number of bytes to read.
+     */
+    SIZE_T size;
+    /*
+     * Where the bytes are written, valid until the read completes.
+     */
+    void* destination;
+  };
+
+  /**
+   * @brief
+   * A queue of reads that are done in the background.
+   *
+   * @description
+   * On Linux the reads go to the kernel with io_uring from one thread, up
+   * to the queue depth in flight at the same time. Where io_uring is not
+   * available (other systems, old kernels, sandboxes that block it) a pool
+   * of threads does blocking positioned reads, never more threads than the
+   * queue depth.
+   *
+   * The requests of a batch that are contiguous on the same file are joined
+   * in a single read, up to kMAX_COALESCED_SIZE bytes and
+   * kMAX_COALESCED_REQUESTS requests, scattered straight to their
+   * destinations.
+   *
+   * The callbacks run on the threads of the queue, they should be short.
+   * They can submit more reads.
+   */
+  class NF_UTILITIES_EXPORT AsyncFileQueue
+  {
+   public:
+    /*
+     * The function called when a request completes, with the request and
+     * the bytes read, less than the size at the end of the file or on an
+     * error.
+     */
+    using Callback = Function<void(const AsyncReadRequest&, SIZE_T)>;
+
+    /**
+     * @brief
+     * Starts the queue.
+     *
+     * @param _queueDepth
+     * The most reads in flight at the same time.
+     * @param _threads
+     * The number of threads of the pool when io_uring is not available, 0
+     * for all the hardware ones. It is never more than _queueDepth.
+     */
+    explicit
+    AsyncFileQueue(uint32 _queueDepth = kDEFAULT_QUEUE_DEPTH, uint32 _threads = 0);
+    AsyncFileQueue(const AsyncFileQueue&) = delete;
+    /**
+     * @brief
+     * Waits for all the reads and stops the threads.
+     */
+    ~AsyncFileQueue();
+
+    AsyncFileQueue&
+    operator=(const AsyncFileQueue&) = delete;
+
+    /**
+     * @brief
+     * Queues a batch of reads, it doesn't wait for them.
+     *
+     * @param _requests
+     * The requests, copied.
+     * @param _count
+     * The number of requests.
+     * @param _callback
+     * Called once for every request when it completes, in any order.
+     */
+    void
+    submit(const AsyncReadRequest* _requests, SIZE_T _count, const Callback& _callback);
+    /**
+     * @brief
+     * Queues a read, it doesn't wait for it.
+     *
+     * @param _request
+     * The request.
+     *
+     * @return
+     * The future number of bytes read.
+     */
+    std::future<SIZE_T>
+    submit(const AsyncReadRequest& _request);
+
+    /**
+     * @brief
+     * Waits until every read submitted has completed and its callback has
+     * returned.
+     */
+    void
+    wait();
+
+    /**
+     * @brief
+     * Checks if the reads go through io_uring or through the pool.
+     *
+     * @return
+     * True with io_uring.
+     */
+    FORCEINLINE bool
+    isUsingIoUring() const
+    {
+      return nullptr != m_ring;
+    }
+    /**
+     * @brief
+     * Returns the most reads in flight at the same time.
+     *
+     * @return
+     * The queue depth.
+     */
+    FORCEINLINE uint32
+    getQueueDepth() const
+    {
+      return m_queueDepth;
+    }
+
+    /*
+     * The queue depth when none is given.
+     */
+    static const uint32 kDEFAULT_QUEUE_DEPTH = 64;
+    /*
+     * The biggest read made by joining contiguous requests.
+     */
+    static const SIZE_T kMAX_COALESCED_SIZE = 256 * 1024;
+    /*
+     * The most requests joined in a read.
+     */
+    static const uint32 kMAX_COALESCED_REQUESTS = 64;
+
+   private:
+    /*
+     * A read of one or more contiguous requests, defined on the source.
+     */
+    struct Operation;
+    /*
+     * The io_uring instance, defined on the source.
+     */
+    struct Ring;
+
+    /*
+     * Reads the operations on the thread of the ring.
+     */
+    void
+    ringLoop();
+    /*
+     * Reads the operations on a thread of the pool.
+     */
+    void
+    workerLoop();
+    /*
+     * Calls the callbacks of an operation and frees it.
+     */
+    void
+    complete(Operation* _operation, SIZE_T _bytesRead);
+
+    /*
+     * Guards the pending operations and the counters.
+     */
+    std::mutex m_mutex;
+    /*
+     * Wakes the pool when there are pending operations.
+     */
+    std::condition_variable m_wake;
+    /*
+     * Wakes wait() when the last operation completes.
+     */
+    std::condition_variable m_idle;
+    /*
+     * The operations not started yet.
+     */
+    std::deque<Operation*> m_pending;
+    /*
+     * The operations submitted and not completed.
+     */
+    SIZE_T m_outstanding = 0;
+    /*
+     * If the threads must stop.
+     */
+    bool m_stop = false;
+    /*
+     * The most reads in flight.
+     */
+    uint32 m_queueDepth;
+    /*
+     * The io_uring, null with the pool.
+     */
+    Ring* m_ring = nullptr;
+    /*
+     * The thread of the ring or the threads of the pool.
+     */
+    Vector<std::thread> m_threads;
+  };
+}
@@ -0,0 +1,796 @@
+/************************************************************************/
+/**
+ * @file nfBatchKernels.h
+ * @author Mara Castellanos
+ * @date 18/10/26
+ * @brief The bodies of the BatchMath and Skinning kernels, written once over
+ *        a register type and compiled by the file of every CPU tier.
+ *
+ * @bug Not bug Known.
+ */
+/************************************************************************/
+
+#pragma once
+
+#include <cmath>
+#include <cstring>
+
+#if NF_ARCH_X86
+# include <immintrin.h>
+#endif
+
+#include "nfPrerequisitesUtilities.h"
+#include "nfBatchMath.h"
+
+/*
+ * Only for the files of the tiers, between NF_TARGET_BEGIN and
+ * NF_TARGET_END so the templates take the instruction set of the file.
+ * Everything is on an unnamed namespace, the same template instantiated by
+ * two tiers must not be merged by the linker.
+ *
+ * A register type ("pack") has kLANES floats and the operations used below,
+ * the kernels run the pack of the tier over the groups of kLANES elements
+ * and ScalarPack over the rest. The wide packs are made of 128 bits lanes,
+ * and the arrays of Vector3f are turned to a register per component with
+ * shuffles inside every lane.
+ */
+namespace nfEngineSDK {
+  namespace {
+    static_assert(sizeof(Vector3f) == sizeof(float) * 3, "Vector3f has padding");
+    static_assert(sizeof(Vector4f) == sizeof(float) * 4, "Vector4f has padding");
+    static_assert(sizeof(Sphere) == sizeof(float) * 4, "Sphere is not a center and a radius");
+
+    /*
+     * pi / 2 in three parts, the first two with few enough bits that their
+     * products by the quadrant are exact.
+     */
+    const float kSINCOS_2_OVER_PI = 0.636619772367581343f;
+    const float kSINCOS_PI_OVER_2_HI = 1.5703125f;
+    const float kSINCOS_PI_OVER_2_MID = 4.837512969970703125e-4f;
+    const float kSINCOS_PI_OVER_2_LO = 7.54978995489188216e-8f;
+    /*
+     * The polynomials of sine and cosine on [-pi/4, pi/4].
+     */
+    const float kSIN_C0 = -1.9515295891e-4f;
+    const float kSIN_C1 = 8.3321608736e-3f;
+    const float kSIN_C2 = -1.6666654611e-1f;
+    const float kCOS_C0 = 2.443315711809948e-5f;
+    const float kCOS_C1 = -1.388731625493765e-3f;
+    const float kCOS_C2 = 4.166664568298827e-2f;
+
+    /*
+     * One float, for the elements left after the groups and for the scalar
+     * tier.
+     */
+    struct ScalarPack
+    {
+      using Reg = float;
+      using IntReg = int32;
+      using Mask = bool;
+      static const SIZE_T kLANES = 1;
+
+      static FORCEINLINE Reg load(const float* p) { return *p; }
+      static FORCEINLINE void store(float* p, Reg v) { *p = v; }
+      static FORCEINLINE Reg set(float v) { return v; }
+      static FORCEINLINE Reg add(Reg a, Reg b) { return a + b; }
+      static FORCEINLINE Reg sub(Reg a, Reg b) { return a - b; }
+      static FORCEINLINE Reg mul(Reg a, Reg b) { return a * b; }
+      static FORCEINLINE Reg div(Reg a, Reg b) { return a / b; }
+      static FORCEINLINE Reg sqrt(Reg a) { return std::sqrt(a); }
+      static FORCEINLINE Reg madd(Reg a, Reg b, Reg c) { return a * b + c; }
+      static FORCEINLINE IntReg roundToInt(Reg a) { return static_cast<int32>(std::lrint(a)); }
+      static FORCEINLINE Reg toFloat(IntReg a) { return static_cast<float>(a); }
+      static FORCEINLINE IntReg setInt(int32 v) { return v; }
+      static FORCEINLINE IntReg addInt(IntReg a, IntReg b) { return a + b; }
+      static FORCEINLINE IntReg andInt(IntReg a, IntReg b) { return a & b; }
+      template<int bits>
+      static FORCEINLINE IntReg shiftLeft(IntReg a)
+      {
+        return static_cast<int32>(static_cast<uint32>(a) << bits);
+      }
+      static FORCEINLINE Reg xorBits(Reg a, IntReg b)
+      {
+        uint32 bits;
+        std::memcpy(&bits, &a, sizeof(float));
+        bits ^= static_cast<uint32>(b);
+        std::memcpy(&a, &bits, sizeof(float));
+        return a;
+      }
+      static FORCEINLINE Mask greater(Reg a, Reg b) { return a > b; }
+      static FORCEINLINE Mask greaterEqual(Reg a, Reg b) { return a >= b; }
+      static FORCEINLINE Mask equalInt(IntReg a, IntReg b) { return a == b; }
+      static FORCEINLINE Mask andMask(Mask a, Mask b) { return a && b; }
+      static FORCEINLINE Reg select(Mask m, Reg a, Reg b) { return m ? a : b; }
+      static FORCEINLINE uint32 maskBits(Mask m) { return m ? 1u : 0u; }
+    };
+
+#if NF_ARCH_X86
+    /*
+     * Four floats on SSE2, or SSE4.1 with the blends.
+     */
+    template<bool sse41>
+    struct SSEPack
+    {
+      using Reg = __m128;
+      using IntReg = __m128i;
+      using Mask = __m128;
+      static const SIZE_T kLANES = 4;
+
+      static FORCEINLINE Reg load(const float* p) { return _mm_loadu_ps(p); }
+      static FORCEINLINE void store(float* p, Reg v) { _mm_storeu_ps(p, v); }
+      static FORCEINLINE Reg loadQuads(const float* p, SIZE_T) { return _mm_loadu_ps(p); }
+      static FORCEINLINE void storeQuads(float* p, SIZE_T, Reg v) { _mm_storeu_ps(p, v); }
+      template<int i0, int i1, int i2, int i3>
+      static FORCEINLINE Reg shuffle(Reg a, Reg b)
+      {
+        return _mm_shuffle_ps(a, b, _MM_SHUFFLE(i3, i2, i1, i0));
+      }
+      static FORCEINLINE Reg set(float v) { return _mm_set1_ps(v); }
+      static FORCEINLINE Reg add(Reg a, Reg b) { return _mm_add_ps(a, b); }
+      static FORCEINLINE Reg sub(Reg a, Reg b) { return _mm_sub_ps(a, b); }
+      static FORCEINLINE Reg mul(Reg a, Reg b) { return _mm_mul_ps(a, b); }
+      static FORCEINLINE Reg div(Reg a, Reg b) { return _mm_div_ps(a, b); }
+      static FORCEINLINE Reg sqrt(Reg a) { return _mm_sqrt_ps(a); }
+      static FORCEINLINE Reg madd(Reg a, Reg b, Reg c) { return _mm_add_ps(_mm_mul_ps(a, b), c); }
+      static FORCEINLINE IntReg roundToInt(Reg a) { return _mm_cvtps_epi32(a); }
+      static FORCEINLINE Reg toFloat(IntReg a) { return _mm_cvtepi32_ps(a); }
+      static FORCEINLINE IntReg setInt(int32 v) { return _mm_set1_epi32(v); }
+      static FORCEINLINE IntReg addInt(IntReg a, IntReg b) { return _mm_add_epi32(a, b); }
+      static FORCEINLINE IntReg andInt(IntReg a, IntReg b) { return _mm_and_si128(a, b); }
+      template<int bits>
+      static FORCEINLINE IntReg shiftLeft(IntReg a) { return _mm_slli_epi32(a, bits); }
+      static FORCEINLINE Reg xorBits(Reg a, IntReg b) { return _mm_xor_ps(a, _mm_castsi128_ps(b)); }
+      static FORCEINLINE Mask greater(Reg a, Reg b) { return _mm_cmpgt_ps(a, b); }
+      static FORCEINLINE Mask greaterEqual(Reg a, Reg b) { return _mm_cmpge_ps(a, b); }
+      static FORCEINLINE Mask equalInt(IntReg a, IntReg b)
+      {
+        return _mm_castsi128_ps(_mm_cmpeq_epi32(a, b));
+      }
+      static FORCEINLINE Mask andMask(Mask a, Mask b) { return _mm_and_ps(a, b); }
+      static FORCEINLINE Reg select(Mask m, Reg a, Reg b)
+      {
+        if constexpr (sse41) {
+          return _mm_blendv_ps(b, a, m);
+        }
+        else {
+          return _mm_or_ps(_mm_and_ps(m, a), _mm_andnot_ps(m, b));
+        }
+      }
+      static FORCEINLINE uint32 maskBits(Mask m) { return static_cast<uint32>(_mm_movemask_ps(m)); }
+    };
+#endif
+
+    /*
+     * Reads kLANES consecutive Vector3f as a register per component. Every
+     * 128 bits lane takes 4 vectors, 12 floats, from three loads.
+     */
+    template<class P>
+    FORCEINLINE void
+    loadXYZ(const float* _p, typename P::Reg& _x, typename P::Reg& _y, typename P::Reg& _z)
+    {
+      if constexpr (1 == P::kLANES) {
+        _x = _p[0];
+        _y = _p[1];
+        _z = _p[2];
+      }
+      else {
+        /* a = x0 y0 z0 x1, b = y1 z1 x2 y2, c = z2 x3 y3 z3 */
+        typename P::Reg a = P::loadQuads(_p, 12);
+        typename P::Reg b = P::loadQuads(_p + 4, 12);
+        typename P::Reg c = P::loadQuads(_p + 8, 12);
+        _x = P::template shuffle<0, 3, 0, 2>(a, P::template shuffle<2, 0, 1, 0>(b, c));
+        _y = P::template shuffle<0, 2, 0, 2>(P::template shuffle<1, 0, 0, 0>(a, b),
+                                             P::template shuffle<3, 0, 2, 0>(b, c));
+        _z = P::template shuffle<0, 2, 0, 2>(P::template shuffle<2, 0, 1, 0>(a, b),
+                                             P::template shuffle<0, 0, 3, 0>(c, c));
+      }
+    }
+
+    /*
+     * Writes a register per component as kLANES consecutive Vector3f.
+     */
+    template<class P>
+    FORCEINLINE void
+    storeXYZ(float* _p, typename P::Reg _x, typename P::Reg _y, typename P::Reg _z)
+    {
+      if constexpr (1 == P::kLANES) {
+        _p[0] = _x;
+        _p[1] = _y;
+        _p[2] = _z;
+      }
+      else {
+        P::storeQuads(_p, 12, P::template shuffle<0, 2, 0, 2>(
+          P::template shuffle<0, 0, 0, 0>(_x, _y), P::template shuffle<0, 0, 1, 1>(_z, _x)));
+        P::storeQuads(_p + 4, 12, P::template shuffle<0, 2, 0, 2>(
+          P::template shuffle<1, 1, 1, 1>(_y, _z), P::template shuffle<2, 2, 2, 2>(_x, _y)));
+        P::storeQuads(_p + 8, 12, P::template shuffle<0, 2, 0, 2>(
+          P::template shuffle<2, 2, 3, 3>(_z, _x), P::template shuffle<3, 3, 3, 3>(_y, _z)));
+      }
+    }
+
+    /*
+     * Reads kLANES consecutive records of 4 floats as a register per
+     * component, a transpose of every 4x4 block.
+     */
+    template<class P>
+    FORCEINLINE void
+    loadXYZW(const float* _p,
+             typename P::Reg& _x,
+             typename P::Reg& _y,
+             typename P::Reg& _z,
+             typename P::Reg& _w)
+    {
+      if constexpr (1 == P::kLANES) {
+        _x = _p[0];
+        _y = _p[1];
+        _z = _p[2];
+        _w = _p[3];
+      }
+      else {
+        typename P::Reg r0 = P::loadQuads(_p, 16);
+        typename P::Reg r1 = P::loadQuads(_p + 4, 16);
+        typename P::Reg r2 = P::loadQuads(_p + 8, 16);
+        typename P::Reg r3 = P::loadQuads(_p + 12, 16);
+        typename P::Reg t0 = P::template shuffle<0, 1, 0, 1>(r0, r1);
+        typename P::Reg t1 = P::template shuffle<0, 1, 0, 1>(r2, r3);
+        typename P::Reg t2 = P::template shuffle<2, 3, 2, 3>(r0, r1);
+        typename P::Reg t3 = P::template shuffle<2, 3, 2, 3>(r2, r3);
+        _x = P::template shuffle<0, 2, 0, 2>(t0, t1);
+        _y = P::template shuffle<1, 3, 1, 3>(t0, t1);
+        _z = P::template shuffle<0, 2, 0, 2>(t2, t3);
+        _w = P::template shuffle<1, 3, 1, 3>(t2, t3);
+      }
+    }
+
+    /*
+     * The matrix times (x, y, z, 1) for points or (x, y, z, 0) for
+     * directions, from _begin while there are full groups.
+     */
+    template<class P, bool points>
+    SIZE_T
+    transformGroups(const float* _m,
+                    const Vector3f* _in,
+                    Vector3f* _out,
+                    SIZE_T _begin,
+                    SIZE_T _count)
+    {
+      using Reg = typename P::Reg;
+      const float* in = reinterpret_cast<const float*>(_in);
+      float* out = reinterpret_cast<float*>(_out);
+      Reg m00 = P::set(_m[0]), m01 = P::set(_m[1]), m02 = P::set(_m[2]), m03 = P::set(_m[3]);
+      Reg m10 = P::set(_m[4]), m11 = P::set(_m[5]), m12 = P::set(_m[6]), m13 = P::set(_m[7]);
+      Reg m20 = P::set(_m[8]), m21 = P::set(_m[9]), m22 = P::set(_m[10]), m23 = P::set(_m[11]);
+      SIZE_T i = _begin;
+      for (; i + P::kLANES <= _count; i += P::kLANES) {
+        Reg x, y, z;
+        loadXYZ<P>(in + i * 3, x, y, z);
+        Reg ox, oy, oz;
+        if constexpr (points) {
+          ox = P::madd(m00, x, P::madd(m01, y, P::madd(m02, z, m03)));
+          oy = P::madd(m10, x, P::madd(m11, y, P::madd(m12, z, m13)));
+          oz = P::madd(m20, x, P::madd(m21, y, P::madd(m22, z, m23)));
+        }
+        else {
+          ox = P::madd(m00, x, P::madd(m01, y, P::mul(m02, z)));
+          oy = P::madd(m10, x, P::madd(m11, y, P::mul(m12, z)));
+          oz = P::madd(m20, x, P::madd(m21, y, P::mul(m22, z)));
+        }
+        storeXYZ<P>(out + i * 3, ox, oy, oz);
+      }
+      return i;
+    }
+
+    template<class P, bool points>
+    void
+    transformKernel(const float* _m, const Vector3f* _in, Vector3f* _out, SIZE_T _count)
+    {
+      SIZE_T i = transformGroups<P, points>(_m, _in, _out, 0, _count);
+      transformGroups<ScalarPack, points>(_m, _in, _out, i, _count);
+    }
+
+    template<class P>
+    SIZE_T
+    normalizeGroups(const Vector3f* _in, Vector3f* _out, SIZE_T _begin, SIZE_T _count)
+    {
+      using Reg = typename P::Reg;
+      const float* in = reinterpret_cast<const float*>(_in);
+      float* out = reinterpret_cast<float*>(_out);
+      Reg zero = P::set(0.0f);
+      Reg one = P::set(1.0f);
+      SIZE_T i = _begin;
+      for (; i + P::kLANES <= _count; i += P::kLANES) {
+        Reg x, y, z;
+        loadXYZ<P>(in + i * 3, x, y, z);
+        Reg length2 = P::madd(x, x, P::madd(y, y, P::mul(z, z)));
+        Reg inverse = P::select(P::greater(length2, zero),
+                                P::div(one, P::sqrt(length2)),
+                                zero);
+        storeXYZ<P>(out + i * 3, P::mul(x, inverse), P::mul(y, inverse), P::mul(z, inverse));
+      }
+      return i;
+    }
+
+    template<class P>
+    void
+    normalizeKernel(const Vector3f* _in, Vector3f* _out, SIZE_T _count)
+    {
+      SIZE_T i = normalizeGroups<P>(_in, _out, 0, _count);
+      normalizeGroups<ScalarPack>(_in, _out, i, _count);
+    }
+
+    /*
+     * Reduces the angle to [-pi/4, pi/4] plus a quadrant, evaluates both
+     * polynomials and swaps and negates them by the quadrant.
+     */
+    template<class P>
+    SIZE_T
+    sinCosGroups(const float* _angles, float* _sin, float* _cos, SIZE_T _begin, SIZE_T _count)
+    {
+      using Reg = typename P::Reg;
+      using IntReg = typename P::IntReg;
+      SIZE_T i = _begin;
+      for (; i + P::kLANES <= _count; i += P::kLANES) {
+        Reg x = P::load(_angles + i);
+        IntReg quadrant = P::roundToInt(P::mul(x, P::set(kSINCOS_2_OVER_PI)));
+        Reg q = P::toFloat(quadrant);
+        Reg y = P::madd(q, P::set(-kSINCOS_PI_OVER_2_HI), x);
+        y = P::madd(q, P::set(-kSINCOS_PI_OVER_2_MID), y);
+        y = P::madd(q, P::set(-kSINCOS_PI_OVER_2_LO), y);
+        Reg z = P::mul(y, y);
+
+        Reg s = P::madd(P::set(kSIN_C0), z, P::set(kSIN_C1));
+        s = P::madd(s, z, P::set(kSIN_C2));
+        s = P::madd(P::mul(s, z), y, y);
+        Reg c = P::madd(P::set(kCOS_C0), z, P::set(kCOS_C1));
+        c = P::madd(c, z, P::set(kCOS_C2));
+        c = P::madd(P::mul(c, z), z, P::madd(z, P::set(-0.5f), P::set(1.0f)));
+
+        /* Odd quadrants swap them, the sign comes from bit 1. */
+        IntReg one = P::setInt(1);
+        IntReg two = P::setInt(2);
+        typename P::Mask swap = P::equalInt(P::andInt(quadrant, one), one);
+        Reg sine = P::select(swap, c, s);
+        Reg cosine = P::select(swap, s, c);
+        sine = P::xorBits(sine, P::template shiftLeft<30>(P::andInt(quadrant, two)));
+        cosine = P::xorBits(cosine, P::template shiftLeft<30>(
+          P::andInt(P::addInt(quadrant, one), two)));
+        P::store(_sin + i, sine);
+        P::store(_cos + i, cosine);
+      }
+      return i;
+    }
+
+    template<class P>
+    void
+    sinCosKernel(const float* _angles, float* _sin, float* _cos, SIZE_T _count)
+    {
+      SIZE_T i = sinCosGroups<P>(_angles, _sin, _cos, 0, _count);
+      sinCosGroups<ScalarPack>(_angles, _sin, _cos, i, _count);
+    }
+
+    /*
+     * Tests kLANES spheres against all the planes and appends the inside
+     * ones to _visible without branches: every index is written and the
+     * count only moves for the ones inside.
+     */
+    template<class P>
+    SIZE_T
+    cullSpheresGroups(const Vector4f* _planes,
+                      uint32 _planeCount,
+                      const Sphere* _spheres,
+                      SIZE_T _begin,
+                      SIZE_T _count,
+                      uint32* _visible,
+                      SIZE_T& _written)
+    {
+      using Reg = typename P::Reg;
+      const float* spheres = reinterpret_cast<const float*>(_spheres);
+      const float* planes = reinterpret_cast<const float*>(_planes);
+      const uint32 allLanes = static_cast<uint32>((uint64(1) << P::kLANES) - 1);
+      Reg zero = P::set(0.0f);
+      SIZE_T written = _written;
+      SIZE_T i = _begin;
+      for (; i + P::kLANES <= _count; i += P::kLANES) {
+        Reg x, y, z, radius;
+        loadXYZW<P>(spheres + i * 4, x, y, z, radius);
+        Reg minDistance = P::sub(zero, radius);
+        uint32 inside = allLanes;
+        for (uint32 p = 0; p < _planeCount && 0 != inside; ++p) {
+          const float* plane = planes + p * 4;
+          Reg distance = P::madd(P::set(plane[0]), x,
+                                 P::madd(P::set(plane[1]), y,
+                                         P::madd(P::set(plane[2]), z, P::set(plane[3]))));
+          inside &= P::maskBits(P::greaterEqual(distance, minDistance));
+        }
+        for (uint32 lane = 0; lane < P::kLANES; ++lane) {
+          _visible[written] = static_cast<uint32>(i + lane);
+          written += (inside >> lane) & 1u;
+        }
+      }
+      _written = written;
+      return i;
+    }
+
+    template<class P>
+    SIZE_T
+    cullSpheresKernel(const Vector4f* _planes,
+                      uint32 _planeCount,
+                      const Sphere* _spheres,
+                      SIZE_T _count,
+                      uint32* _visible)
+    {
+      SIZE_T written = 0;
+      SIZE_T i = cullSpheresGroups<P>(_planes, _planeCount, _spheres, 0, _count, _visible, written);
+      cullSpheresGroups<ScalarPack>(_planes, _planeCount, _spheres, i, _count, _visible, written);
+      return written;
+    }
+
+    template<class P>
+    void
+    fillMathKernels(BatchKernels& _kernels)
+    {
+      _kernels.transformPoints = &transformKernel<P, true>;
+      _kernels.transformDirections = &transformKernel<P, false>;
+      _kernels.normalize = &normalizeKernel<P>;
+      _kernels.sinCos = &sinCosKernel<P>;
+      _kernels.cullSpheres = &cullSpheresKernel<P>;
+    }
+
+    /*
+     * Skinning. A "skinner" has the Columns of a blended 3x4 matrix and the
+     * blend of dual quaternions for its tier, the loops are shared.
+     */
+    FORCEINLINE const uint8*
+    vertexAt(const void* _first, SIZE_T _stride, SIZE_T _index)
+    {
+      return static_cast<const uint8*>(_first) + _stride * _index;
+    }
+
+    template<class T>
+    FORCEINLINE const T*
+    streamAt(const T* _first, SIZE_T _stride, SIZE_T _index)
+    {
+      return reinterpret_cast<const T*>(vertexAt(_first, _stride, _index));
+    }
+
+    /*
+     * Writes in _c the matrix of a blended dual quaternion, normalizing it
+     * on the way.
+     */
+    template<class Columns>
+    FORCEINLINE void
+    dualQuaternionToColumns(const float* _dq, Columns& _c)
+    {
+      alignas(16) float m[16];
+      float x = _dq[0], y = _dq[1], z = _dq[2], w = _dq[3];
+      float dx = _dq[4], dy = _dq[5], dz = _dq[6], dw = _dq[7];
+      /* Dividing by the squared length here is the same as normalizing. */
+      float s = 2.0f / (x * x + y * y + z * z + w * w);
+      float xs = x * s, ys = y * s, zs = z * s;
+      float xx = x * xs, yy = y * ys, zz = z * zs;
+      float xy = x * ys, xz = x * zs, yz = y * zs;
+      float wx = w * xs, wy = w * ys, wz = w * zs;
+
+      m[0] = 1.0f - (yy + zz); m[1] = xy + wz; m[2] = xz - wy; m[3] = 0.0f;
+      m[4] = xy - wz; m[5] = 1.0f - (xx + zz); m[6] = yz + wx; m[7] = 0.0f;
+      m[8] = xz + wy; m[9] = yz - wx; m[10] = 1.0f - (xx + yy); m[11] = 0.0f;
+      /* translation = 2 dual * conjugate(real) */
+      m[12] = s * (w * dx - dw * x + y * dz - z * dy);
+      m[13] = s * (w * dy - dw * y + z * dx - x * dz);
+      m[14] = s * (w * dz - dw * z + x * dy - y * dx);
+      m[15] = 0.0f;
+      _c.load(m);
+    }
+
+    struct ScalarSkinner
+    {
+      /*
+       * A 3x4 matrix by padded columns, as in SkinningMatrix.
+       */
+      struct Columns
+      {
+        FORCEINLINE void
+        load(const float* _m)
+        {
+          for (uint32 i = 0; i < 16; ++i) {
+            c[i] = _m[i];
+          }
+        }
+        FORCEINLINE void
+        scale(const float* _m, float _w)
+        {
+          for (uint32 i = 0; i < 16; ++i) {
+            c[i] = _w * _m[i];
+          }
+        }
+        FORCEINLINE void
+        addScaled(const float* _m, float _w)
+        {
+          for (uint32 i = 0; i < 16; ++i) {
+            c[i] += _w * _m[i];
+          }
+        }
+
+        FORCEINLINE Vector3f
+        rotate(const float* _xyz) const
+        {
+          return Vector3f(c[0] * _xyz[0] + c[4] * _xyz[1] + c[8] * _xyz[2],
+                          c[1] * _xyz[0] + c[5] * _xyz[1] + c[9] * _xyz[2],
+                          c[2] * _xyz[0] + c[6] * _xyz[1] + c[10] * _xyz[2]);
+        }
+        FORCEINLINE void
+        point(const float* _xyz, Vector3f& _out) const
+        {
+          _out = rotate(_xyz) + Vector3f(c[12], c[13], c[14]);
+        }
+        FORCEINLINE void
+        direction(const float* _xyz, Vector3f& _out) const
+        {
+          _out = rotate(_xyz);
+        }
+        FORCEINLINE void
+        unitDirection(const float* _xyz, Vector3f& _out) const
+        {
+          Vector3f v = rotate(_xyz);
+          _out = v * (1.0f / std::sqrt(v.dot(v)));
+        }
+
+        float c[16];
+      };
+
+      struct DualQuaternionSum
+      {
+        alignas(16) float v[8];
+      };
+
+      template<uint32 size>
+      static FORCEINLINE DualQuaternionSum
+      sumDualQuaternions(const SkinningDualQuaternion* _palette,
+                         const int32* _indices,
+                         const float* _weights)
+      {
+        DualQuaternionSum out;
+        const float* q0 = &_palette[_indices[0]].real.x;
+        for (uint32 k = 0; k < 8; ++k) {
+          out.v[k] = _weights[0] * q0[k];
+        }
+        for (uint32 i = 1; i < size; ++i) {
+          const float* q = &_palette[_indices[i]].real.x;
+          float d = q0[0] * q[0] + q0[1] * q[1] + q0[2] * q[2] + q0[3] * q[3];
+          float w = d < 0.0f ? -_weights[i] : _weights[i];
+          for (uint32 k = 0; k < 8; ++k) {
+            out.v[k] += w * q[k];
+          }
+        }
+        return out;
+      }
+
+      static FORCEINLINE void
+      toColumns(const DualQuaternionSum& _sum, Columns& _c)
+      {
+        dualQuaternionToColumns(_sum.v, _c);
+      }
+    };
+
+#if NF_ARCH_X86
+    template<bool sse41>
+    struct SSESkinner
+    {
+      /*
+       * Writes the first three floats of the register.
+       */
+      static FORCEINLINE void
+      storeVector3(Vector3f& _out, __m128 _v)
+      {
+        _mm_storel_pi(reinterpret_cast<__m64*>(&_out.x), _v);
+        _mm_store_ss(&_out.z, _mm_movehl_ps(_v, _v));
+      }
+
+      /*
+       * Divides the vector by its length, the fourth float must be 0.
+       */
+      static FORCEINLINE __m128
+      normalize3(__m128 _v)
+      {
+        if constexpr (sse41) {
+          return _mm_div_ps(_v, _mm_sqrt_ps(_mm_dp_ps(_v, _v, 0x7F)));
+        }
+        else {
+          __m128 sq = _mm_mul_ps(_v, _v);
+          __m128 sum = _mm_add_ps(sq, _mm_shuffle_ps(sq, sq, _MM_SHUFFLE(2, 3, 0, 1)));
+          sum = _mm_add_ps(sum, _mm_shuffle_ps(sum, sum, _MM_SHUFFLE(1, 0, 3, 2)));
+          return _mm_div_ps(_v, _mm_sqrt_ps(sum));
+        }
+      }
+
+      /*
+       * A 3x4 matrix with a column per register.
+       */
+      struct Columns
+      {
+        FORCEINLINE void
+        load(const float* _m)
+        {
+          for (uint32 i = 0; i < 4; ++i) {
+            c[i] = _mm_load_ps(_m + i * 4);
+          }
+        }
+        FORCEINLINE void
+        scale(const float* _m, float _w)
+        {
+          __m128 w = _mm_set1_ps(_w);
+          for (uint32 i = 0; i < 4; ++i) {
+            c[i] = _mm_mul_ps(w, _mm_load_ps(_m + i * 4));
+          }
+        }
+        FORCEINLINE void
+        addScaled(const float* _m, float _w)
+        {
+          __m128 w = _mm_set1_ps(_w);
+          for (uint32 i = 0; i < 4; ++i) {
+            c[i] = _mm_add_ps(c[i], _mm_mul_ps(w, _mm_load_ps(_m + i * 4)));
+          }
+        }
+
+        FORCEINLINE __m128
+        rotate(const float* _xyz) const
+        {
+          __m128 r = _mm_mul_ps(c[0], _mm_set1_ps(_xyz[0]));
+          r = _mm_add_ps(r, _mm_mul_ps(c[1], _mm_set1_ps(_xyz[1])));
+          return _mm_add_ps(r, _mm_mul_ps(c[2], _mm_set1_ps(_xyz[2])));
+        }
+        FORCEINLINE void
+        point(const float* _xyz, Vector3f& _out) const
+        {
+          storeVector3(_out, _mm_add_ps(rotate(_xyz), c[3]));
+        }
+        FORCEINLINE void
+        direction(const float* _xyz, Vector3f& _out) const
+        {
+          storeVector3(_out, rotate(_xyz));
+        }
+        FORCEINLINE void
+        unitDirection(const float* _xyz, Vector3f& _out) const
+        {
+          storeVector3(_out, normalize3(rotate(_xyz)));
+        }
+
+        __m128 c[4];
+      };
+
+      /*
+       * A blended dual quaternion, real part and then dual part.
+       */
+      struct DualQuaternionSum
+      {
+        alignas(16) float v[8];
+      };
+
+      template<uint32 size>
+      static FORCEINLINE DualQuaternionSum
+      sumDualQuaternions(const SkinningDualQuaternion* _palette,
+                         const int32* _indices,
+                         const float* _weights)
+      {
+        const float* q0 = &_palette[_indices[0]].real.x;
+        __m128 w = _mm_set1_ps(_weights[0]);
+        __m128 real = _mm_mul_ps(w, _mm_load_ps(q0));
+        __m128 dual = _mm_mul_ps(w, _mm_load_ps(q0 + 4));
+        for (uint32 i = 1; i < size; ++i) {
+          const float* q = &_palette[_indices[i]].real.x;
+          float d = q0[0] * q[0] + q0[1] * q[1] + q0[2] * q[2] + q0[3] * q[3];
+          w = _mm_set1_ps(d < 0.0f ? -_weights[i] : _weights[i]);
+          real = _mm_add_ps(real, _mm_mul_ps(w, _mm_load_ps(q)));
+          dual = _mm_add_ps(dual, _mm_mul_ps(w, _mm_load_ps(q + 4)));
+        }
+        DualQuaternionSum out;
+        _mm_store_ps(out.v, real);
+        _mm_store_ps(out.v + 4, dual);
+        return out;
+      }
+
+      static FORCEINLINE void
+      toColumns(const DualQuaternionSum& _sum, Columns& _c)
+      {
+        dualQuaternionToColumns(_sum.v, _c);
+      }
+    };
+#endif
+
+    /*
+     * The weighted sum of the bone matrices of a vertex, a rigid vertex
+     * takes the bone matrix as is.
+     */
+    template<class Skinner, uint32 size>
+    FORCEINLINE void
+    blendMatrices(const SkinningMatrix* _palette,
+                  const int32* _indices,
+                  const float* _weights,
+                  typename Skinner::Columns& _out)
+    {
+      if constexpr (1 == size) {
+        _out.load(_palette[_indices[0]].m);
+      }
+      else {
+        _out.scale(_palette[_indices[0]].m, _weights[0]);
+        for (uint32 i = 1; i < size; ++i) {
+          _out.addScaled(_palette[_indices[i]].m, _weights[i]);
+        }
+      }
+    }
+
+    /*
+     * Linear blend of the vertices from _begin to _end, with 'size' bones
+     * per vertex.
+     */
+    template<class Skinner, uint32 size, bool tangentSpace>
+    void
+    skinLinearRange(const SkinningMatrix* _palette,
+                    const Skinning::Streams& _streams,
+                    const Skinning::Outputs& _outputs,
+                    SIZE_T _begin,
+                    SIZE_T _end)
+    {
+      const SIZE_T stride = _streams.stride;
+      for (SIZE_T i = _begin; i < _end; ++i) {
+        typename Skinner::Columns c;
+        blendMatrices<Skinner, size>(_palette,
+                                     streamAt(_streams.indices, stride, i),
+                                     streamAt(_streams.weights, stride, i),
+                                     c);
+        c.point(streamAt(_streams.positions, stride, i), _outputs.positions[i]);
+        c.unitDirection(streamAt(_streams.normals, stride, i), _outputs.normals[i]);
+        if (tangentSpace) {
+          c.unitDirection(streamAt(_streams.tangents, stride, i), _outputs.tangents[i]);
+          c.unitDirection(streamAt(_streams.binormals, stride, i), _outputs.binormals[i]);
+        }
+      }
+    }
+
+    /*
+     * Dual quaternion blend of the vertices from _begin to _end, with 'size'
+     * bones per vertex.
+     */
+    template<class Skinner, uint32 size, bool tangentSpace>
+    void
+    skinDualQuaternionRange(const SkinningDualQuaternion* _palette,
+                            const Skinning::Streams& _streams,
+                            const Skinning::Outputs& _outputs,
+                            SIZE_T _begin,
+                            SIZE_T _end)
+    {
+      const SIZE_T stride = _streams.stride;
+      for (SIZE_T i = _begin; i < _end; ++i) {
+        typename Skinner::Columns c;
+        Skinner::toColumns(
+          Skinner::template sumDualQuaternions<size>(_palette,
+                                                     streamAt(_streams.indices, stride, i),
+                                                     streamAt(_streams.weights, stride, i)),
+          c);
+        c.point(streamAt(_streams.positions, stride, i), _outputs.positions[i]);
+        c.direction(streamAt(_streams.normals, stride, i), _outputs.normals[i]);
+        if (tangentSpace) {
+          c.direction(streamAt(_streams.tangents, stride, i), _outputs.tangents[i]);
+          c.direction(streamAt(_streams.binormals, stride, i), _outputs.binormals[i]);
+        }
+      }
+    }
+
+    template<class Skinner>
+    void
+    fillSkinningKernels(BatchKernels& _kernels)
+    {
+      _kernels.skinLinear[0] = &skinLinearRange<Skinner, 1, false>;
+      _kernels.skinLinear[1] = &skinLinearRange<Skinner, 2, false>;
+      _kernels.skinLinear[2] = &skinLinearRange<Skinner, 3, false>;
+      _kernels.skinLinear[3] = &skinLinearRange<Skinner, 4, false>;
+      _kernels.skinLinear[4] = &skinLinearRange<Skinner, 5, false>;
+      _kernels.skinLinear[5] = &skinLinearRange<Skinner, 6, false>;
+      _kernels.skinLinear[6] = &skinLinearRange<Skinner, 7, false>;
+      _kernels.skinLinear[7] = &skinLinearRange<Skinner, 8, false>;
+      _kernels.skinLinearTangents = &skinLinearRange<Skinner, 4, true>;
+      _kernels.skinDualQuaternion = &skinDualQuaternionRange<Skinner, 4, false>;
+      _kernels.skinDualQuaternionTangents = &skinDualQuaternionRange<Skinner, 4, true>;
+    }
+  }
+}
@@ -0,0 +1,236 @@
+/************************************************************************/
+/**
+ * @file nfBatchMath.h
+ * @author Mara Castellanos
+ * @date 18/10/26
+ * @brief Math over whole arrays (transforms, normalization, sine and cosine,
+ *        culling and skinning), with the kernels picked for the CPU at
+ *        startup.
+ *
+ * @bug Not bug Known.
+ */
+/************************************************************************/
+
+#pragma once
+
+#include "nfPrerequisitesUtilities.h"
+#include "nfCPUFeatures.h"
+#include "nfMatrix4.h"
+#include "nfSkinning.h"
+#include "nfSphere.h"
+#include "nfVector3.h"
+#include "nfVector4.h"
+
+namespace nfEngineSDK {
+  /**
+   * @brief
+   * The kernels of a CPU tier, BatchMath and Skinning call through it.
+   */
+  struct BatchKernels
+  {
+    void
+    (*transformPoints)(const float*, const Vector3f*, Vector3f*, SIZE_T);
+    void
+    (*transformDirections)(const float*, const Vector3f*, Vector3f*, SIZE_T);
+    void
+    (*normalize)(const Vector3f*, Vector3f*, SIZE_T);
+    void
+    (*sinCos)(const float*, float*, float*, SIZE_T);
+    SIZE_T
+    (*cullSpheres)(const Vector4f*, uint32, const Sphere*, SIZE_T, uint32*);
+
+    /*
+     * Linear blend by bones per vertex, 1 to 8, and with the tangent space
+     * for 4 bones.
+     */
+    Skinning::RangeKernel<SkinningMatrix> skinLinear[8];
+    Skinning::RangeKernel<SkinningMatrix> skinLinearTangents;
+    /*
+     * Dual quaternion blend for 4 bones, without and with the tangent space.
+     */
+    Skinning::RangeKernel<SkinningDualQuaternion> skinDualQuaternion;
+    Skinning::RangeKernel<SkinningDualQuaternion> skinDualQuaternionTangents;
+  };
+
+  /**
+   * @brief
+   * Math over whole arrays, for the per frame work over thousands of
+   * elements.
+   *
+   * @description
+   * Every kernel is compiled for all the CPU tiers (scalar, SSE2, SSE4.1,
+   * AVX2 with FMA and AVX-512) and the best one the CPU runs is picked the
+   * first time a kernel is used, so one binary runs on old and new
+   * hardware. A call is an indirect call through the table of the tier.
+   * The vectors are processed in groups of 4, 8 or 16, turned to a lane per
+   * vector on the load, and the rest with the scalar kernel.
+   *
+   * The tiers give the same results except for the rounding of the fused
+   * multiply adds of AVX2 and AVX-512; with NF_MATH_DETERMINISTIC they
+   * aren't fused and the results are the same bits on every tier.
+   *
+   * The outputs can be the same arrays as the inputs.
+   */
+  class NF_UTILITIES_EXPORT BatchMath
+  {
+   public:
+    /**
+     * @brief
+     * Transforms an array of points by the affine part of a matrix.
+     *
+     * @param _matrix
+     * The row major matrix, the points are columns on its right, its last
+     * row is ignored.
+     * @param _in
+     * The points.
+     * @param _out
+     * Where the transformed points are written.
+     * @param _count
+     * The number of points.
+     */
+    static FORCEINLINE void
+    transformPoints(const Matrix4f& _matrix,
+                    const Vector3f* _in,
+                    Vector3f* _out,
+                    SIZE_T _count)
+    {
+      getKernels().transformPoints(_matrix.m, _in, _out, _count);
+    }
+
+    /**
+     * @brief
+     * Transforms an array of directions by a matrix, without the
+     * translation.
+     */
+    static FORCEINLINE void
+    transformDirections(const Matrix4f& _matrix,
+                        const Vector3f* _in,
+                        Vector3f* _out,
+                        SIZE_T _count)
+    {
+      getKernels().transformDirections(_matrix.m, _in, _out, _count);
+    }
+
+    /**
+     * @brief
+     * Normalizes an array of vectors.
+     *
+     * @param _in
+     * The vectors, the ones of length 0 give 0.
+     * @param _out
+     * Where the unit vectors are written.
+     * @param _count
+     * The number of vectors.
+     */
+    static FORCEINLINE void
+    normalize(const Vector3f* _in, Vector3f* _out, SIZE_T _count)
+    {
+      getKernels().normalize(_in, _out, _count);
+    }
+
+    /**
+     * @brief
+     * The sine and the cosine of an array of angles.
+     *
+     * @description
+     * A polynomial over the angle reduced to [-pi/4, pi/4], below 2 ulp of
+     * error for angles up to 8192 radians. Past that the reduction loses
+     * bits, and past 2^31 / (pi / 2) it doesn't work.
+     *
+     * @param _angles
+     * The angles, in radians.
+     * @param _sin
+     * Where the sines are written.
+     * @param _cos
+     * Where the cosines are written.
+     * @param _count
+     * The number of angles.
+     */
+    static FORCEINLINE void
+    sinCos(const float* _angles, float* _sin, float* _cos, SIZE_T _count)
+    {
+      getKernels().sinCos(_angles, _sin, _cos, _count);
+    }
+
+    /**
+     * @brief
+     * Finds the spheres inside a set of planes, a frustum usually.
+     *
+     * @param _planes
+     * The planes as (normal, distance), the normals point inside. A sphere
+     * is inside when dot(normal, center) + distance >= -radius for all of
+     * them.
+     * @param _planeCount
+     * The number of planes.
+     * @param _spheres
+     * The spheres.
+     * @param _count
+     * The number of spheres.
+     * @param _visible
+     * Where the indices of the spheres inside are written, room for _count.
+     *
+     * @return
+     * The number of spheres inside.
+     */
+    static FORCEINLINE SIZE_T
+    cullSpheres(const Vector4f* _planes,
+                uint32 _planeCount,
+                const Sphere* _spheres,
+                SIZE_T _count,
+                uint32* _visible)
+    {
+      return getKernels().cullSpheres(_planes, _planeCount, _spheres, _count, _visible);
+    }
+
+    /**
+     * @brief
+     * Returns the kernels of the tier in use.
+     */
+    static const BatchKernels&
+    getKernels();
+
+    /**
+     * @brief
+     * Returns the tier of the kernels in use.
+     */
+    static CPU_TIER::E
+    getTier();
+
+    /**
+     * @brief
+     * Changes the tier of the kernels, to compare them in tests and
+     * benchmarks. The calls already running end with the old kernels.
+     *
+     * @param _tier
+     * The tier, clamped to the one the CPU supports.
+     *
+     * @return
+     * The tier in use after the call.
+     */
+    static CPU_TIER::E
+    setTier(CPU_TIER::E _tier);
+
+   private:
+    /*
+     * The table of a tier, all of them are filled on the first call.
+     */
+    static const BatchKernels&
+    getTable(CPU_TIER::E _tier);
+
+    /*
+     * Fill the table of a tier, each one on its own file compiled for its
+     * instruction set. The table has the kernels of the tier below, a tier
+     * only replaces the ones it has.
+     */
+    static void
+    fillScalarKernels(BatchKernels& _kernels);
+    static void
+    fillSSE2Kernels(BatchKernels& _kernels);
+    static void
+    fillSSE4_1Kernels(BatchKernels& _kernels);
+    static void
+    fillAVX2Kernels(BatchKernels& _kernels);
+    static void
+    fillAVX512Kernels(BatchKernels& _kernels);
+  };
+}
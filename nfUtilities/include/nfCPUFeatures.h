@@ -0,0 +1,116 @@
+/************************************************************************/
+/**
+ * @file nfCPUFeatures.h
+ * @author Mara Castellanos
+ * @date 18/10/26
+ * @brief The instruction sets of the CPU the engine runs on, read with
+ *        cpuid, to pick the batch kernels at startup.
+ *
+ * @bug Not bug Known.
+ */
+/************************************************************************/
+
+#pragma once
+
+#include "nfPrerequisitesUtilities.h"
+
+namespace nfEngineSDK {
+  /**
+   * @brief
+   * The instruction set tiers the batch kernels are compiled for, every one
+   * includes the ones before it.
+   */
+  namespace CPU_TIER {
+    enum E
+    {
+      kSCALAR = 0,
+      kSSE2 = 1,
+      kSSE4_1 = 2,
+      /*
+       * AVX2 and FMA.
+       */
+      kAVX2 = 3,
+      /*
+       * AVX-512 F, DQ, BW and VL.
+       */
+      kAVX512 = 4,
+      kCOUNT = 5
+    };
+  }
+
+  /**
+   * @brief
+   * What the CPU and the operating system support, read once with cpuid.
+   *
+   * @description
+   * The wide sets are only reported when the operating system saves their
+   * registers (xgetbv), a CPU with AVX-512 under an old kernel gives kAVX2.
+   *
+   * The tier in use starts as the best one supported and can be lowered for
+   * testing with the environment variable NF_CPU_TIER, set to scalar, sse2,
+   * sse4.1, avx2 or avx512. A tier above the supported one is clamped, so
+   * the variable never makes the engine run instructions the CPU lacks.
+   * With NF_CPU_DISPATCH 0 the tiers are also clamped to the NF_SIMD_*
+   * defines of the build.
+   */
+  class NF_UTILITIES_EXPORT CPUFeatures
+  {
+   public:
+    /**
+     * @brief
+     * Returns the best tier the CPU and the operating system support.
+     */
+    static CPU_TIER::E
+    getSupportedTier();
+
+    /**
+     * @brief
+     * Returns the tier the batch kernels use, the supported one or the one
+     * of NF_CPU_TIER.
+     */
+    static CPU_TIER::E
+    getTier();
+
+    /**
+     * @brief
+     * Returns the name of a tier, as NF_CPU_TIER takes it.
+     */
+    static const char*
+    getTierName(CPU_TIER::E _tier);
+
+    /**
+     * @brief
+     * Reads a tier from its name.
+     *
+     * @param _name
+     * The name, case insensitive.
+     * @param _tier
+     * Where the tier is written.
+     *
+     * @return
+     * False if the name is not a tier.
+     */
+    static bool
+    parseTier(const char* _name, CPU_TIER::E& _tier);
+
+    /**
+     * @brief
+     * Returns true if the time stamp counter ticks at the same rate on every
+     * power state and core.
+     */
+    static bool
+    hasInvariantTSC();
+
+    /**
+     * @brief
+     * Returns true if the CPU has the half float conversions (F16C).
+     */
+    static bool
+    hasF16C();
+
+    /*
+     * The environment variable that lowers the tier.
+     */
+    static const char* const kTIER_VARIABLE;
+  };
+}
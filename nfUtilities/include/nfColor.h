@@ -0,0 +1,566 @@
+/************************************************************************/
+/**
+ * @file nfColor.h
+ * @author Mara Castellanos
+ * @date 18/10/26
+ * @brief This file defines the Color in floats and the ColorI in bytes, the
+ *        sRGB conversions and the packed color formats.
+ *
+ * @bug Not bug Known.
+ */
+/************************************************************************/
+
+#pragma once
+
+#include "nfPrerequisitesUtilities.h"
+
+namespace nfEngineSDK {
+  /**
+   * @brief
+   * The packed 32 bits formats a Color can be written to.
+   */
+  namespace COLOR_FORMAT {
+    enum E {
+      /*
+       * 8 bits unsigned normalized per channel, red in the lowest byte.
+       */
+      kRGBA8 = 0,
+      /*
+       * 10 bits unsigned normalized for red, green and blue, 2 for alpha.
+       */
+      kRGB10A2,
+      /*
+       * 8 bits mantissas for red, green and blue with a shared 8 bits
+       * exponent, the Radiance HDR format. No alpha.
+       */
+      kRGBE,
+      /*
+       * Unsigned floats: 11 bits for red and green, 10 for blue. No alpha.
+       */
+      kR11G11B10,
+      kCOUNT
+    };
+  }
+
+  /**
+   * @brief
+   * A color made by floats, red, green, blue and alpha.
+   *
+   * @description
+   * The values are linear unless a function says otherwise, they can go over
+   * 1 for HDR. The sRGB conversions use the exact curve with the power done
+   * by FastMath, the decoding of 8 bits values uses a table.
+   */
+  class NF_UTILITIES_EXPORT Color
+  {
+   public:
+    /**
+     * @brief
+     * The default constructor.
+     */
+    Color() = default;
+    /**
+     * @brief
+     * Initializes the color with the values given.
+     *
+     * @param _r
+     * The red channel.
+     * @param _g
+     * The green channel.
+     * @param _b
+     * The blue channel.
+     * @param _a
+     * The alpha channel.
+     */
+    FORCEINLINE constexpr
+    Color(float _r, float _g, float _b, float _a = 1.0f)
+      : r(_r), g(_g), b(_b), a(_a) {}
+    /**
+     * @brief
+     * Frees the memory allocated on the color.
+     */
+    ~Color() = default;
+
+    /**
+     * @brief
+     * Component wise addition.
+     */
+    FORCEINLINE Color
+    operator+(const Color& _other) const
+    {
+      return Color(r + _other.r, g + _other.g, b + _other.b, a + _other.a);
+    }
+    /**
+     * @brief
+     * Component wise subtraction.
+     */
+    FORCEINLINE Color
+    operator-(const Color& _other) const
+    {
+      return Color(r - _other.r, g - _other.g, b - _other.b, a - _other.a);
+    }
+    /**
+     * @brief
+     * Component wise multiplication, to modulate a color by another.
+     */
+    FORCEINLINE Color
+    operator*(const Color& _other) const
+    {
+      return Color(r * _other.r, g * _other.g, b * _other.b, a * _other.a);
+    }
+    /**
+     * @brief
+     * Multiplies every channel, alpha included.
+     */
+    FORCEINLINE Color
+    operator*(float _scale) const
+    {
+      return Color(r * _scale, g * _scale, b * _scale, a * _scale);
+    }
+    FORCEINLINE Color&
+    operator+=(const Color& _other)
+    {
+      *this = *this + _other;
+      return *this;
+    }
+    FORCEINLINE Color&
+    operator*=(const Color& _other)
+    {
+      *this = *this * _other;
+      return *this;
+    }
+    FORCEINLINE Color&
+    operator*=(float _scale)
+    {
+      *this = *this * _scale;
+      return *this;
+    }
+    FORCEINLINE bool
+    operator==(const Color& _other) const
+    {
+      return r == _other.r && g == _other.g && b == _other.b && a == _other.a;
+    }
+    FORCEINLINE bool
+    operator!=(const Color& _other) const
+    {
+      return !(*this == _other);
+    }
+
+    /**
+     * @brief
+     * Interpolates linearly between two colors.
+     *
+     * @param _from
+     * The color at 0.
+     * @param _to
+     * The color at 1.
+     * @param _t
+     * The position between them.
+     *
+     * @return
+     * The interpolated color.
+     */
+    static FORCEINLINE Color
+    lerp(const Color& _from, const Color& _to, float _t)
+    {
+      return _from + (_to - _from) * _t;
+    }
+
+    /**
+     * @brief
+     * The color with red, green and blue multiplied by alpha.
+     */
+    FORCEINLINE Color
+    premultiplied() const
+    {
+      return Color(r * a, g * a, b * a, a);
+    }
+    /**
+     * @brief
+     * Undoes premultiplied, a transparent color gives 0 on every channel.
+     */
+    FORCEINLINE Color
+    unpremultiplied() const
+    {
+      float invA = a > 0.0f ? 1.0f / a : 0.0f;
+      return Color(r * invA, g * invA, b * invA, a);
+    }
+    /**
+     * @brief
+     * Draws a color over another, both premultiplied.
+     *
+     * @param _src
+     * The color on top.
+     * @param _dst
+     * The color below.
+     *
+     * @return
+     * The blended color, premultiplied.
+     */
+    static FORCEINLINE Color
+    blendOver(const Color& _src, const Color& _dst)
+    {
+      return _src + _dst * (1.0f - _src.a);
+    }
+
+    /**
+     * @brief
+     * Decodes a sRGB value in [0, 1] to linear.
+     *
+     * @description
+     * The value is clamped to [0, 1]. The error is below 1e-6.
+     */
+    static float
+    srgbToLinear(float _value);
+    /**
+     * @brief
+     * Encodes a linear value to sRGB.
+     *
+     * @description
+     * The value is clamped to [0, 1], NaN gives 0. The error is below 1e-6.
+     */
+    static float
+    linearToSrgb(float _value);
+    /**
+     * @brief
+     * This color, taken as sRGB, in linear. Alpha is kept.
+     */
+    FORCEINLINE Color
+    toLinear() const
+    {
+      return Color(srgbToLinear(r), srgbToLinear(g), srgbToLinear(b), a);
+    }
+    /**
+     * @brief
+     * This color, taken as linear, in sRGB. Alpha is kept.
+     */
+    FORCEINLINE Color
+    toSrgb() const
+    {
+      return Color(linearToSrgb(r), linearToSrgb(g), linearToSrgb(b), a);
+    }
+
+    /**
+     * @brief
+     * Packs the color in 32 bits.
+     *
+     * @description
+     * The channels are written as they are, convert them to sRGB before if
+     * the target expects it. The normalized formats clamp to [0, 1] and the
+     * float ones clamp the negatives to 0 and the big values to the biggest
+     * they can hold.
+     *
+     * @param _format
+     * The format to pack in.
+     *
+     * @return
+     * The packed color.
+     */
+    uint32
+    pack(COLOR_FORMAT::E _format) const;
+    /**
+     * @brief
+     * Unpacks a color packed with pack.
+     *
+     * @param _packed
+     * The packed color.
+     * @param _format
+     * The format it was packed in. The formats without alpha give 1.
+     *
+     * @return
+     * The color.
+     */
+    static Color
+    unpack(uint32 _packed, COLOR_FORMAT::E _format);
+
+    /**
+     * @brief
+     * srgbToLinear of every element of an array.
+     *
+     * @param _in
+     * The sRGB values.
+     * @param _out
+     * Where the linear values are written, can be the same as _in.
+     * @param _count
+     * The number of values.
+     */
+    static void
+    srgbToLinear(const float* _in, float* _out, SIZE_T _count);
+    /**
+     * @brief
+     * linearToSrgb of every element of an array.
+     *
+     * @param _in
+     * The linear values.
+     * @param _out
+     * Where the sRGB values are written, can be the same as _in.
+     * @param _count
+     * The number of values.
+     */
+    static void
+    linearToSrgb(const float* _in, float* _out, SIZE_T _count);
+    /**
+     * @brief
+     * Decodes 8 bits sRGB colors to linear, alpha is only normalized.
+     *
+     * @param _in
+     * The sRGB colors.
+     * @param _out
+     * Where the linear colors are written.
+     * @param _count
+     * The number of colors.
+     */
+    static void
+    srgbToLinear(const ColorI* _in, Color* _out, SIZE_T _count);
+    /**
+     * @brief
+     * Encodes linear colors to 8 bits sRGB, alpha is only quantized.
+     *
+     * @param _in
+     * The linear colors.
+     * @param _out
+     * Where the sRGB colors are written.
+     * @param _count
+     * The number of colors.
+     */
+    static void
+    linearToSrgb(const Color* _in, ColorI* _out, SIZE_T _count);
+    /**
+     * @brief
+     * Multiplies the red, green and blue of every color by its alpha.
+     *
+     * @param _colors
+     * The colors, modified in place.
+     * @param _count
+     * The number of colors.
+     */
+    static void
+    premultiply(Color* _colors, SIZE_T _count);
+    /**
+     * @brief
+     * Packs every color of an array.
+     *
+     * @param _in
+     * The colors.
+     * @param _out
+     * Where the packed colors are written.
+     * @param _count
+     * The number of colors.
+     * @param _format
+     * The format to pack in.
+     */
+    static void
+    pack(const Color* _in, uint32* _out, SIZE_T _count, COLOR_FORMAT::E _format);
+    /**
+     * @brief
+     * Unpacks every color of an array.
+     *
+     * @param _in
+     * The packed colors.
+     * @param _out
+     * Where the colors are written.
+     * @param _count
+     * The number of colors.
+     * @param _format
+     * The format they were packed in.
+     */
+    static void
+    unpack(const uint32* _in, Color* _out, SIZE_T _count, COLOR_FORMAT::E _format);
+
+    /*
+     * The red channel.
+     */
+    float r;
+    /*
+     * The green channel.
+     */
+    float g;
+    /*
+     * The blue channel.
+     */
+    float b;
+    /*
+     * The alpha channel.
+     */
+    float a;
+
+    /*
+     * Opaque black, opaque white and transparent black.
+     */
+    static const Color kBLACK;
+    static const Color kWHITE;
+    static const Color kTRANSPARENT;
+  };
+
+  /**
+   * @brief
+   * A color made by bytes, red, green, blue and alpha.
+   *
+   * @description
+   * The layout is the one of kRGBA8, an array of them can be uploaded as a
+   * texture directly. The values are usually sRGB.
+   */
+  class NF_UTILITIES_EXPORT ColorI
+  {
+   public:
+    /**
+     * @brief
+     * The default constructor.
+     */
+    ColorI() = default;
+    /**
+     * @brief
+     * Initializes the color with the values given.
+     *
+     * @param _r
+     * The red channel.
+     * @param _g
+     * The green channel.
+     * @param _b
+     * The blue channel.
+     * @param _a
+     * The alpha channel.
+     */
+    FORCEINLINE constexpr
+    ColorI(uint8 _r, uint8 _g, uint8 _b, uint8 _a = 255)
+      : r(_r), g(_g), b(_b), a(_a) {}
+    /**
+     * @brief
+     * Frees the memory allocated on the color.
+     */
+    ~ColorI() = default;
+
+    FORCEINLINE bool
+    operator==(const ColorI& _other) const
+    {
+      return r == _other.r && g == _other.g && b == _other.b && a == _other.a;
+    }
+    FORCEINLINE bool
+    operator!=(const ColorI& _other) const
+    {
+      return !(*this == _other);
+    }
+
+    /**
+     * @brief
+     * The color as kRGBA8, red in the lowest byte.
+     */
+    FORCEINLINE uint32
+    toRGBA8() const
+    {
+      return static_cast<uint32>(r) | (static_cast<uint32>(g) << 8) |
+             (static_cast<uint32>(b) << 16) | (static_cast<uint32>(a) << 24);
+    }
+    /**
+     * @brief
+     * The color from a kRGBA8 value.
+     */
+    static FORCEINLINE ColorI
+    fromRGBA8(uint32 _packed)
+    {
+      return ColorI(static_cast<uint8>(_packed),
+                    static_cast<uint8>(_packed >> 8),
+                    static_cast<uint8>(_packed >> 16),
+                    static_cast<uint8>(_packed >> 24));
+    }
+
+    /**
+     * @brief
+     * The color with red, green and blue multiplied by alpha, rounded to
+     * nearest.
+     */
+    FORCEINLINE ColorI
+    premultiplied() const
+    {
+      return ColorI(multiply(r, a), multiply(g, a), multiply(b, a), a);
+    }
+    /**
+     * @brief
+     * Draws a color over another, both premultiplied.
+     *
+     * @param _src
+     * The color on top.
+     * @param _dst
+     * The color below.
+     *
+     * @return
+     * The blended color, premultiplied.
+     */
+    static FORCEINLINE ColorI
+    blendOver(const ColorI& _src, const ColorI& _dst)
+    {
+      uint8 invA = static_cast<uint8>(255 - _src.a);
+      return ColorI(static_cast<uint8>(_src.r + multiply(_dst.r, invA)),
+                    static_cast<uint8>(_src.g + multiply(_dst.g, invA)),
+                    static_cast<uint8>(_src.b + multiply(_dst.b, invA)),
+                    static_cast<uint8>(_src.a + multiply(_dst.a, invA)));
+    }
+
+    /**
+     * @brief
+     * The channels divided by 255, without any curve.
+     */
+    FORCEINLINE Color
+    toColor() const
+    {
+      const float kINV_255 = 1.0f / 255.0f;
+      return Color(r * kINV_255, g * kINV_255, b * kINV_255, a * kINV_255);
+    }
+    /**
+     * @brief
+     * The color quantized to bytes without any curve, clamped to [0, 1].
+     */
+    static FORCEINLINE ColorI
+    fromColor(const Color& _color)
+    {
+      return fromRGBA8(_color.pack(COLOR_FORMAT::kRGBA8));
+    }
+    /**
+     * @brief
+     * This color, taken as sRGB, in linear. Alpha is only normalized.
+     */
+    Color
+    toLinear() const;
+    /**
+     * @brief
+     * A linear color encoded to sRGB. Alpha is only quantized.
+     */
+    static ColorI
+    fromLinear(const Color& _color);
+
+    /*
+     * The red channel.
+     */
+    uint8 r;
+    /*
+     * The green channel.
+     */
+    uint8 g;
+    /*
+     * The blue channel.
+     */
+    uint8 b;
+    /*
+     * The alpha channel.
+     */
+    uint8 a;
+
+    /*
+     * Opaque black, opaque white and transparent black.
+     */
+    static const ColorI kBLACK;
+    static const ColorI kWHITE;
+    static const ColorI kTRANSPARENT;
+
+   private:
+    /*
+     * _x * _y / 255 rounded to nearest, exact for every pair of bytes.
+     */
+    static FORCEINLINE uint8
+    multiply(uint32 _x, uint32 _y)
+    {
+      uint32 t = _x * _y + 128u;
+      return static_cast<uint8>((t + (t >> 8)) >> 8);
+    }
+  };
+}
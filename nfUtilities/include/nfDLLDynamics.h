@@ -0,0 +1,301 @@
+/************************************************************************/
+/**
+ * @file nfDLLDynamics.h
+ * @author Mara Castellanos
+ * @date 18/10/26
+ * @brief Loads the plugins (dynamic libraries), caches their symbols and
+ *        reloads them while the engine runs.
+ *
+ * @bug Not bug Known.
+ */
+/************************************************************************/
+
+#pragma once
+
+#include "nfPrerequisitesUtilities.h"
+#include "nfFlatHashMap.h"
+#include "nfSerializer.h"
+
+namespace nfEngineSDK {
+  /**
+   * @brief
+   * A plugin, a dll on Windows and a shared object on the rest.
+   *
+   * @description
+   * The plugin is loaded on the first symbol asked, not when the path is
+   * given, so the engine only pays for the plugins it uses. The symbols are
+   * resolved once and kept on a flat table: getSlot() returns an index that
+   * stays valid across reloads, and getSymbol() is only an array access.
+   *
+   * reload() loads the new build of the plugin without restarting. The
+   * library is loaded from a copy so the original can be rebuilt while it
+   * is in use. If the plugin exports the hooks
+   *
+   *   extern "C" NF_PLUGIN_EXPORT void nfPluginSaveState(Serializer&);
+   *   extern "C" NF_PLUGIN_EXPORT void nfPluginLoadState(Deserializer&);
+   *
+   * the state of the old build is saved before it is unloaded and given to
+   * the new one. If the new build can't be loaded the old one is loaded
+   * back with its state.
+   */
+  class NF_UTILITIES_EXPORT DLLDynamics
+  {
+   public:
+    /*
+     * The hooks to keep the state of the plugin on a reload.
+     */
+    using SaveStateFunction = void(*)(Serializer&);
+    using LoadStateFunction = void(*)(Deserializer&);
+
+    /**
+     * @brief
+     * The default constructor, no plugin.
+     */
+    DLLDynamics() = default;
+    /**
+     * @brief
+     * Sets the plugin without loading it.
+     *
+     * @param _path
+     * The path of the library.
+     * @param _shadowCopy
+     * True to load a copy of the library, so it can be rebuilt and
+     * reloaded.
+     */
+    explicit
+    DLLDynamics(const String& _path, bool _shadowCopy = true);
+    DLLDynamics(const DLLDynamics&) = delete;
+    /**
+     * @brief
+     * Unloads the plugin.
+     */
+    ~DLLDynamics();
+
+    DLLDynamics&
+    operator=(const DLLDynamics&) = delete;
+
+    /**
+     * @brief
+     * Sets the plugin without loading it, unloading the last one.
+     *
+     * @param _path
+     * The path of the library.
+     * @param _shadowCopy
+     * True to load a copy of the library, so it can be rebuilt and
+     * reloaded.
+     */
+    void
+    setPath(const String& _path, bool _shadowCopy = true);
+
+    /**
+     * @brief
+     * Loads the plugin now if it is not loaded.
+     *
+     * @return
+     * False if it couldn't be loaded, see getLastError().
+     */
+    bool
+    load();
+
+    /**
+     * @brief
+     * Unloads the plugin, the slots stay and are resolved again on the next
+     * load.
+     */
+    void
+    unload();
+
+    /**
+     * @brief
+     * Returns true if the plugin is loaded.
+     */
+    FORCEINLINE bool
+    isLoaded() const
+    {
+      return nullptr != m_handle;
+    }
+
+    /**
+     * @brief
+     * Returns the path of the library.
+     */
+    FORCEINLINE const String&
+    getPath() const
+    {
+      return m_path;
+    }
+
+    /**
+     * @brief
+     * Returns why the last load or symbol failed.
+     */
+    FORCEINLINE const String&
+    getLastError() const
+    {
+      return m_error;
+    }
+
+    /**
+     * @brief
+     * Returns the slot of a symbol on the table, loading the plugin if it
+     * is not loaded.
+     *
+     * @param _name
+     * The name of the exported symbol.
+     *
+     * @return
+     * The slot, it keeps its index across reloads.
+     */
+    uint32
+    getSlot(const String& _name);
+
+    /**
+     * @brief
+     * Returns the address of the symbol on a slot.
+     *
+     * @param _slot
+     * The slot from getSlot().
+     *
+     * @return
+     * The address, null if the plugin doesn't export it.
+     */
+    FORCEINLINE void*
+    getSymbol(uint32 _slot) const
+    {
+      return m_symbols[_slot];
+    }
+    /**
+     * @brief
+     * Returns the function on a slot.
+     */
+    template<class Function>
+    FORCEINLINE Function
+    getFunction(uint32 _slot) const
+    {
+      return reinterpret_cast<Function>(m_symbols[_slot]);
+    }
+
+    /**
+     * @brief
+     * Returns the address of a symbol, loading the plugin if it is not
+     * loaded.
+     *
+     * @param _name
+     * The name of the exported symbol.
+     *
+     * @return
+     * The address, null if the plugin doesn't export it.
+     */
+    FORCEINLINE void*
+    getSymbol(const String& _name)
+    {
+      return getSymbol(getSlot(_name));
+    }
+    /**
+     * @brief
+     * Returns a function, loading the plugin if it is not loaded.
+     */
+    template<class Function>
+    FORCEINLINE Function
+    getFunction(const String& _name)
+    {
+      return reinterpret_cast<Function>(getSymbol(_name));
+    }
+
+    /**
+     * @brief
+     * Returns true if the library changed on the disk since it was loaded.
+     */
+    bool
+    hasChanged() const;
+
+    /**
+     * @brief
+     * Loads the library again, keeping the state of the plugin through its
+     * hooks.
+     *
+     * @return
+     * False if the new library couldn't be loaded, the old one is loaded
+     * back then and hasChanged() is false until the library is written
+     * again.
+     */
+    bool
+    reload();
+
+    /**
+     * @brief
+     * Reloads the plugin if it is loaded and the library changed.
+     *
+     * @return
+     * True if it was reloaded.
+     */
+    bool
+    reloadIfChanged();
+
+    /*
+     * The names of the hooks exported by the plugins.
+     */
+    static const char* const kSAVE_STATE_SYMBOL;
+    static const char* const kLOAD_STATE_SYMBOL;
+
+   private:
+    /*
+     * Loads _file and resolves all the slots.
+     */
+    bool
+    loadLibrary(const String& _file);
+
+    /*
+     * Frees the library and deletes its copy.
+     */
+    void
+    freeLibrary();
+
+    /*
+     * Finds a symbol on the loaded library.
+     */
+    void*
+    findSymbol(const String& _name) const;
+
+    /*
+     * The path of the library.
+     */
+    String m_path;
+    /*
+     * The copy of the library that is loaded, empty if there is none.
+     */
+    String m_shadowPath;
+    /*
+     * The native handle of the library.
+     */
+    void* m_handle = nullptr;
+    /*
+     * The symbols, by slot.
+     */
+    Vector<void*> m_symbols;
+    /*
+     * The name of every slot.
+     */
+    Vector<String> m_names;
+    /*
+     * The slot of every name.
+     */
+    FlatHashMap<String, uint32> m_slots;
+    /*
+     * When the library was written, to see if it changed.
+     */
+    int64 m_writeTime = 0;
+    /*
+     * The number of copies made, for their names.
+     */
+    uint32 m_copies = 0;
+    /*
+     * True to load a copy of the library.
+     */
+    bool m_shadowCopy = true;
+    /*
+     * Why the last operation failed.
+     */
+    String m_error;
+  };
+}
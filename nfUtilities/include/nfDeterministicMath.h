@@ -0,0 +1,171 @@
+/************************************************************************/
+/**
+ * @file nfDeterministicMath.h
+ * @author Mara Castellanos
+ * @date 18/10/26
+ * @brief Transcendental functions with a fixed algorithm, that give the same
+ *        bits on every compiler, standard library and CPU.
+ *
+ * @bug Not bug Known.
+ */
+/************************************************************************/
+
+#pragma once
+
+#include <type_traits>
+
+#include "nfPrerequisitesUtilities.h"
+
+namespace nfEngineSDK {
+  /**
+   * @brief
+   * The type DeterministicMath computes a T with: float stays float,
+   * everything else goes through double.
+   */
+  template<typename T>
+  using DeterministicReal = typename std::conditional<std::is_same<T, float>::value,
+                                                      float,
+                                                      double>::type;
+
+  /**
+   * @brief
+   * Transcendental functions with a fixed algorithm.
+   *
+   * @description
+   * The standard library is free to implement sin, exp or pow however it
+   * wants, so the last bits change between MSVC, glibc and libc++, and even
+   * between CPU tiers of the same library. These are the fdlibm algorithms
+   * (Cody-Waite range reduction and minimax polynomials), written only with
+   * additions, multiplications, divisions and square roots, that IEEE 754
+   * rounds exactly, plus floor, frexp and ldexp, that are exact. The float
+   * versions are computed in double and rounded once, so they are within half
+   * an ulp of the float result almost always.
+   *
+   * It only stays deterministic if the compiler doesn't fuse operations, that
+   * is why NF_MATH_DETERMINISTIC also turns off the FMA contraction.
+   */
+  class NF_UTILITIES_EXPORT DeterministicMath
+  {
+   public:
+    /**
+     * @brief
+     * The square root. IEEE 754 requires it correctly rounded, so the
+     * hardware instruction is already deterministic.
+     */
+    static FORCEINLINE double
+    sqrt(double _val) { return std::sqrt(_val); }
+    static FORCEINLINE float
+    sqrt(float _val) { return std::sqrt(_val); }
+
+    /**
+     * @brief
+     * The sine function, for radians.
+     *
+     * @description
+     * The angles up to 1e6 radians are reduced with Cody-Waite, the bigger
+     * ones with Payne-Hanek on integers, so every finite angle keeps the
+     * accuracy of the small ones.
+     */
+    static double
+    sin(double _radian);
+    static float
+    sin(float _radian);
+    /**
+     * @brief
+     * The cosine function, for radians.
+     */
+    static double
+    cos(double _radian);
+    static float
+    cos(float _radian);
+    /**
+     * @brief
+     * The tangent function, for radians.
+     */
+    static double
+    tan(double _radian);
+    static float
+    tan(float _radian);
+
+    /**
+     * @brief
+     * The inverse tangent, in radians between -pi/2 and pi/2.
+     */
+    static double
+    atan(double _value);
+    static float
+    atan(float _value);
+    /**
+     * @brief
+     * The angle of the point (X, Y), in radians between -pi and pi.
+     */
+    static double
+    atan2(double Y, double X);
+    static float
+    atan2(float Y, float X);
+    /**
+     * @brief
+     * The inverse sine, in radians between -pi/2 and pi/2.
+     */
+    static double
+    asin(double _value);
+    static float
+    asin(float _value);
+    /**
+     * @brief
+     * The inverse cosine, in radians between 0 and pi.
+     */
+    static double
+    acos(double _value);
+    static float
+    acos(float _value);
+
+    /**
+     * @brief
+     * e raised to the value.
+     */
+    static double
+    exp(double _value);
+    static float
+    exp(float _value);
+    /**
+     * @brief
+     * 2 raised to the value, exact for integers.
+     */
+    static double
+    exp2(double _value);
+    static float
+    exp2(float _value);
+    /**
+     * @brief
+     * The natural logarithm.
+     */
+    static double
+    log(double _value);
+    static float
+    log(float _value);
+    /**
+     * @brief
+     * The logarithm in base 2, exact for powers of 2.
+     */
+    static double
+    log2(double _value);
+    static float
+    log2(float _value);
+    /**
+     * @brief
+     * The base raised to the power.
+     *
+     * @description
+     * The special cases (zeros, infinities, NaN, negative bases) are the
+     * ones of C99 Annex F. pow(x, 2) is x * x, the rest go through
+     * exp(power * log(base)) with the logarithm and the product in two
+     * parts: within about 2 ulp on double, so the float version is almost
+     * always correctly rounded.
+     */
+    static double
+    pow(double _base, double _power);
+    static float
+    pow(float _base, float _power);
+  };
+}
@@ -0,0 +1,216 @@
+/************************************************************************/
+/**
+ * @file nfFastMath.h
+ * @author Mara Castellanos
+ * @date 18/10/26
+ * @brief Fast approximations of the exponential and logarithmic functions,
+ *        for values and for whole arrays.
+ *
+ * @bug Not bug Known.
+ */
+/************************************************************************/
+
+#pragma once
+
+#include <cstring>
+
+#include "nfPrerequisitesUtilities.h"
+
+#if NF_SIMD_SSE2
+# include <emmintrin.h>
+#endif
+
+namespace nfEngineSDK {
+  /**
+   * @brief
+   * Fast approximations of exp2, log2, exp, log and pow for floats.
+   *
+   * @description
+   * For tone mapping, falloff curves and the like, that evaluate these
+   * millions of times and don't need the last bits. exp2 and log2 are a
+   * polynomial over the mantissa plus the exponent put or taken directly from
+   * the bits, the rest are built over them. The array versions run the same
+   * algorithm with the widest SIMD enabled for the build.
+   *
+   * Error bounds, measured over the whole range:
+   * - exp2: relative error below 1.2e-7 (2 ulp).
+   * - log2 and log: absolute error below 1.1e-7 for results between -1 and
+   *   1, 2 ulp for the rest.
+   * - exp and pow: the exp2 error plus the rounding of the argument, below
+   *   2e-6 relative for results between 1e-10 and 1e10.
+   *
+   * The inputs of the logarithms must be positive normal floats, the
+   * exponentials saturate outside of [-126, 127] (in base 2) instead of
+   * giving 0 or infinity. NaNs are not handled.
+   */
+  class NF_UTILITIES_EXPORT FastMath
+  {
+   public:
+    /**
+     * @brief
+     * 2 raised to the value.
+     */
+    static FORCEINLINE float
+    exp2(float _value)
+    {
+      float x = _value < kEXP2_MIN ? kEXP2_MIN : _value;
+      x = x > kEXP2_MAX ? kEXP2_MAX : x;
+      int32 i = roundToInt(x);
+      float f = x - static_cast<float>(i);
+      float p = ((((kEXP2_P0 * f + kEXP2_P1) * f + kEXP2_P2) * f + kEXP2_P3) *
+                 f + kEXP2_P4) * f + kEXP2_P5;
+      return (1.0f + f * p) * fromBits(static_cast<uint32>(i + 127) << 23);
+    }
+    /**
+     * @brief
+     * The logarithm in base 2.
+     */
+    static FORCEINLINE float
+    log2(float _value)
+    {
+      /*
+       * value = 2^e * m, with m between sqrt(2)/2 and sqrt(2), so
+       * t = (m - 1) / (m + 1) stays small and log2(m) = 2 atanh(t) / ln(2).
+       */
+      uint32 bits = toBits(_value);
+      int32 e = static_cast<int32>(bits - kSQRT_HALF_BITS) >> 23;
+      float m = fromBits(bits - (static_cast<uint32>(e) << 23));
+      float t = (m - 1.0f) / (m + 1.0f);
+      float t2 = t * t;
+      float p = t * (kLOG2_C1 + t2 * (kLOG2_C3 + t2 * (kLOG2_C5 + t2 *
+                    (kLOG2_C7 + t2 * kLOG2_C9))));
+      return static_cast<float>(e) + p;
+    }
+    /**
+     * @brief
+     * e raised to the value.
+     */
+    static FORCEINLINE float
+    exp(float _value)
+    {
+      return exp2(_value * kLOG2_E);
+    }
+    /**
+     * @brief
+     * The natural logarithm.
+     */
+    static FORCEINLINE float
+    log(float _value)
+    {
+      return log2(_value) * kLN_2;
+    }
+    /**
+     * @brief
+     * The base raised to the power, the base must be positive.
+     */
+    static FORCEINLINE float
+    pow(float _base, float _power)
+    {
+      return exp2(_power * log2(_base));
+    }
+
+    /**
+     * @brief
+     * exp2 of every element of an array.
+     *
+     * @param _in
+     * The values.
+     * @param _out
+     * Where the results are written, can be the same as _in.
+     * @param _count
+     * The number of values.
+     */
+    static void
+    exp2(const float* _in, float* _out, SIZE_T _count);
+    /**
+     * @brief
+     * log2 of every element of an array.
+     */
+    static void
+    log2(const float* _in, float* _out, SIZE_T _count);
+    /**
+     * @brief
+     * exp of every element of an array.
+     */
+    static void
+    exp(const float* _in, float* _out, SIZE_T _count);
+    /**
+     * @brief
+     * log of every element of an array.
+     */
+    static void
+    log(const float* _in, float* _out, SIZE_T _count);
+    /**
+     * @brief
+     * Every element of an array raised to the same power.
+     *
+     * @param _bases
+     * The bases, must be positive.
+     * @param _power
+     * The power for all of them.
+     * @param _out
+     * Where the results are written, can be the same as _bases.
+     * @param _count
+     * The number of values.
+     */
+    static void
+    pow(const float* _bases, float _power, float* _out, SIZE_T _count);
+
+    /*
+     * The range where exp2 doesn't saturate.
+     */
+    static constexpr float kEXP2_MIN = -126.0f;
+    static constexpr float kEXP2_MAX = 127.0f;
+    /*
+     * Polynomial for 2^f - 1 = f * P(f), f in [-0.5, 0.5].
+     */
+    static constexpr float kEXP2_P0 = 1.535336188319500e-4f;
+    static constexpr float kEXP2_P1 = 1.339887440266574e-3f;
+    static constexpr float kEXP2_P2 = 9.618437357674640e-3f;
+    static constexpr float kEXP2_P3 = 5.550332471162809e-2f;
+    static constexpr float kEXP2_P4 = 2.402264791363012e-1f;
+    static constexpr float kEXP2_P5 = 6.931472028550421e-1f;
+    /*
+     * Series of 2 atanh(t) / ln(2).
+     */
+    static constexpr float kLOG2_C1 = 2.885390081777927f;
+    static constexpr float kLOG2_C3 = 0.961796693925976f;
+    static constexpr float kLOG2_C5 = 0.577078016355585f;
+    static constexpr float kLOG2_C7 = 0.412198583111132f;
+    static constexpr float kLOG2_C9 = 0.320598897975325f;
+    /*
+     * The bits of sqrt(2)/2, where the mantissa range of log2 starts.
+     */
+    static constexpr uint32 kSQRT_HALF_BITS = 0x3F3504F3u;
+    /*
+     * log2(e) and ln(2).
+     */
+    static constexpr float kLOG2_E = 1.442695040888963f;
+    static constexpr float kLN_2 = 0.693147180559945f;
+
+   private:
+    static FORCEINLINE int32
+    roundToInt(float _value)
+    {
+#if NF_SIMD_SSE2
+      return _mm_cvtss_si32(_mm_set_ss(_value));
+#else
+      return static_cast<int32>(std::lrint(_value));
+#endif
+    }
+    static FORCEINLINE uint32
+    toBits(float _value)
+    {
+      uint32 bits;
+      std::memcpy(&bits, &_value, sizeof(bits));
+      return bits;
+    }
+    static FORCEINLINE float
+    fromBits(uint32 _bits)
+    {
+      float value;
+      std::memcpy(&value, &_bits, sizeof(value));
+      return value;
+    }
+  };
+}
@@ -0,0 +1,144 @@
+/************************************************************************/
+/**
+ * @file nfFastMathPack.h
+ * @author Mara Castellanos
+ * @date 18/10/26
+ * @brief The register type of the FastMath array versions and exp2 and log2
+ *        over it, for the files that fuse them with more work.
+ *
+ * @bug Not bug Known.
+ */
+/************************************************************************/
+
+#pragma once
+
+#include "nfFastMath.h"
+
+#if NF_SIMD_AVX2
+# include <immintrin.h>
+#endif
+
+/*
+ * Internal to the module, only for .cpp files. Everything is on an unnamed
+ * namespace and NF_FASTMATH_SIMD tells if FloatPack exists for the build.
+ */
+namespace nfEngineSDK {
+  namespace {
+#if NF_SIMD_AVX2
+    /*
+     * Eight floats on AVX2.
+     */
+    struct FloatPack
+    {
+      using Reg = __m256;
+      using IntReg = __m256i;
+      static const SIZE_T kLANES = 8;
+
+      static FORCEINLINE Reg load(const float* p) { return _mm256_loadu_ps(p); }
+      static FORCEINLINE void store(float* p, Reg v) { _mm256_storeu_ps(p, v); }
+      static FORCEINLINE Reg set(float v) { return _mm256_set1_ps(v); }
+      static FORCEINLINE Reg add(Reg a, Reg b) { return _mm256_add_ps(a, b); }
+      static FORCEINLINE Reg sub(Reg a, Reg b) { return _mm256_sub_ps(a, b); }
+      static FORCEINLINE Reg mul(Reg a, Reg b) { return _mm256_mul_ps(a, b); }
+      static FORCEINLINE Reg div(Reg a, Reg b) { return _mm256_div_ps(a, b); }
+      static FORCEINLINE Reg min(Reg a, Reg b) { return _mm256_min_ps(a, b); }
+      static FORCEINLINE Reg max(Reg a, Reg b) { return _mm256_max_ps(a, b); }
+      static FORCEINLINE IntReg roundToInt(Reg a) { return _mm256_cvtps_epi32(a); }
+      static FORCEINLINE Reg toFloat(IntReg a) { return _mm256_cvtepi32_ps(a); }
+      static FORCEINLINE IntReg toBits(Reg a) { return _mm256_castps_si256(a); }
+      static FORCEINLINE Reg fromBits(IntReg a) { return _mm256_castsi256_ps(a); }
+      static FORCEINLINE IntReg setInt(int32 v) { return _mm256_set1_epi32(v); }
+      static FORCEINLINE IntReg addInt(IntReg a, IntReg b) { return _mm256_add_epi32(a, b); }
+      static FORCEINLINE IntReg subInt(IntReg a, IntReg b) { return _mm256_sub_epi32(a, b); }
+      static FORCEINLINE IntReg shiftLeft23(IntReg a) { return _mm256_slli_epi32(a, 23); }
+      static FORCEINLINE IntReg shiftRight23(IntReg a) { return _mm256_srai_epi32(a, 23); }
+      static FORCEINLINE Reg lessEqual(Reg a, Reg b) { return _mm256_cmp_ps(a, b, _CMP_LE_OQ); }
+      static FORCEINLINE Reg select(Reg m, Reg a, Reg b) { return _mm256_blendv_ps(b, a, m); }
+    };
+# define NF_FASTMATH_SIMD 1
+#elif NF_SIMD_SSE2
+    /*
+     * Four floats on SSE2.
+     */
+    struct FloatPack
+    {
+      using Reg = __m128;
+      using IntReg = __m128i;
+      static const SIZE_T kLANES = 4;
+
+      static FORCEINLINE Reg load(const float* p) { return _mm_loadu_ps(p); }
+      static FORCEINLINE void store(float* p, Reg v) { _mm_storeu_ps(p, v); }
+      static FORCEINLINE Reg set(float v) { return _mm_set1_ps(v); }
+      static FORCEINLINE Reg add(Reg a, Reg b) { return _mm_add_ps(a, b); }
+      static FORCEINLINE Reg sub(Reg a, Reg b) { return _mm_sub_ps(a, b); }
+      static FORCEINLINE Reg mul(Reg a, Reg b) { return _mm_mul_ps(a, b); }
+      static FORCEINLINE Reg div(Reg a, Reg b) { return _mm_div_ps(a, b); }
+      static FORCEINLINE Reg min(Reg a, Reg b) { return _mm_min_ps(a, b); }
+      static FORCEINLINE Reg max(Reg a, Reg b) { return _mm_max_ps(a, b); }
+      static FORCEINLINE IntReg roundToInt(Reg a) { return _mm_cvtps_epi32(a); }
+      static FORCEINLINE Reg toFloat(IntReg a) { return _mm_cvtepi32_ps(a); }
+      static FORCEINLINE IntReg toBits(Reg a) { return _mm_castps_si128(a); }
+      static FORCEINLINE Reg fromBits(IntReg a) { return _mm_castsi128_ps(a); }
+      static FORCEINLINE IntReg setInt(int32 v) { return _mm_set1_epi32(v); }
+      static FORCEINLINE IntReg addInt(IntReg a, IntReg b) { return _mm_add_epi32(a, b); }
+      static FORCEINLINE IntReg subInt(IntReg a, IntReg b) { return _mm_sub_epi32(a, b); }
+      static FORCEINLINE IntReg shiftLeft23(IntReg a) { return _mm_slli_epi32(a, 23); }
+      static FORCEINLINE IntReg shiftRight23(IntReg a) { return _mm_srai_epi32(a, 23); }
+      static FORCEINLINE Reg lessEqual(Reg a, Reg b) { return _mm_cmple_ps(a, b); }
+      static FORCEINLINE Reg
+      select(Reg m, Reg a, Reg b)
+      {
+        return _mm_or_ps(_mm_and_ps(m, a), _mm_andnot_ps(m, b));
+      }
+    };
+# define NF_FASTMATH_SIMD 1
+#else
+# define NF_FASTMATH_SIMD 0
+#endif
+
+#if NF_FASTMATH_SIMD
+    using P = FloatPack;
+
+    /*
+     * The same steps as FastMath::exp2, lane by lane.
+     */
+    FORCEINLINE P::Reg
+    exp2Pack(P::Reg v)
+    {
+      P::Reg x = P::min(P::max(v, P::set(FastMath::kEXP2_MIN)),
+                        P::set(FastMath::kEXP2_MAX));
+      P::IntReg i = P::roundToInt(x);
+      P::Reg f = P::sub(x, P::toFloat(i));
+      P::Reg p = P::add(P::mul(P::set(FastMath::kEXP2_P0), f),
+                        P::set(FastMath::kEXP2_P1));
+      p = P::add(P::mul(p, f), P::set(FastMath::kEXP2_P2));
+      p = P::add(P::mul(p, f), P::set(FastMath::kEXP2_P3));
+      p = P::add(P::mul(p, f), P::set(FastMath::kEXP2_P4));
+      p = P::add(P::mul(p, f), P::set(FastMath::kEXP2_P5));
+      P::Reg scale = P::fromBits(P::shiftLeft23(P::addInt(i, P::setInt(127))));
+      return P::mul(P::add(P::set(1.0f), P::mul(f, p)), scale);
+    }
+
+    /*
+     * The same steps as FastMath::log2, lane by lane.
+     */
+    FORCEINLINE P::Reg
+    log2Pack(P::Reg v)
+    {
+      P::IntReg bits = P::toBits(v);
+      P::IntReg e = P::shiftRight23(
+        P::subInt(bits, P::setInt(static_cast<int32>(FastMath::kSQRT_HALF_BITS))));
+      P::Reg m = P::fromBits(P::subInt(bits, P::shiftLeft23(e)));
+      P::Reg one = P::set(1.0f);
+      P::Reg t = P::div(P::sub(m, one), P::add(m, one));
+      P::Reg t2 = P::mul(t, t);
+      P::Reg p = P::add(P::set(FastMath::kLOG2_C7),
+                        P::mul(t2, P::set(FastMath::kLOG2_C9)));
+      p = P::add(P::set(FastMath::kLOG2_C5), P::mul(t2, p));
+      p = P::add(P::set(FastMath::kLOG2_C3), P::mul(t2, p));
+      p = P::add(P::set(FastMath::kLOG2_C1), P::mul(t2, p));
+      return P::add(P::toFloat(e), P::mul(t, p));
+    }
+#endif
+  }
+}
@@ -0,0 +1,469 @@
+/************************************************************************/
+/**
+ * @file nfFile.h
+ * @author Mara Castellanos
+ * @date 18/10/26
+ * @brief Read only files, memory mapped when possible, with views to their
+ *        bytes that don't copy them.
+ *
+ * @bug Not bug Known.
+ */
+/************************************************************************/
+
+#pragma once
+
+#include "nfPrerequisitesUtilities.h"
+
+namespace nfEngineSDK {
+  /**
+   * @brief
+   * How the bytes of a file are going to be read, so the system can read
+   * ahead or stop doing it.
+   */
+  namespace FILE_ACCESS_HINT {
+    enum E
+    {
+      /*
+       * No hint, the system default.
+       */
+      kNORMAL = 0,
+      /*
+       * From the start to the end, the system reads ahead aggressively and
+       * drops the pages already read sooner.
+       */
+      kSEQUENTIAL,
+      /*
+       * Jumping around, the system stops reading ahead.
+       */
+      kRANDOM,
+      /*
+       * The bytes will be needed soon, the system starts loading them now.
+       */
+      kWILL_NEED
+    };
+  }
+
+  /**
+   * @brief
+   * A range of bytes that belongs to someone else, a File usually. Copying
+   * the view doesn't copy the bytes.
+   *
+   * @description
+   * The view is valid while the owner of the bytes is alive and open.
+   */
+  class NF_UTILITIES_EXPORT FileView
+  {
+   public:
+    /**
+     * @brief
+     * The default constructor, an empty view.
+     */
+    FileView() = default;
+    /**
+     * @brief
+     * Initializes the view with the range given.
+     *
+     * @param _data
+     * The first byte.
+     * @param _size
+     * The number of bytes.
+     */
+    FORCEINLINE
+    FileView(const uint8* _data, SIZE_T _size) : m_data(_data), m_size(_size) {}
+
+    /**
+     * @brief
+     * Returns the first byte.
+     *
+     * @return
+     * The pointer to the bytes, null for an empty view.
+     */
+    FORCEINLINE const uint8*
+    data() const
+    {
+      return m_data;
+    }
+    /**
+     * @brief
+     * Returns the number of bytes.
+     *
+     * @return
+     * The size of the view.
+     */
+    FORCEINLINE SIZE_T
+    size() const
+    {
+      return m_size;
+    }
+    /**
+     * @brief
+     * Checks if the view has no bytes.
+     *
+     * @return
+     * True if the size is 0.
+     */
+    FORCEINLINE bool
+    empty() const
+    {
+      return 0 == m_size;
+    }
+
+    FORCEINLINE const uint8*
+    begin() const
+    {
+      return m_data;
+    }
+    FORCEINLINE const uint8*
+    end() const
+    {
+      return m_data + m_size;
+    }
+
+    FORCEINLINE const uint8&
+    operator[](SIZE_T _index) const
+    {
+      assertm(_index < m_size, "Index out of the view");
+      return m_data[_index];
+    }
+
+    /**
+     * @brief
+     * A part of the view, cut to the end of this one.
+     *
+     * @param _offset
+     * The first byte of the part, from the start of this view.
+     * @param _size
+     * The number of bytes of the part.
+     *
+     * @return
+     * The part, empty if _offset is past the end.
+     */
+    FORCEINLINE FileView
+    subview(SIZE_T _offset, SIZE_T _size) const
+    {
+      if (_offset >= m_size) {
+        return FileView();
+      }
+      SIZE_T left = m_size - _offset;
+      return FileView(m_data + _offset, _size < left ? _size : left);
+    }
+
+   private:
+    /*
+     * The first byte.
+     */
+    const uint8* m_data = nullptr;
+    /*
+     * The number of bytes.
+     */
+    SIZE_T m_size = 0;
+  };
+
+  /**
+   * @brief
+   * A read only file.
+   *
+   * @description
+   * By default the file is mapped on memory, the views point directly to
+   * the pages of the system cache and nothing is read until it is touched.
+   * If mapping is not wanted or fails (an empty file, a pipe, some network
+   * drives) the whole file is read once to a buffer and the views point
+   * there, the rest of the interface works the same.
+   *
+   * Nothing changes the file after open(), so the views and read() can be
+   * used from many threads at the same time.
+   */
+  class NF_UTILITIES_EXPORT File
+  {
+   public:
+    /**
+     * @brief
+     * The default constructor, a closed file.
+     */
+    File() = default;
+    /**
+     * @brief
+     * Opens the file, see open().
+     */
+    explicit
+    File(const String& _path,
+         FILE_ACCESS_HINT::E _hint = FILE_ACCESS_HINT::kNORMAL,
+         bool _memoryMap = true)
+    {
+      open(_path, _hint, _memoryMap);
+    }
+    File(const File&) = delete;
+    File(File&& _other) noexcept;
+    /**
+     * @brief
+     * Closes the file.
+     */
+    ~File();
+
+    File&
+    operator=(const File&) = delete;
+    File&
+    operator=(File&& _other) noexcept;
+
+    /**
+     * @brief
+     * Opens a file for reading, closing the one it had.
+     *
+     * @param _path
+     * The path of the file, in UTF-8.
+     * @param _hint
+     * How the file is going to be read.
+     * @param _memoryMap
+     * If the file should be mapped, false to read it to a buffer.
+     *
+     * @return
+     * False if the file couldn't be opened.
+     */
+    bool
+    open(const String& _path,
+         FILE_ACCESS_HINT::E _hint = FILE_ACCESS_HINT::kNORMAL,
+         bool _memoryMap = true);
+    /**
+     * @brief
+     * Opens a file for reading without mapping it or reading it, closing the
+     * one it had. The views are empty, the bytes are read with read() or an
+     * AsyncFileQueue, for the big files that are streamed by parts.
+     *
+     * @param _path
+     * The path of the file, in UTF-8.
+     * @param _hint
+     * How the file is going to be read.
+     *
+     * @return
+     * False if the file couldn't be opened.
+     */
+    bool
+    openStream(const String& _path,
+               FILE_ACCESS_HINT::E _hint = FILE_ACCESS_HINT::kNORMAL);
+    /**
+     * @brief
+     * Closes the file, the views stop being valid.
+     */
+    void
+    close();
+
+    /**
+     * @brief
+     * Checks if the file is open.
+     *
+     * @return
+     * True if it is open.
+     */
+    FORCEINLINE bool
+    isOpen() const
+    {
+      return m_open;
+    }
+    /**
+     * @brief
+     * Checks if the file is mapped on memory or read to a buffer.
+     *
+     * @return
+     * True if it is mapped.
+     */
+    FORCEINLINE bool
+    isMapped() const
+    {
+      return m_mapped;
+    }
+    /**
+     * @brief
+     * Returns the size of the file.
+     *
+     * @return
+     * The number of bytes.
+     */
+    FORCEINLINE SIZE_T
+    getSize() const
+    {
+      return m_size;
+    }
+
+    /**
+     * @brief
+     * Returns the handle of the system, a HANDLE on Windows and a file
+     * descriptor on the rest.
+     *
+     * @return
+     * The handle, -1 if the file is closed.
+     */
+    FORCEINLINE intptr_t
+    getNativeHandle() const
+    {
+      return m_handle;
+    }
+
+    /**
+     * @brief
+     * Returns all the bytes of the file.
+     *
+     * @return
+     * The view to the file.
+     */
+    FORCEINLINE FileView
+    getView() const
+    {
+      return FileView(m_data, m_size);
+    }
+    /**
+     * @brief
+     * Returns a range of the file, cut to its end.
+     *
+     * @param _offset
+     * The first byte.
+     * @param _size
+     * The number of bytes.
+     *
+     * @return
+     * The view to the range.
+     */
+    FORCEINLINE FileView
+    getView(SIZE_T _offset, SIZE_T _size) const
+    {
+      return getView().subview(_offset, _size);
+    }
+
+    /**
+     * @brief
+     * Tells the system how a range of the file is going to be read.
+     *
+     * @description
+     * Only mapped files take the hint after open(), it is ignored on the
+     * buffered ones.
+     *
+     * @param _hint
+     * How the range is going to be read.
+     * @param _offset
+     * The first byte of the range.
+     * @param _size
+     * The number of bytes, 0 for up to the end.
+     */
+    void
+    advise(FILE_ACCESS_HINT::E _hint, SIZE_T _offset = 0, SIZE_T _size = 0) const;
+
+    /**
+     * @brief
+     * Copies a range of the file, from the memory if it is mapped or
+     * buffered and from the disk if it was opened with openStream().
+     *
+     * @param _offset
+     * The first byte.
+     * @param _out
+     * Where the bytes are written.
+     * @param _size
+     * The number of bytes.
+     *
+     * @return
+     * The number of bytes copied, less than _size at the end of the file.
+     */
+    SIZE_T
+    read(SIZE_T _offset, void* _out, SIZE_T _size) const;
+
+    /**
+     * @brief
+     * Reads a whole file to a string with a single allocation and read,
+     * for the text files.
+     *
+     * @param _path
+     * The path of the file, in UTF-8.
+     * @param _out
+     * Where the content is written.
+     *
+     * @return
+     * False if the file couldn't be read.
+     */
+    static bool
+    readAll(const String& _path, String& _out);
+    /**
+     * @brief
+     * Reads a whole file to a buffer with a single allocation and read.
+     *
+     * @param _path
+     * The path of the file, in UTF-8.
+     * @param _out
+     * Where the content is written.
+     *
+     * @return
+     * False if the file couldn't be read.
+     */
+    static bool
+    readAll(const String& _path, Vector<uint8>& _out);
+
+    /**
+     * @brief
+     * Reads a range from a handle of the system without moving its
+     * position, so many threads can read from the same handle.
+     *
+     * @param _handle
+     * The handle, from getNativeHandle().
+     * @param _offset
+     * The first byte.
+     * @param _out
+     * Where the bytes are written.
+     * @param _size
+     * The number of bytes.
+     *
+     * @return
+     * The number of bytes read, less than _size at the end of the file or on
+     * an error.
+     */
+    static SIZE_T
+    readAt(intptr_t _handle, SIZE_T _offset, uint8* _out, SIZE_T _size);
+
+   private:
+    /*
+     * Opens the handle and gets the size, without reading anything.
+     */
+    bool
+    openHandle(const String& _path, FILE_ACCESS_HINT::E _hint);
+
+    /*
+     * Reads from the current position of the handle until _size bytes or
+     * the end of the file, _done takes the bytes read.
+     */
+    static bool
+    readFully(intptr_t _handle, uint8* _out, SIZE_T _size, SIZE_T& _done);
+
+    /*
+     * Reads a whole file straight to _out, a String or a Vector<uint8>.
+     */
+    template<class _Buffer>
+    static bool
+    readWhole(const String& _path, _Buffer& _out);
+
+    /*
+     * The handle of the system, a HANDLE on Windows and a file descriptor
+     * on the rest.
+     */
+    intptr_t m_handle = -1;
+    /*
+     * The mapping object on Windows.
+     */
+    void* m_mapping = nullptr;
+    /*
+     * The first byte of the map or the buffer.
+     */
+    const uint8* m_data = nullptr;
+    /*
+     * The size of the file.
+     */
+    SIZE_T m_size = 0;
+    /*
+     * The content when the file is not mapped.
+     */
+    Vector<uint8> m_buffer;
+    /*
+     * If the file is open.
+     */
+    bool m_open = false;
+    /*
+     * If m_data is a map.
+     */
+    bool m_mapped = false;
+  };
+}
@@ -0,0 +1,357 @@
+/************************************************************************/
+/**
+ * @file nfFixed32.h
+ * @author Mara Castellanos
+ * @date 18/10/26
+ * @brief This file defines the Fixed32, a 16.16 fixed point number, and the
+ *        vectors made by it.
+ *
+ * @bug Not bug Known.
+ */
+/************************************************************************/
+
+#pragma once
+
+#include "nfPrerequisitesUtilities.h"
+#include "nfPlatformMath.h"
+#include "nfVectorN.h"
+
+namespace nfEngineSDK {
+  /**
+   * @brief
+   * Signed 16.16 fixed point number.
+   *
+   * @description
+   * 16 bits of integer part and 16 bits of fraction on an int32. Every
+   * operation is done with integers, so the results are bit exact on every
+   * compiler and CPU, for simulations that must stay in lockstep. The range
+   * is [-32768, 32768) with a step of 1/65536.
+   */
+  class Fixed32
+  {
+   public:
+    /**
+     * @brief
+     * The default constructor.
+     */
+    Fixed32() = default;
+    /**
+     * @brief
+     * Initializes the number with an integer.
+     *
+     * @param integer
+     * The integer value, inside the range of the type, [-32768, 32767].
+     * Outside of it the assert fails and the high bits are lost, without
+     * the undefined overflow of a signed multiplication.
+     */
+    FORCEINLINE explicit
+    Fixed32(int32 integer)
+      : m_value(static_cast<int32>(static_cast<uint32>(integer) << 16))
+    {
+      NF_ASSERT(integer >= -32768 && integer <= 32767);
+    }
+
+    /**
+     * @brief
+     * Makes a number from its raw 16.16 representation.
+     *
+     * @param raw
+     * The raw value, the real number times 65536.
+     *
+     * @return
+     * The number.
+     */
+    static FORCEINLINE Fixed32
+    fromRaw(int32 raw)
+    {
+      Fixed32 r;
+      r.m_value = raw;
+      return r;
+    }
+    /**
+     * @brief
+     * Makes a number from a float, rounded to the nearest step.
+     *
+     * @param value
+     * The float value, inside the range of the type.
+     *
+     * @return
+     * The number.
+     */
+    static FORCEINLINE Fixed32
+    fromFloat(float value)
+    {
+      float scaled = value * static_cast<float>(kONE_RAW);
+      return fromRaw(static_cast<int32>(scaled < 0.0f ? scaled - 0.5f
+                                                      : scaled + 0.5f));
+    }
+
+    /**
+     * @brief
+     * The raw 16.16 representation.
+     */
+    FORCEINLINE int32
+    getRaw() const { return m_value; }
+    /**
+     * @brief
+     * The number as a float.
+     */
+    FORCEINLINE float
+    toFloat() const
+    {
+      return static_cast<float>(m_value) * (1.0f / static_cast<float>(kONE_RAW));
+    }
+    /**
+     * @brief
+     * The integer part, rounded towards negative infinity.
+     */
+    FORCEINLINE int32
+    toInt() const { return m_value >> 16; }
+
+    /**
+     * @brief
+     * Cast to float.
+     */
+    FORCEINLINE explicit
+    operator float() const { return toFloat(); }
+
+    /**
+     * @brief
+     * The sum of two numbers. Out of the range it wraps around, done on
+     * uint32 to avoid the undefined overflow of an int32.
+     */
+    FORCEINLINE Fixed32
+    operator+(const Fixed32& other) const
+    {
+      return fromRaw(static_cast<int32>(static_cast<uint32>(m_value) +
+                                        static_cast<uint32>(other.m_value)));
+    }
+    /**
+     * @brief
+     * The subtraction of two numbers. Out of the range it wraps around, like
+     * the sum.
+     */
+    FORCEINLINE Fixed32
+    operator-(const Fixed32& other) const
+    {
+      return fromRaw(static_cast<int32>(static_cast<uint32>(m_value) -
+                                        static_cast<uint32>(other.m_value)));
+    }
+    /**
+     * @brief
+     * The multiplication of two numbers, rounded towards negative infinity.
+     */
+    FORCEINLINE Fixed32
+    operator*(const Fixed32& other) const
+    {
+      return fromRaw(static_cast<int32>((static_cast<int64>(m_value) *
+                                         other.m_value) >> 16));
+    }
+    /**
+     * @brief
+     * The quotient of two numbers, truncated towards zero. The divisor must
+     * not be zero.
+     */
+    FORCEINLINE Fixed32
+    operator/(const Fixed32& other) const
+    {
+      NF_ASSERT(0 != other.m_value);
+      return fromRaw(static_cast<int32>((static_cast<int64>(m_value) * kONE_RAW) /
+                                        other.m_value));
+    }
+    /**
+     * @brief
+     * The residue of the division of two numbers. The divisor must not be
+     * zero.
+     */
+    FORCEINLINE Fixed32
+    operator%(const Fixed32& other) const
+    {
+      NF_ASSERT(0 != other.m_value);
+      /* On int64, the lowest number modulo -1/65536 doesn't overflow. */
+      return fromRaw(static_cast<int32>(static_cast<int64>(m_value) % other.m_value));
+    }
+    /**
+     * @brief
+     * The minus operator. The lowest number, -32768, stays the same.
+     */
+    FORCEINLINE Fixed32
+    operator-() const
+    {
+      return fromRaw(static_cast<int32>(0u - static_cast<uint32>(m_value)));
+    }
+
+    /**
+     * @brief
+     * Makes the number equal to itself plus the other.
+     */
+    FORCEINLINE Fixed32&
+    operator+=(const Fixed32& other)
+    {
+      return *this = *this + other;
+    }
+    /**
+     * @brief
+     * Makes the number equal to itself minus the other.
+     */
+    FORCEINLINE Fixed32&
+    operator-=(const Fixed32& other)
+    {
+      return *this = *this - other;
+    }
+    /**
+     * @brief
+     * Makes the number equal to itself times the other.
+     */
+    FORCEINLINE Fixed32&
+    operator*=(const Fixed32& other)
+    {
+      return *this = *this * other;
+    }
+    /**
+     * @brief
+     * Makes the number equal to itself divided by the other.
+     */
+    FORCEINLINE Fixed32&
+    operator/=(const Fixed32& other)
+    {
+      return *this = *this / other;
+    }
+    /**
+     * @brief
+     * Makes the number equal to itself module by the other.
+     */
+    FORCEINLINE Fixed32&
+    operator%=(const Fixed32& other)
+    {
+      return *this = *this % other;
+    }
+
+    /**
+     * @brief
+     * True if the number is equal to the other.
+     */
+    FORCEINLINE bool
+    operator==(const Fixed32& other) const { return m_value == other.m_value; }
+    /**
+     * @brief
+     * True if the number is not equal to the other.
+     */
+    FORCEINLINE bool
+    operator!=(const Fixed32& other) const { return m_value != other.m_value; }
+    /**
+     * @brief
+     * True if the number is less than the other.
+     */
+    FORCEINLINE bool
+    operator<(const Fixed32& other) const { return m_value < other.m_value; }
+    /**
+     * @brief
+     * True if the number is less than or equal to the other.
+     */
+    FORCEINLINE bool
+    operator<=(const Fixed32& other) const { return m_value <= other.m_value; }
+    /**
+     * @brief
+     * True if the number is greater than the other.
+     */
+    FORCEINLINE bool
+    operator>(const Fixed32& other) const { return m_value > other.m_value; }
+    /**
+     * @brief
+     * True if the number is greater than or equal to the other.
+     */
+    FORCEINLINE bool
+    operator>=(const Fixed32& other) const { return m_value >= other.m_value; }
+
+    /**
+     * @brief
+     * The square root, rounded towards zero.
+     *
+     * @description
+     * Bit by bit integer square root of the value scaled by 2^16, so the
+     * result keeps all the 16 bits of fraction.
+     *
+     * @return
+     * The square root, or 0 for negative numbers.
+     */
+    FORCEINLINE Fixed32
+    sqrt() const
+    {
+      if (m_value <= 0) {
+        return fromRaw(0);
+      }
+      uint64 op = static_cast<uint64>(m_value) << 16;
+      uint64 res = 0;
+      uint64 one = uint64(1) << 46;
+      while (one > op) {
+        one >>= 2;
+      }
+      while (one != 0) {
+        if (op >= res + one) {
+          op -= res + one;
+          res = (res >> 1) + one;
+        }
+        else {
+          res >>= 1;
+        }
+        one >>= 2;
+      }
+      return fromRaw(static_cast<int32>(res));
+    }
+
+    /*
+     * The raw value of 1.
+     */
+    static constexpr int32 kONE_RAW = 1 << 16;
+
+   private:
+    /*
+     * The value times 65536.
+     */
+    int32 m_value;
+  };
+
+  /**
+   * @brief
+   * Fixed32 vectors measure their magnitudes in Fixed32, so distances stay
+   * deterministic too.
+   */
+  template<>
+  struct TVectorReal<Fixed32>
+  {
+    using type = Fixed32;
+  };
+
+  /**
+   * @brief
+   * Square root of a Fixed32.
+   */
+  template<>
+  FORCEINLINE Fixed32
+  PlatformMath::sqrt<Fixed32>(Fixed32 _val)
+  {
+    return _val.sqrt();
+  }
+  /**
+   * @brief
+   * Absolute value of a Fixed32.
+   */
+  template<>
+  FORCEINLINE Fixed32
+  PlatformMath::abs<Fixed32>(Fixed32 _val)
+  {
+    return _val < Fixed32(0) ? -_val : _val;
+  }
+
+  /**
+   * @brief
+   * Two dimensional vector made by Fixed32.
+   */
+  using Vector2x = TVector<Fixed32, 2>;
+  /**
+   * @brief
+   * Three dimensional vector made by Fixed32, for deterministic simulation.
+   */
+  using Vector3x = TVector<Fixed32, 3>;
+}
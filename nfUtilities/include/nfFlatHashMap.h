@@ -0,0 +1,1135 @@
+/************************************************************************/
+/**
+ * @file nfFlatHashMap.h
+ * @author Mara Castellanos
+ * @date 18/10/26
+ * @brief Open addressing hash tables, FlatHashMap and FlatHashSet, and the
+ *        FlatHash functions for their keys.
+ *
+ * @bug Not bug Known.
+ */
+/************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <cstring>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "nfPrerequisitesUtilities.h"
+#include "nfSmallVector.h"
+#include "nfVector2.h"
+#include "nfVector3.h"
+
+#if NF_SIMD_SSE2
+# include <emmintrin.h>
+#endif
+#if NF_COMPILER == NF_COMPILER_MSVC
+# include <intrin.h>
+#endif
+
+namespace nfEngineSDK {
+  /**
+   * @brief
+   * Mixing of the bits of a hash.
+   *
+   * @description
+   * The tables take the group from the high bits of the hash and 7 bits to
+   * filter the keys from the low ones, an identity hash like the one of
+   * std::hash for integers would put consecutive keys on the same filter.
+   * mix spreads every bit of the input over all the output, it is a
+   * bijection so it never adds collisions.
+   */
+  class HashMix
+  {
+   public:
+    static FORCEINLINE SIZE_T
+    mix(uint64 _value)
+    {
+      uint64 h = _value * 0x9E3779B97F4A7C15ull;
+      return static_cast<SIZE_T>(h ^ (h >> 32));
+    }
+    /**
+     * @brief
+     * Mixes a value into a hash, for keys made by several values.
+     */
+    static FORCEINLINE SIZE_T
+    combine(SIZE_T _seed, uint64 _value)
+    {
+      return mix((static_cast<uint64>(_seed) << 1) + 0x632BE59BD9B4E019ull + _value);
+    }
+  };
+
+  /**
+   * @brief
+   * The hash the flat tables use by default: std::hash, mixed.
+   */
+  template<typename T>
+  struct FlatHash
+  {
+    FORCEINLINE SIZE_T
+    operator()(const T& _value) const
+    {
+      return HashMix::mix(static_cast<uint64>(std::hash<T>()(_value)));
+    }
+  };
+
+  /**
+   * @brief
+   * A cell of a 2D grid, both coordinates go in one 64 bits mix so two
+   * cells never share a hash.
+   */
+  template<>
+  struct FlatHash<Vector2i>
+  {
+    FORCEINLINE SIZE_T
+    operator()(const Vector2i& _cell) const
+    {
+      return HashMix::mix(static_cast<uint64>(static_cast<uint32>(_cell.x)) |
+                          (static_cast<uint64>(static_cast<uint32>(_cell.y)) << 32));
+    }
+  };
+
+  /**
+   * @brief
+   * A cell of a 3D grid.
+   */
+  template<>
+  struct FlatHash<Vector3i>
+  {
+    FORCEINLINE SIZE_T
+    operator()(const Vector3i& _cell) const
+    {
+      SIZE_T xy = HashMix::mix(static_cast<uint64>(static_cast<uint32>(_cell.x)) |
+                               (static_cast<uint64>(static_cast<uint32>(_cell.y)) << 32));
+      return HashMix::combine(xy, static_cast<uint32>(_cell.z));
+    }
+  };
+
+  /**
+   * @brief
+   * The control bytes of a flat table and the search in a group of them.
+   *
+   * @description
+   * Every slot has a byte: the 7 low bits of the hash of its key when it is
+   * full, or kEMPTY or kDELETED. A group is kWIDTH consecutive bytes that
+   * are compared at once, with SSE2 or with 64 bits integer operations.
+   */
+  namespace FlatTableControl {
+    const int8 kEMPTY = -128;
+    const int8 kDELETED = -2;
+    /*
+     * After the last slot, stops the iteration.
+     */
+    const int8 kSENTINEL = -1;
+
+    FORCEINLINE uint32
+    countTrailingZeros(uint64 _value)
+    {
+#if NF_COMPILER == NF_COMPILER_MSVC && defined(_M_X64)
+      unsigned long index;
+      _BitScanForward64(&index, _value);
+      return index;
+#elif NF_COMPILER == NF_COMPILER_MSVC
+      unsigned long index;
+      if (_BitScanForward(&index, static_cast<uint32>(_value))) {
+        return index;
+      }
+      _BitScanForward(&index, static_cast<uint32>(_value >> 32));
+      return index + 32;
+#else
+      return static_cast<uint32>(__builtin_ctzll(_value));
+#endif
+    }
+
+    FORCEINLINE uint32
+    countLeadingZeros(uint64 _value)
+    {
+#if NF_COMPILER == NF_COMPILER_MSVC && defined(_M_X64)
+      unsigned long index;
+      return _BitScanReverse64(&index, _value) ? 63 - index : 64;
+#elif NF_COMPILER == NF_COMPILER_MSVC
+      unsigned long index;
+      if (_BitScanReverse(&index, static_cast<uint32>(_value >> 32))) {
+        return 31 - index;
+      }
+      return _BitScanReverse(&index, static_cast<uint32>(_value)) ? 63 - index : 64;
+#else
+      return 0 == _value ? 64 : static_cast<uint32>(__builtin_clzll(_value));
+#endif
+    }
+
+    /*
+     * The slots of a group that matched, a bit (or a byte) per slot.
+     */
+    template<uint32 shift, uint32 width>
+    struct BitMask
+    {
+      FORCEINLINE explicit operator bool() const
+      {
+        return 0 != bits;
+      }
+      FORCEINLINE uint32
+      lowest() const
+      {
+        return countTrailingZeros(bits) >> shift;
+      }
+      FORCEINLINE void
+      clearLowest()
+      {
+        bits &= bits - 1;
+      }
+      /*
+       * The slots without a match before the first one and after the last.
+       */
+      FORCEINLINE uint32
+      trailingEmpty() const
+      {
+        return 0 == bits ? width : lowest();
+      }
+      FORCEINLINE uint32
+      leadingEmpty() const
+      {
+        uint32 unused = 64 - (width << shift);
+        return (countLeadingZeros(bits) - unused) >> shift;
+      }
+
+      uint64 bits;
+    };
+
+#if NF_SIMD_SSE2
+    struct Group
+    {
+      static const uint32 kWIDTH = 16;
+      using Mask = BitMask<0, kWIDTH>;
+
+      FORCEINLINE explicit
+      Group(const int8* _control)
+        : control(_mm_loadu_si128(reinterpret_cast<const __m128i*>(_control))) {}
+
+      FORCEINLINE Mask
+      match(int8 _hash) const
+      {
+        __m128i hash = _mm_set1_epi8(_hash);
+        return Mask{ static_cast<uint32>(_mm_movemask_epi8(_mm_cmpeq_epi8(hash, control))) };
+      }
+      FORCEINLINE Mask
+      matchEmpty() const
+      {
+        return match(kEMPTY);
+      }
+      FORCEINLINE Mask
+      matchEmptyOrDeleted() const
+      {
+        __m128i sentinel = _mm_set1_epi8(kSENTINEL);
+        return Mask{ static_cast<uint32>(_mm_movemask_epi8(_mm_cmpgt_epi8(sentinel, control))) };
+      }
+
+      __m128i control;
+    };
+#else
+    /*
+     * Eight bytes in an integer, a match sets the high bit of the byte. match
+     * can give false positives after a real match, the keys are compared
+     * anyway.
+     */
+    struct Group
+    {
+      static const uint32 kWIDTH = 8;
+      using Mask = BitMask<3, kWIDTH>;
+      static const uint64 kLSBS = 0x0101010101010101ull;
+      static const uint64 kMSBS = 0x8080808080808080ull;
+
+      FORCEINLINE explicit
+      Group(const int8* _control)
+      {
+        std::memcpy(&control, _control, sizeof(control));
+      }
+
+      FORCEINLINE Mask
+      match(int8 _hash) const
+      {
+        uint64 x = control ^ (kLSBS * static_cast<uint8>(_hash));
+        return Mask{ (x - kLSBS) & ~x & kMSBS };
+      }
+      FORCEINLINE Mask
+      matchEmpty() const
+      {
+        return Mask{ (control & (~control << 6)) & kMSBS };
+      }
+      FORCEINLINE Mask
+      matchEmptyOrDeleted() const
+      {
+        return Mask{ (control & (~control << 7)) & kMSBS };
+      }
+
+      uint64 control;
+    };
+#endif
+
+    /*
+     * The control of the tables without slots: a sentinel and empty bytes
+     * for a whole group, it is never written.
+     */
+    alignas(16) constexpr int8 kEMPTY_GROUP[16] = {
+      kSENTINEL, kEMPTY, kEMPTY, kEMPTY, kEMPTY, kEMPTY, kEMPTY, kEMPTY,
+      kEMPTY, kEMPTY, kEMPTY, kEMPTY, kEMPTY, kEMPTY, kEMPTY, kEMPTY
+    };
+  }
+
+  /**
+   * @brief
+   * An open addressing hash table, the base of FlatHashMap and FlatHashSet.
+   *
+   * @description
+   * The elements are in one array and a byte per element tells if the slot
+   * is full and 7 bits of its hash. A search compares a whole group of
+   * those bytes at once and only compares the keys whose bits match, most
+   * lookups touch a group of control bytes and a slot, against a cache miss
+   * per level of a std::map.
+   *
+   * The capacity is a power of 2 minus 1 and the table grows at 7/8 of it.
+   * The probe goes by groups in triangular steps. The control has a
+   * sentinel after the last slot and a copy of its first group after it, so
+   * a group can be read from any slot.
+   *
+   * As in std::unordered_map, the insertions that grow the table invalidate
+   * the iterators and the references, erasing doesn't move the other
+   * elements.
+   *
+   * The Policy gives the stored type (Slot), its key and how to build it.
+   */
+  template<typename Policy, typename Hash, typename Equal, typename Alloc>
+  class TFlatHashTable
+  {
+   public:
+    using key_type = typename Policy::Key;
+    using value_type = typename Policy::Slot;
+    using size_type = SIZE_T;
+    using difference_type = std::ptrdiff_t;
+    using hasher = Hash;
+    using key_equal = Equal;
+    using allocator_type = Alloc;
+    using reference = typename std::conditional<Policy::kMUTABLE_SLOTS,
+                                                 value_type&,
+                                                 const value_type&>::type;
+    using const_reference = const value_type&;
+
+   private:
+    using Slot = value_type;
+    using Group = FlatTableControl::Group;
+    using SlotAlloc = typename std::allocator_traits<Alloc>::template rebind_alloc<Slot>;
+    using SlotTraits = std::allocator_traits<SlotAlloc>;
+    using ControlAlloc = typename std::allocator_traits<Alloc>::template rebind_alloc<int8>;
+    using ControlTraits = std::allocator_traits<ControlAlloc>;
+
+    template<bool isConst>
+    class Iterator
+    {
+      friend class TFlatHashTable;
+      using SlotPointer = typename std::conditional<isConst, const Slot*, Slot*>::type;
+
+     public:
+      using iterator_category = std::forward_iterator_tag;
+      using value_type = Slot;
+      using difference_type = std::ptrdiff_t;
+      using pointer = SlotPointer;
+      using reference = typename std::conditional<isConst, const Slot&, Slot&>::type;
+
+      Iterator() = default;
+      /*
+       * The iterators convert to const_iterators.
+       */
+      template<bool otherConst, typename = typename std::enable_if<isConst && !otherConst>::type>
+      FORCEINLINE Iterator(const Iterator<otherConst>& _other)
+        : m_control(_other.m_control), m_slot(_other.m_slot) {}
+
+      FORCEINLINE reference operator*() const { return *m_slot; }
+      FORCEINLINE pointer operator->() const { return m_slot; }
+      FORCEINLINE Iterator&
+      operator++()
+      {
+        ++m_control;
+        ++m_slot;
+        skipFree();
+        return *this;
+      }
+      FORCEINLINE Iterator
+      operator++(int)
+      {
+        Iterator old = *this;
+        ++*this;
+        return old;
+      }
+      FORCEINLINE bool
+      operator==(const Iterator& _other) const
+      {
+        return m_control == _other.m_control;
+      }
+      FORCEINLINE bool
+      operator!=(const Iterator& _other) const
+      {
+        return m_control != _other.m_control;
+      }
+
+     private:
+      FORCEINLINE
+      Iterator(const int8* _control, SlotPointer _slot)
+        : m_control(_control), m_slot(_slot) {}
+
+      /*
+       * Up to the next full slot or the sentinel.
+       */
+      FORCEINLINE void
+      skipFree()
+      {
+        while (*m_control < FlatTableControl::kSENTINEL) {
+          ++m_control;
+          ++m_slot;
+        }
+      }
+
+      template<bool> friend class Iterator;
+      const int8* m_control = nullptr;
+      SlotPointer m_slot = nullptr;
+    };
+
+   public:
+    /*
+     * The iterators of a set are const too, changing a key in place would
+     * leave it in the wrong group.
+     */
+    using iterator = Iterator<!Policy::kMUTABLE_SLOTS>;
+    using const_iterator = Iterator<true>;
+
+    TFlatHashTable() = default;
+    /**
+     * @brief
+     * Initializes the table with room for _count elements.
+     */
+    explicit TFlatHashTable(SIZE_T _count,
+                            const Hash& _hash = Hash(),
+                            const Equal& _equal = Equal(),
+                            const Alloc& _alloc = Alloc())
+      : m_hash(_hash), m_equal(_equal), m_alloc(_alloc)
+    {
+      reserve(_count);
+    }
+    explicit TFlatHashTable(const Alloc& _alloc)
+      : m_alloc(_alloc) {}
+    TFlatHashTable(const TFlatHashTable& _other)
+      : m_hash(_other.m_hash),
+        m_equal(_other.m_equal),
+        m_alloc(std::allocator_traits<Alloc>::select_on_container_copy_construction(_other.m_alloc))
+    {
+      copyFrom(_other);
+    }
+    TFlatHashTable(TFlatHashTable&& _other) noexcept
+      : m_hash(std::move(_other.m_hash)),
+        m_equal(std::move(_other.m_equal)),
+        m_alloc(std::move(_other.m_alloc))
+    {
+      takeFrom(_other);
+    }
+    /**
+     * @brief
+     * Destroys the elements and frees the memory.
+     */
+    ~TFlatHashTable()
+    {
+      destroyAll();
+      freeArrays();
+    }
+
+    TFlatHashTable&
+    operator=(const TFlatHashTable& _other)
+    {
+      if (this != &_other) {
+        clear();
+        m_hash = _other.m_hash;
+        m_equal = _other.m_equal;
+        copyFrom(_other);
+      }
+      return *this;
+    }
+    TFlatHashTable&
+    operator=(TFlatHashTable&& _other) noexcept
+    {
+      if (this != &_other) {
+        destroyAll();
+        freeArrays();
+        m_hash = std::move(_other.m_hash);
+        m_equal = std::move(_other.m_equal);
+        m_alloc = std::move(_other.m_alloc);
+        takeFrom(_other);
+      }
+      return *this;
+    }
+
+    FORCEINLINE iterator
+    begin()
+    {
+      iterator it(m_control, m_slots);
+      it.skipFree();
+      return it;
+    }
+    FORCEINLINE iterator
+    end()
+    {
+      return iterator(m_control + m_capacity, m_slots + m_capacity);
+    }
+    FORCEINLINE const_iterator
+    begin() const
+    {
+      const_iterator it(m_control, m_slots);
+      it.skipFree();
+      return it;
+    }
+    FORCEINLINE const_iterator
+    end() const
+    {
+      return const_iterator(m_control + m_capacity, m_slots + m_capacity);
+    }
+    FORCEINLINE const_iterator cbegin() const { return begin(); }
+    FORCEINLINE const_iterator cend() const { return end(); }
+
+    FORCEINLINE SIZE_T
+    size() const
+    {
+      return m_size;
+    }
+    FORCEINLINE bool
+    empty() const
+    {
+      return 0 == m_size;
+    }
+    /**
+     * @brief
+     * The number of slots, full or not.
+     */
+    FORCEINLINE SIZE_T
+    capacity() const
+    {
+      return m_capacity;
+    }
+    FORCEINLINE allocator_type
+    get_allocator() const
+    {
+      return m_alloc;
+    }
+    FORCEINLINE hasher
+    hash_function() const
+    {
+      return m_hash;
+    }
+    FORCEINLINE key_equal
+    key_eq() const
+    {
+      return m_equal;
+    }
+
+    FORCEINLINE iterator
+    find(const key_type& _key)
+    {
+      SIZE_T index = findIndex(_key);
+      return index == m_capacity ? end() : iterator(m_control + index, m_slots + index);
+    }
+    FORCEINLINE const_iterator
+    find(const key_type& _key) const
+    {
+      SIZE_T index = findIndex(_key);
+      return index == m_capacity ? end() : const_iterator(m_control + index, m_slots + index);
+    }
+    FORCEINLINE bool
+    contains(const key_type& _key) const
+    {
+      return findIndex(_key) != m_capacity;
+    }
+    FORCEINLINE SIZE_T
+    count(const key_type& _key) const
+    {
+      return contains(_key) ? 1 : 0;
+    }
+
+    /**
+     * @brief
+     * Removes the element with the key, if there is one.
+     *
+     * @return
+     * The number of elements removed, 0 or 1.
+     */
+    SIZE_T
+    erase(const key_type& _key)
+    {
+      SIZE_T index = findIndex(_key);
+      if (index == m_capacity) {
+        return 0;
+      }
+      eraseAt(index);
+      return 1;
+    }
+    /**
+     * @brief
+     * Removes the element at the iterator.
+     *
+     * @return
+     * The iterator to the next element.
+     */
+    iterator
+    erase(const_iterator _position)
+    {
+      SIZE_T index = static_cast<SIZE_T>(_position.m_control - m_control);
+      eraseAt(index);
+      iterator next(m_control + index, m_slots + index);
+      ++next;
+      return next;
+    }
+
+    /**
+     * @brief
+     * Destroys the elements, the capacity stays.
+     */
+    void
+    clear()
+    {
+      destroyAll();
+      m_size = 0;
+      if (m_capacity > 0) {
+        resetControl();
+      }
+    }
+    /**
+     * @brief
+     * Makes room for _count elements without growing.
+     */
+    void
+    reserve(SIZE_T _count)
+    {
+      if (_count > m_size + m_growthLeft) {
+        rehash(capacityFor(_count));
+      }
+    }
+    void
+    swap(TFlatHashTable& _other) noexcept
+    {
+      std::swap(m_control, _other.m_control);
+      std::swap(m_slots, _other.m_slots);
+      std::swap(m_capacity, _other.m_capacity);
+      std::swap(m_size, _other.m_size);
+      std::swap(m_growthLeft, _other.m_growthLeft);
+      std::swap(m_hash, _other.m_hash);
+      std::swap(m_equal, _other.m_equal);
+      std::swap(m_alloc, _other.m_alloc);
+    }
+
+   protected:
+    /*
+     * Finds the key or builds a new slot for it with _args, for the insert
+     * functions of the map and the set. When the table grows, the new
+     * element is built before the old ones move: _key and _args can point
+     * inside the table, like m[k2] = m[k1].
+     */
+    template<typename K, typename... Args>
+    std::pair<iterator, bool>
+    emplaceKey(K&& _key, Args&&... _args)
+    {
+      SIZE_T hash = m_hash(_key);
+      SIZE_T index = findIndex(_key, hash);
+      if (index != m_capacity) {
+        return { iterator(m_control + index, m_slots + index), false };
+      }
+      SlotAlloc slotAlloc(m_alloc);
+      if (0 == m_growthLeft) {
+        rehash(nextCapacity(), [&]() {
+          index = findFree(hash);
+          Policy::construct(slotAlloc, m_slots + index, std::forward<K>(_key), std::forward<Args>(_args)...);
+          setControl(index, static_cast<int8>(hash & 0x7F));
+          ++m_size;
+        });
+        return { iterator(m_control + index, m_slots + index), true };
+      }
+      index = findFree(hash);
+      Policy::construct(slotAlloc, m_slots + index, std::forward<K>(_key), std::forward<Args>(_args)...);
+      m_growthLeft -= FlatTableControl::kEMPTY == m_control[index] ? 1 : 0;
+      setControl(index, static_cast<int8>(hash & 0x7F));
+      ++m_size;
+      return { iterator(m_control + index, m_slots + index), true };
+    }
+
+   private:
+    /*
+     * 7/8 of the slots, and always an empty one to stop the searches: the
+     * smallest table of 8 bytes groups has 7 slots and 7 / 8 is 0.
+     */
+    static FORCEINLINE SIZE_T
+    growthFor(SIZE_T _capacity)
+    {
+      return 7 == _capacity ? 6 : _capacity - _capacity / 8;
+    }
+    /*
+     * The smallest capacity, a power of 2 minus 1, that holds _count.
+     */
+    static SIZE_T
+    capacityFor(SIZE_T _count)
+    {
+      SIZE_T capacity = Group::kWIDTH - 1;
+      while (growthFor(capacity) < _count) {
+        capacity = capacity * 2 + 1;
+      }
+      return capacity;
+    }
+
+    FORCEINLINE SIZE_T
+    findIndex(const key_type& _key) const
+    {
+      return 0 == m_size ? m_capacity : findIndex(_key, m_hash(_key));
+    }
+    /*
+     * The index of the key, or m_capacity.
+     */
+    SIZE_T
+    findIndex(const key_type& _key, SIZE_T _hash) const
+    {
+      if (0 == m_capacity) {
+        return 0;
+      }
+      int8 h2 = static_cast<int8>(_hash & 0x7F);
+      SIZE_T position = (_hash >> 7) & m_capacity;
+      SIZE_T step = 0;
+      for (;;) {
+        Group group(m_control + position);
+        for (auto match = group.match(h2); match; match.clearLowest()) {
+          SIZE_T index = (position + match.lowest()) & m_capacity;
+          if (m_equal(Policy::key(m_slots[index]), _key)) {
+            return index;
+          }
+        }
+        if (group.matchEmpty()) {
+          return m_capacity;
+        }
+        step += Group::kWIDTH;
+        position = (position + step) & m_capacity;
+      }
+    }
+    /*
+     * The first empty or deleted slot of the probe of _hash.
+     */
+    SIZE_T
+    findFree(SIZE_T _hash) const
+    {
+      SIZE_T position = (_hash >> 7) & m_capacity;
+      SIZE_T step = 0;
+      for (;;) {
+        auto free = Group(m_control + position).matchEmptyOrDeleted();
+        if (free) {
+          return (position + free.lowest()) & m_capacity;
+        }
+        step += Group::kWIDTH;
+        position = (position + step) & m_capacity;
+      }
+    }
+
+    /*
+     * Writes the control byte of a slot and its copy after the sentinel.
+     */
+    FORCEINLINE void
+    setControl(SIZE_T _index, int8 _value)
+    {
+      const SIZE_T kCLONED = Group::kWIDTH - 1;
+      m_control[_index] = _value;
+      m_control[((_index - kCLONED) & m_capacity) + kCLONED] = _value;
+    }
+
+    void
+    resetControl()
+    {
+      std::memset(m_control, FlatTableControl::kEMPTY, m_capacity + Group::kWIDTH);
+      m_control[m_capacity] = FlatTableControl::kSENTINEL;
+      m_growthLeft = growthFor(m_capacity) - m_size;
+    }
+
+    /*
+     * A slot can go back to empty when no probe ever went past it: there
+     * is an empty slot in the group that starts at it and in the group that
+     * ends before it, close enough to always stop a probe. Otherwise it is
+     * deleted, a tombstone the searches skip.
+     */
+    void
+    eraseAt(SIZE_T _index)
+    {
+      SlotAlloc slotAlloc(m_alloc);
+      SlotTraits::destroy(slotAlloc, m_slots + _index);
+      --m_size;
+
+      SIZE_T before = (_index - Group::kWIDTH) & m_capacity;
+      auto emptyAfter = Group(m_control + _index).matchEmpty();
+      auto emptyBefore = Group(m_control + before).matchEmpty();
+      bool wasNeverFull = emptyBefore && emptyAfter &&
+                          emptyAfter.trailingEmpty() + emptyBefore.leadingEmpty() < Group::kWIDTH;
+      setControl(_index, wasNeverFull ? FlatTableControl::kEMPTY : FlatTableControl::kDELETED);
+      m_growthLeft += wasNeverFull ? 1 : 0;
+    }
+
+    /*
+     * The capacity for one more element: double, or the same size to
+     * rebuild it when most of the used slots are tombstones.
+     */
+    FORCEINLINE SIZE_T
+    nextCapacity() const
+    {
+      if (m_capacity > Group::kWIDTH && m_size * 32 <= m_capacity * 25) {
+        return m_capacity;
+      }
+      return 0 == m_capacity ? Group::kWIDTH - 1 : m_capacity * 2 + 1;
+    }
+
+    FORCEINLINE void
+    rehash(SIZE_T _capacity)
+    {
+      rehash(_capacity, []() {});
+    }
+    /*
+     * Moves the elements to new arrays of _capacity slots. _emplace is
+     * called on the empty new table, before the old slots move or are
+     * freed.
+     */
+    template<typename Emplace>
+    void
+    rehash(SIZE_T _capacity, Emplace&& _emplace)
+    {
+      int8* oldControl = m_control;
+      Slot* oldSlots = m_slots;
+      SIZE_T oldCapacity = m_capacity;
+
+      ControlAlloc controlAlloc(m_alloc);
+      SlotAlloc slotAlloc(m_alloc);
+      m_control = ControlTraits::allocate(controlAlloc, _capacity + Group::kWIDTH);
+      m_slots = SlotTraits::allocate(slotAlloc, _capacity);
+      m_capacity = _capacity;
+      resetControl();
+      _emplace();
+
+      for (SIZE_T i = 0; i < oldCapacity; ++i) {
+        if (oldControl[i] >= 0) {
+          SIZE_T hash = m_hash(Policy::key(oldSlots[i]));
+          SIZE_T index = findFree(hash);
+          setControl(index, static_cast<int8>(hash & 0x7F));
+          relocate(slotAlloc, oldSlots + i, m_slots + index);
+        }
+      }
+      m_growthLeft = growthFor(m_capacity) - m_size;
+
+      if (oldCapacity > 0) {
+        ControlTraits::deallocate(controlAlloc, oldControl, oldCapacity + Group::kWIDTH);
+        SlotTraits::deallocate(slotAlloc, oldSlots, oldCapacity);
+      }
+    }
+
+    static FORCEINLINE void
+    relocate(SlotAlloc& _alloc, Slot* _from, Slot* _to)
+    {
+      if constexpr (IsTriviallyRelocatable<Slot>::value) {
+        std::memcpy(static_cast<void*>(_to), static_cast<const void*>(_from), sizeof(Slot));
+      }
+      else {
+        SlotTraits::construct(_alloc, _to, std::move(*_from));
+        SlotTraits::destroy(_alloc, _from);
+      }
+    }
+
+    void
+    destroyAll()
+    {
+      if constexpr (!std::is_trivially_destructible<Slot>::value) {
+        SlotAlloc slotAlloc(m_alloc);
+        for (SIZE_T i = 0; i < m_capacity; ++i) {
+          if (m_control[i] >= 0) {
+            SlotTraits::destroy(slotAlloc, m_slots + i);
+          }
+        }
+      }
+    }
+
+    void
+    freeArrays()
+    {
+      if (m_capacity > 0) {
+        ControlAlloc controlAlloc(m_alloc);
+        SlotAlloc slotAlloc(m_alloc);
+        ControlTraits::deallocate(controlAlloc, m_control, m_capacity + Group::kWIDTH);
+        SlotTraits::deallocate(slotAlloc, m_slots, m_capacity);
+      }
+      m_control = const_cast<int8*>(FlatTableControl::kEMPTY_GROUP);
+      m_slots = nullptr;
+      m_capacity = 0;
+      m_size = 0;
+      m_growthLeft = 0;
+    }
+
+    void
+    copyFrom(const TFlatHashTable& _other)
+    {
+      reserve(_other.m_size);
+      SlotAlloc slotAlloc(m_alloc);
+      for (const Slot& slot : _other) {
+        SIZE_T hash = m_hash(Policy::key(slot));
+        SIZE_T index = findFree(hash);
+        SlotTraits::construct(slotAlloc, m_slots + index, slot);
+        m_growthLeft -= FlatTableControl::kEMPTY == m_control[index] ? 1 : 0;
+        setControl(index, static_cast<int8>(hash & 0x7F));
+        ++m_size;
+      }
+    }
+
+    void
+    takeFrom(TFlatHashTable& _other)
+    {
+      m_control = _other.m_control;
+      m_slots = _other.m_slots;
+      m_capacity = _other.m_capacity;
+      m_size = _other.m_size;
+      m_growthLeft = _other.m_growthLeft;
+      _other.m_control = const_cast<int8*>(FlatTableControl::kEMPTY_GROUP);
+      _other.m_slots = nullptr;
+      _other.m_capacity = 0;
+      _other.m_size = 0;
+      _other.m_growthLeft = 0;
+    }
+
+    /*
+     * The control bytes, m_capacity + kWIDTH of them.
+     */
+    int8* m_control = const_cast<int8*>(FlatTableControl::kEMPTY_GROUP);
+    /*
+     * The slots, m_capacity of them.
+     */
+    Slot* m_slots = nullptr;
+    /*
+     * A power of 2 minus 1, the mask of the indices; 0 without slots.
+     */
+    SIZE_T m_capacity = 0;
+    SIZE_T m_size = 0;
+    /*
+     * The empty slots that can still be filled before the table grows.
+     */
+    SIZE_T m_growthLeft = 0;
+    Hash m_hash;
+    Equal m_equal;
+    Alloc m_alloc;
+  };
+
+  /*
+   * How the map stores its pairs.
+   */
+  template<typename K, typename V>
+  struct FlatMapPolicy
+  {
+    using Key = K;
+    using Slot = std::pair<const K, V>;
+    /* The values can change through the iterators, the key is const. */
+    static constexpr bool kMUTABLE_SLOTS = true;
+
+    static FORCEINLINE const K&
+    key(const Slot& _slot)
+    {
+      return _slot.first;
+    }
+    template<typename A, typename KeyArg, typename... Args>
+    static FORCEINLINE void
+    construct(A& _alloc, Slot* _slot, KeyArg&& _key, Args&&... _args)
+    {
+      std::allocator_traits<A>::construct(_alloc, _slot, std::piecewise_construct,
+                                          std::forward_as_tuple(std::forward<KeyArg>(_key)),
+                                          std::forward_as_tuple(std::forward<Args>(_args)...));
+    }
+  };
+
+  /*
+   * How the set stores its keys.
+   */
+  template<typename K>
+  struct FlatSetPolicy
+  {
+    using Key = K;
+    using Slot = K;
+    /* The slot is the key, it can't change. */
+    static constexpr bool kMUTABLE_SLOTS = false;
+
+    static FORCEINLINE const K&
+    key(const Slot& _slot)
+    {
+      return _slot;
+    }
+    template<typename A, typename KeyArg>
+    static FORCEINLINE void
+    construct(A& _alloc, Slot* _slot, KeyArg&& _key)
+    {
+      std::allocator_traits<A>::construct(_alloc, _slot, std::forward<KeyArg>(_key));
+    }
+  };
+
+  /**
+   * @brief
+   * A hash map with the interface of std::unordered_map, on a
+   * TFlatHashTable.
+   *
+   * @description
+   * For the lookups of the hot paths: grid cells, ids, names. Use Map
+   * when the keys must stay sorted.
+   */
+  template<typename K,
+           typename V,
+           typename Hash = FlatHash<K>,
+           typename Equal = std::equal_to<K>,
+           typename Alloc = std::allocator<std::pair<const K, V>>>
+  class FlatHashMap : public TFlatHashTable<FlatMapPolicy<K, V>, Hash, Equal, Alloc>
+  {
+    using Base = TFlatHashTable<FlatMapPolicy<K, V>, Hash, Equal, Alloc>;
+
+   public:
+    using mapped_type = V;
+    using typename Base::value_type;
+    using typename Base::iterator;
+    using typename Base::const_iterator;
+    using Base::Base;
+
+    FlatHashMap() = default;
+    FlatHashMap(std::initializer_list<value_type> _values)
+    {
+      this->reserve(_values.size());
+      for (const value_type& value : _values) {
+        insert(value);
+      }
+    }
+
+    /**
+     * @brief
+     * Inserts the key with a value built from _args, if the key isn't
+     * already there.
+     *
+     * @return
+     * The iterator to the element with the key and if it was inserted.
+     */
+    template<typename... Args>
+    FORCEINLINE std::pair<iterator, bool>
+    try_emplace(const K& _key, Args&&... _args)
+    {
+      return this->emplaceKey(_key, std::forward<Args>(_args)...);
+    }
+    template<typename... Args>
+    FORCEINLINE std::pair<iterator, bool>
+    try_emplace(K&& _key, Args&&... _args)
+    {
+      return this->emplaceKey(std::move(_key), std::forward<Args>(_args)...);
+    }
+    template<typename KeyArg, typename... Args>
+    FORCEINLINE std::pair<iterator, bool>
+    emplace(KeyArg&& _key, Args&&... _args)
+    {
+      return this->emplaceKey(std::forward<KeyArg>(_key), std::forward<Args>(_args)...);
+    }
+    FORCEINLINE std::pair<iterator, bool>
+    insert(const value_type& _value)
+    {
+      return this->emplaceKey(_value.first, _value.second);
+    }
+    FORCEINLINE std::pair<iterator, bool>
+    insert(value_type&& _value)
+    {
+      return this->emplaceKey(_value.first, std::move(_value.second));
+    }
+    /**
+     * @brief
+     * Inserts the key with the value, or assigns the value if the key is
+     * already there.
+     */
+    template<typename M>
+    std::pair<iterator, bool>
+    insert_or_assign(const K& _key, M&& _value)
+    {
+      auto result = this->emplaceKey(_key, std::forward<M>(_value));
+      if (!result.second) {
+        result.first->second = std::forward<M>(_value);
+      }
+      return result;
+    }
+
+    FORCEINLINE V&
+    operator[](const K& _key)
+    {
+      return this->emplaceKey(_key).first->second;
+    }
+    FORCEINLINE V&
+    operator[](K&& _key)
+    {
+      return this->emplaceKey(std::move(_key)).first->second;
+    }
+    /**
+     * @brief
+     * The value of a key that must be in the map.
+     */
+    FORCEINLINE V&
+    at(const K& _key)
+    {
+      iterator found = this->find(_key);
+      NF_ASSERT(found != this->end());
+      return found->second;
+    }
+    FORCEINLINE const V&
+    at(const K& _key) const
+    {
+      const_iterator found = this->find(_key);
+      NF_ASSERT(found != this->end());
+      return found->second;
+    }
+  };
+
+  /**
+   * @brief
+   * A hash set with the interface of std::unordered_set, on a
+   * TFlatHashTable.
+   */
+  template<typename K,
+           typename Hash = FlatHash<K>,
+           typename Equal = std::equal_to<K>,
+           typename Alloc = std::allocator<K>>
+  class FlatHashSet : public TFlatHashTable<FlatSetPolicy<K>, Hash, Equal, Alloc>
+  {
+    using Base = TFlatHashTable<FlatSetPolicy<K>, Hash, Equal, Alloc>;
+
+   public:
+    using typename Base::iterator;
+    using Base::Base;
+
+    FlatHashSet() = default;
+    FlatHashSet(std::initializer_list<K> _values)
+    {
+      this->reserve(_values.size());
+      for (const K& value : _values) {
+        insert(value);
+      }
+    }
+
+    FORCEINLINE std::pair<iterator, bool>
+    insert(const K& _key)
+    {
+      return this->emplaceKey(_key);
+    }
+    FORCEINLINE std::pair<iterator, bool>
+    insert(K&& _key)
+    {
+      return this->emplaceKey(std::move(_key));
+    }
+    template<typename... Args>
+    FORCEINLINE std::pair<iterator, bool>
+    emplace(Args&&... _args)
+    {
+      return this->emplaceKey(K(std::forward<Args>(_args)...));
+    }
+  };
+}
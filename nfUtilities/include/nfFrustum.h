@@ -0,0 +1,178 @@
+/************************************************************************/
+/**
+ * @file nfFrustum.h
+ * @author Mara Castellanos
+ * @date 18/10/26
+ * @brief This file defines the Frustum, the six planes of a view
+ *        projection.
+ *
+ * @bug Not bug Known.
+ */
+/************************************************************************/
+
+#pragma once
+
+#include "nfPrerequisitesUtilities.h"
+#include "nfBatchMath.h"
+#include "nfMatrix4.h"
+#include "nfSphere.h"
+#include "nfVector3.h"
+#include "nfVector4.h"
+
+namespace nfEngineSDK {
+  /**
+   * @brief
+   * The planes of a Frustum.
+   */
+  namespace FRUSTUM_PLANE {
+    enum E {
+      kLEFT = 0,
+      kRIGHT,
+      kBOTTOM,
+      kTOP,
+      kNEAR,
+      kFAR,
+      kCOUNT
+    };
+  }
+
+  /**
+   * @brief
+   * The volume a camera sees, for culling.
+   *
+   * @description
+   * The planes are Vector4f (normal, distance) with the normals normalized
+   * and pointing inside, a point p is inside a plane when
+   * dot(normal, p) + distance >= 0. It is the layout BatchMath::cullSpheres
+   * takes.
+   *
+   * With an infinite far plane the far plane has a zero normal and a
+   * positive distance, everything is inside of it.
+   */
+  class NF_UTILITIES_EXPORT Frustum
+  {
+   public:
+    /**
+     * @brief
+     * The default constructor.
+     */
+    Frustum() = default;
+    /**
+     * @brief
+     * Extracts the planes of a view projection matrix.
+     *
+     * @param _viewProjection
+     * The matrix, for row vectors (clip = point * matrix) and a depth
+     * between 0 and w, like Matrix4f::viewMatrix and
+     * Matrix4f::perspectiveMatrix make.
+     * @param _reverseZ
+     * If the depth goes from 1 at the near plane to 0 at the far one.
+     */
+    explicit Frustum(const Matrix4f& _viewProjection, bool _reverseZ = false);
+    /**
+     * @brief
+     * Frees the memory allocated on the frustum.
+     */
+    ~Frustum() = default;
+
+    /**
+     * @brief
+     * Returns one of the planes.
+     *
+     * @param _plane
+     * The plane.
+     *
+     * @return
+     * The plane as (normal, distance).
+     */
+    FORCEINLINE const Vector4f&
+    getPlane(FRUSTUM_PLANE::E _plane) const
+    {
+      return m_planes[_plane];
+    }
+    /**
+     * @brief
+     * Returns the FRUSTUM_PLANE::kCOUNT planes, in the order of
+     * FRUSTUM_PLANE.
+     */
+    FORCEINLINE const Vector4f*
+    getPlanes() const
+    {
+      return m_planes;
+    }
+
+    /**
+     * @brief
+     * Tells if a point is inside the frustum.
+     *
+     * @param _point
+     * The point.
+     *
+     * @return
+     * True if the point is inside or on a plane.
+     */
+    FORCEINLINE bool
+    contains(const Vector3f& _point) const
+    {
+      for (const Vector4f& plane : m_planes) {
+        if (plane.x * _point.x + plane.y * _point.y + plane.z * _point.z + plane.w < 0.0f) {
+          return false;
+        }
+      }
+      return true;
+    }
+    /**
+     * @brief
+     * Tells if a sphere is inside the frustum or touches it.
+     *
+     * @description
+     * Conservative, as BatchMath::cullSpheres: a sphere out of the frustum
+     * but near a corner can still give true.
+     *
+     * @param _sphere
+     * The sphere.
+     *
+     * @return
+     * False only if the sphere is completely outside a plane.
+     */
+    FORCEINLINE bool
+    intersects(const Sphere& _sphere) const
+    {
+      const Vector3f& center = _sphere.getCenter();
+      float radious = _sphere.getRadious();
+      for (const Vector4f& plane : m_planes) {
+        if (plane.x * center.x + plane.y * center.y + plane.z * center.z + plane.w < -radious) {
+          return false;
+        }
+      }
+      return true;
+    }
+    /**
+     * @brief
+     * Finds the spheres of an array that intersect the frustum, with the
+     * kernels of BatchMath.
+     *
+     * @param _spheres
+     * The spheres.
+     * @param _count
+     * The number of spheres.
+     * @param _visible
+     * Where the indices of the spheres that intersect are written, room for
+     * _count.
+     *
+     * @return
+     * The number of spheres that intersect.
+     */
+    FORCEINLINE SIZE_T
+    cull(const Sphere* _spheres, SIZE_T _count, uint32* _visible) const
+    {
+      return BatchMath::cullSpheres(m_planes, FRUSTUM_PLANE::kCOUNT, _spheres, _count, _visible);
+    }
+
+   private:
+    /*
+     * The planes, in the order of FRUSTUM_PLANE.
+     */
+    Vector4f m_planes[FRUSTUM_PLANE::kCOUNT];
+  };
+}
@@ -0,0 +1,269 @@
+/************************************************************************/
+/**
+ * @file nfIntDivisor.h
+ * @author Mara Castellanos
+ * @date 18/10/26
+ * @brief Integer divisors precomputed into a multiply and shift, for when
+ *        the same runtime value divides many numbers.
+ *
+ * @bug Not bug Known.
+ */
+/************************************************************************/
+
+#pragma once
+
+#include "nfPrerequisitesUtilities.h"
+
+namespace nfEngineSDK {
+  /**
+   * @brief
+   * An uint32 divisor precomputed into a multiply and shift.
+   *
+   * @description
+   * Hardware division costs tens of cycles and the compiler can only replace
+   * it when the divisor is known at compile time. This does the same
+   * replacement at runtime: the magic number is computed once and every
+   * division after that is a multiply, an add and two shifts. The result is
+   * exactly the same as the '/' operator, for every numerator.
+   */
+  class UIntDivisor
+  {
+   public:
+    /**
+     * @brief
+     * The type of the numbers divided.
+     */
+    using ValueType = uint32;
+
+    /**
+     * @brief
+     * The default constructor, divides by 1.
+     */
+    UIntDivisor() = default;
+    /**
+     * @brief
+     * Precomputes the divisor.
+     *
+     * @param divisor
+     * The divisor, can't be 0.
+     */
+    explicit
+    UIntDivisor(uint32 divisor) : m_divisor(divisor)
+    {
+      assertm(divisor != 0, "Division by zero");
+      uint32 l = 0;
+      while ((uint64(1) << l) < divisor) {
+        ++l;
+      }
+      m_multiplier = static_cast<uint32>(((uint64(1) << 32) *
+                                          ((uint64(1) << l) - divisor)) /
+                                         divisor + 1);
+      m_shift1 = l < 1 ? l : 1;
+      m_shift2 = l > 1 ? l - 1 : 0;
+    }
+
+    /**
+     * @brief
+     * Divides a number.
+     *
+     * @param numerator
+     * The number to divide.
+     *
+     * @return
+     * The quotient, truncated, as the '/' operator.
+     */
+    FORCEINLINE uint32
+    divide(uint32 numerator) const
+    {
+      uint32 t = static_cast<uint32>((uint64(m_multiplier) * numerator) >> 32);
+      return (t + ((numerator - t) >> m_shift1)) >> m_shift2;
+    }
+    /**
+     * @brief
+     * The residue of the division of a number.
+     *
+     * @param numerator
+     * The number to divide.
+     *
+     * @return
+     * The residue, as the '%' operator.
+     */
+    FORCEINLINE uint32
+    modulo(uint32 numerator) const
+    {
+      return numerator - divide(numerator) * m_divisor;
+    }
+
+    /**
+     * @brief
+     * The divisor this was made with.
+     */
+    FORCEINLINE uint32
+    getDivisor() const { return m_divisor; }
+    /**
+     * @brief
+     * The magic multiplier.
+     */
+    FORCEINLINE uint32
+    getMultiplier() const { return m_multiplier; }
+    /**
+     * @brief
+     * The shift applied before adding the high product.
+     */
+    FORCEINLINE uint32
+    getShift1() const { return m_shift1; }
+    /**
+     * @brief
+     * The final shift.
+     */
+    FORCEINLINE uint32
+    getShift2() const { return m_shift2; }
+
+   private:
+    /*
+     * The original divisor.
+     */
+    uint32 m_divisor = 1;
+    /*
+     * The magic multiplier.
+     */
+    uint32 m_multiplier = 1;
+    /*
+     * The first shift.
+     */
+    uint32 m_shift1 = 0;
+    /*
+     * The second shift.
+     */
+    uint32 m_shift2 = 0;
+  };
+
+  /**
+   * @brief
+   * An int32 divisor precomputed into a multiply and shift.
+   *
+   * @description
+   * Divides the magnitudes with an UIntDivisor and applies the sign after, so
+   * it gives the same results as the '/' operator (truncated towards zero).
+   * floorDivide and floorModulo are the ones to use for grid coordinates,
+   * where -1 must fall on cell -1 and not on cell 0.
+   */
+  class IntDivisor
+  {
+   public:
+    /**
+     * @brief
+     * The type of the numbers divided.
+     */
+    using ValueType = int32;
+
+    /**
+     * @brief
+     * The default constructor, divides by 1.
+     */
+    IntDivisor() = default;
+    /**
+     * @brief
+     * Precomputes the divisor.
+     *
+     * @param divisor
+     * The divisor, can't be 0.
+     */
+    explicit
+    IntDivisor(int32 divisor)
+      : m_divisor(divisor),
+        m_magnitude(divisor < 0 ? 0u - static_cast<uint32>(divisor)
+                                : static_cast<uint32>(divisor))
+    {}
+
+    /**
+     * @brief
+     * Divides a number.
+     *
+     * @param numerator
+     * The number to divide.
+     *
+     * @return
+     * The quotient, truncated towards zero, as the '/' operator.
+     */
+    FORCEINLINE int32
+    divide(int32 numerator) const
+    {
+      uint32 n = numerator < 0 ? 0u - static_cast<uint32>(numerator)
+                               : static_cast<uint32>(numerator);
+      uint32 q = m_magnitude.divide(n);
+      return (numerator ^ m_divisor) < 0 ? static_cast<int32>(0u - q)
+                                         : static_cast<int32>(q);
+    }
+    /**
+     * @brief
+     * The residue of the division of a number.
+     *
+     * @param numerator
+     * The number to divide.
+     *
+     * @return
+     * The residue, with the sign of the numerator, as the '%' operator.
+     */
+    FORCEINLINE int32
+    modulo(int32 numerator) const
+    {
+      return numerator - divide(numerator) * m_divisor;
+    }
+    /**
+     * @brief
+     * Divides a number rounding towards negative infinity.
+     *
+     * @param numerator
+     * The number to divide.
+     *
+     * @return
+     * The quotient, rounded down.
+     */
+    FORCEINLINE int32
+    floorDivide(int32 numerator) const
+    {
+      int32 q = divide(numerator);
+      int32 r = numerator - q * m_divisor;
+      return q - static_cast<int32>(r != 0 && (r ^ m_divisor) < 0);
+    }
+    /**
+     * @brief
+     * The residue of the division rounded towards negative infinity.
+     *
+     * @param numerator
+     * The number to divide.
+     *
+     * @return
+     * The residue, with the sign of the divisor.
+     */
+    FORCEINLINE int32
+    floorModulo(int32 numerator) const
+    {
+      return numerator - floorDivide(numerator) * m_divisor;
+    }
+
+    /**
+     * @brief
+     * The divisor this was made with.
+     */
+    FORCEINLINE int32
+    getDivisor() const { return m_divisor; }
+    /**
+     * @brief
+     * The divisor for the magnitudes.
+     */
+    FORCEINLINE const UIntDivisor&
+    getMagnitudeDivisor() const { return m_magnitude; }
+
+   private:
+    /*
+     * The original divisor.
+     */
+    int32 m_divisor = 1;
+    /*
+     * Divisor of the absolute values.
+     */
+    UIntDivisor m_magnitude;
+  };
+}
@@ -0,0 +1,412 @@
+/************************************************************************/
+/**
+ * @file nfLogger.h
+ * @author Mara Castellanos
+ * @date 18/10/26
+ * @brief Asynchronous logger, the call sites copy the raw arguments and a
+ *        background thread formats and writes them.
+ *
+ * @bug Not bug Known.
+ */
+/************************************************************************/
+
+#pragma once
+
+#include <atomic>
+#include <cstring>
+
+#include "nfPrerequisitesUtilities.h"
+#include "nfVectorN.h"
+
+/**
+ * The lowest level compiled in, the calls below it are removed. By default
+ * kDEBUG on debug builds and kINFO on release ones.
+ */
+#ifndef NF_LOG_MIN_LEVEL
+# if NF_DEBUG_MODE
+#   define NF_LOG_MIN_LEVEL 1
+# else
+#   define NF_LOG_MIN_LEVEL 2
+# endif
+#endif
+
+/**
+ * Declares a log category, the calls on it below _minLevel are removed.
+ */
+#define NF_LOG_CATEGORY(_name, _minLevel)                                      \
+  struct LogCategory##_name                                                    \
+  {                                                                            \
+    static constexpr const char* kNAME = #_name;                               \
+    static constexpr ::nfEngineSDK::LOG_LEVEL::E kMIN_LEVEL = _minLevel;       \
+  }
+
+/**
+ * Logs a message: NF_LOG(kINFO, General, "Loaded {} in {} s", name, seconds).
+ * Every {} on the format takes the next argument. The format must live for
+ * the whole run, a string literal usually.
+ */
+#define NF_LOG(_level, _category, ...)                                         \
+  do {                                                                         \
+    if constexpr (::nfEngineSDK::LOG_LEVEL::_level >= NF_LOG_MIN_LEVEL &&      \
+                  ::nfEngineSDK::LOG_LEVEL::_level >=                          \
+                  LogCategory##_category::kMIN_LEVEL) {                        \
+      static ::nfEngineSDK::LogSite nfLogSite(::nfEngineSDK::LOG_LEVEL::_level,\
+                                              LogCategory##_category::kNAME,   \
+                                              __FILE__,                        \
+                                              __LINE__);                       \
+      ::nfEngineSDK::Logger::log(nfLogSite, __VA_ARGS__);                      \
+    }                                                                          \
+  } while (0)
+
+#define NF_LOG_TRACE(_category, ...) NF_LOG(kTRACE, _category, __VA_ARGS__)
+#define NF_LOG_DEBUG(_category, ...) NF_LOG(kDEBUG, _category, __VA_ARGS__)
+#define NF_LOG_INFO(_category, ...) NF_LOG(kINFO, _category, __VA_ARGS__)
+#define NF_LOG_WARNING(_category, ...) NF_LOG(kWARNING, _category, __VA_ARGS__)
+#define NF_LOG_ERROR(_category, ...) NF_LOG(kERROR, _category, __VA_ARGS__)
+#define NF_LOG_FATAL(_category, ...) NF_LOG(kFATAL, _category, __VA_ARGS__)
+
+namespace nfEngineSDK {
+  /**
+   * @brief
+   * The severity of a message.
+   */
+  namespace LOG_LEVEL {
+    enum E
+    {
+      kTRACE = 0,
+      kDEBUG = 1,
+      kINFO = 2,
+      kWARNING = 3,
+      kERROR = 4,
+      /*
+       * The message is written before log() returns.
+       */
+      kFATAL = 5
+    };
+  }
+
+  /**
+   * @brief
+   * The category of the messages with no other.
+   */
+  NF_LOG_CATEGORY(General, LOG_LEVEL::kTRACE);
+
+  /**
+   * @brief
+   * A place of the code that logs, made by NF_LOG. It is also the id of
+   * the message on the queues and holds its rate limit.
+   */
+  struct LogSite
+  {
+    /**
+     * @brief
+     * Initializes the site, constant so the static of NF_LOG has no guard.
+     */
+    constexpr
+    LogSite(LOG_LEVEL::E _level, const char* _category, const char* _file, uint32 _line)
+      : level(_level),
+        category(_category),
+        file(_file),
+        line(_line) {}
+
+    LOG_LEVEL::E level;
+    const char* category;
+    const char* file;
+    uint32 line;
+    /*
+     * The rate limit: when the current second started, the messages on it
+     * and the ones dropped since the last one written.
+     */
+    std::atomic<uint64> windowStart{ 0 };
+    std::atomic<uint32> windowCount{ 0 };
+    std::atomic<uint32> suppressed{ 0 };
+  };
+
+  /**
+   * @brief
+   * How the arguments of a message are copied to the queue and read back.
+   *
+   * @description
+   * Every argument is a tag byte and its raw bytes. The strings are copied,
+   * the rest is copied as their bits.
+   */
+  class NF_UTILITIES_EXPORT LogArgument
+  {
+   public:
+    /*
+     * The tags of the arguments.
+     */
+    enum TAG
+    {
+      kINT = 0,
+      kUINT,
+      kFLOAT,
+      kDOUBLE,
+      kBOOL,
+      kCHAR,
+      kSTRING,
+      kVECTOR_FLOAT,
+      kVECTOR_INT,
+      kVECTOR_UINT,
+      kMATRIX
+    };
+
+    template<class T, class = std::enable_if_t<std::is_arithmetic<T>::value>>
+    static constexpr SIZE_T
+    size(const T&)
+    {
+      if constexpr (std::is_same<T, bool>::value || std::is_same<T, char>::value) {
+        return 2;
+      }
+      else if constexpr (std::is_same<T, float>::value) {
+        return 1 + sizeof(float);
+      }
+      else {
+        return 1 + sizeof(uint64);
+      }
+    }
+    static FORCEINLINE SIZE_T
+    size(const char* _value)
+    {
+      return 1 + sizeof(uint32) + std::strlen(_value);
+    }
+    static FORCEINLINE SIZE_T
+    size(const String& _value)
+    {
+      return 1 + sizeof(uint32) + _value.size();
+    }
+    template<typename T, uint32 N, class Derived>
+    static constexpr SIZE_T
+    size(const TVector<T, N, Derived>&)
+    {
+      return 2 + N * sizeof(T);
+    }
+    static constexpr SIZE_T
+    size(const Matrix3f&)
+    {
+      return 2 + 9 * sizeof(float);
+    }
+    static constexpr SIZE_T
+    size(const Matrix4f&)
+    {
+      return 2 + 16 * sizeof(float);
+    }
+
+    template<class T, class = std::enable_if_t<std::is_arithmetic<T>::value>>
+    static FORCEINLINE void
+    write(uint8*& _out, const T& _value)
+    {
+      if constexpr (std::is_same<T, bool>::value) {
+        _out[0] = kBOOL;
+        _out[1] = _value ? 1 : 0;
+        _out += 2;
+      }
+      else if constexpr (std::is_same<T, char>::value) {
+        _out[0] = kCHAR;
+        _out[1] = static_cast<uint8>(_value);
+        _out += 2;
+      }
+      else if constexpr (std::is_same<T, float>::value) {
+        *_out++ = kFLOAT;
+        std::memcpy(_out, &_value, sizeof(float));
+        _out += sizeof(float);
+      }
+      else if constexpr (std::is_floating_point<T>::value) {
+        double value = static_cast<double>(_value);
+        *_out++ = kDOUBLE;
+        std::memcpy(_out, &value, sizeof(double));
+        _out += sizeof(double);
+      }
+      else if constexpr (std::is_signed<T>::value) {
+        int64 value = static_cast<int64>(_value);
+        *_out++ = kINT;
+        std::memcpy(_out, &value, sizeof(int64));
+        _out += sizeof(int64);
+      }
+      else {
+        uint64 value = static_cast<uint64>(_value);
+        *_out++ = kUINT;
+        std::memcpy(_out, &value, sizeof(uint64));
+        _out += sizeof(uint64);
+      }
+    }
+    static FORCEINLINE void
+    write(uint8*& _out, const char* _value)
+    {
+      writeString(_out, _value, std::strlen(_value));
+    }
+    static FORCEINLINE void
+    write(uint8*& _out, const String& _value)
+    {
+      writeString(_out, _value.data(), _value.size());
+    }
+    template<typename T, uint32 N, class Derived>
+    static FORCEINLINE void
+    write(uint8*& _out, const TVector<T, N, Derived>& _value)
+    {
+      _out[0] = std::is_floating_point<T>::value ? kVECTOR_FLOAT :
+                std::is_signed<T>::value ? kVECTOR_INT : kVECTOR_UINT;
+      _out[1] = static_cast<uint8>(N);
+      std::memcpy(_out + 2, _value.data(), N * sizeof(T));
+      _out += 2 + N * sizeof(T);
+    }
+    static void
+    write(uint8*& _out, const Matrix3f& _value);
+    static void
+    write(uint8*& _out, const Matrix4f& _value);
+
+   private:
+    static FORCEINLINE void
+    writeString(uint8*& _out, const char* _value, SIZE_T _size)
+    {
+      uint32 size = static_cast<uint32>(_size);
+      *_out++ = kSTRING;
+      std::memcpy(_out, &size, sizeof(uint32));
+      std::memcpy(_out + sizeof(uint32), _value, _size);
+      _out += sizeof(uint32) + _size;
+    }
+  };
+
+  /**
+   * @brief
+   * Writes the messages of all the threads to a file and the console from
+   * a background thread.
+   *
+   * @description
+   * A call site only checks the rate limit, copies the format, the time and
+   * the raw arguments (Vector3f and Matrix4f included) to the queue of its
+   * thread and returns. Every thread has its own single producer queue,
+   * made on its first message, so there are no locks or system calls on
+   * the way. The background thread formats the messages with
+   * StringConversion and writes them in batches.
+   *
+   * When a queue is full the message is dropped and counted, the caller
+   * never waits; kFATAL messages are the exception, log() flushes after
+   * them. The levels and categories under their minimum are removed at
+   * compile time by NF_LOG.
+   *
+   * The messages queued keep the call site and the format by pointer
+   * until they are written, so the library they live in must not be
+   * unloaded before. DLLDynamics flushes the logger before it frees a
+   * plugin; call flush() before freeing a library any other way.
+   */
+  class NF_UTILITIES_EXPORT Logger
+  {
+   public:
+    /**
+     * @brief
+     * Opens the log file and starts the background thread.
+     *
+     * @param _path
+     * The path of the log file, empty for only the console.
+     * @param _console
+     * True to also write the messages to the standard output.
+     *
+     * @return
+     * False if the file couldn't be opened.
+     */
+    static bool
+    start(const String& _path, bool _console = true);
+
+    /**
+     * @brief
+     * Writes the messages left and stops the background thread.
+     */
+    static void
+    stop();
+
+    /**
+     * @brief
+     * Returns true while the logger is started.
+     */
+    static FORCEINLINE bool
+    isRunning()
+    {
+      return s_running.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief
+     * Waits until the messages logged before the call are written.
+     */
+    static void
+    flush();
+
+    /**
+     * @brief
+     * Sets how many messages a call site can write per second, the rest are
+     * dropped and counted on the next one written.
+     *
+     * @param _messagesPerSecond
+     * The limit, 0 for no limit.
+     */
+    static void
+    setRateLimit(uint32 _messagesPerSecond);
+
+    /**
+     * @brief
+     * Returns the messages lost because a queue was full.
+     */
+    static uint64
+    getDroppedMessages();
+
+    /**
+     * @brief
+     * Queues a message, use it with NF_LOG.
+     *
+     * @param _site
+     * The call site.
+     * @param _format
+     * The format, every {} takes the next argument.
+     * @param _args
+     * The arguments.
+     */
+    template<class... Args>
+    static void
+    log(LogSite& _site, const char* _format, const Args&... _args)
+    {
+      if (!isRunning() || !allow(_site)) {
+        return;
+      }
+      SIZE_T size = (SIZE_T(0) + ... + LogArgument::size(_args));
+      uint8* out = beginRecord(_site, _format, size);
+      if (nullptr == out) {
+        return;
+      }
+      (LogArgument::write(out, _args), ...);
+      endRecord();
+      if (LOG_LEVEL::kFATAL == _site.level) {
+        flush();
+      }
+    }
+
+    /*
+     * The bytes of the queue of every thread.
+     */
+    static const uint32 kQUEUE_SIZE = 256 * 1024;
+
+   private:
+    /*
+     * Applies the rate limit of the site.
+     */
+    static bool
+    allow(LogSite& _site);
+
+    /*
+     * Reserves a message on the queue of the thread, null if it is full.
+     */
+    static uint8*
+    beginRecord(LogSite& _site, const char* _format, SIZE_T _size);
+
+    /*
+     * Publishes the message reserved.
+     */
+    static void
+    endRecord();
+
+    /*
+     * True while the logger is started.
+     */
+    static std::atomic<bool> s_running;
+  };
+}
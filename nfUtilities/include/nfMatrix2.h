@@ -1,6 +1,6 @@
 /************************************************************************/
 /**
- * @file eeMatrix2.h
+ * @file nfMatrix2.h
  * @author Diego Castellanos
  * @date 15/09/21
  * @brief This file defines the Matrix2 in its 3 forms: floats, int32 and
@@ -12,16 +12,19 @@
 /************************************************************************/
 
 #pragma once
-#include "eePrerequisitesUtilities.h"
 
-namespace eeEngineSDK {
+#include <cstring>
+
+#include "nfPrerequisitesUtilities.h"
+
+namespace nfEngineSDK {
 /**
  * @brief
  * Matrix 2x2. Holds 2 rows and 2 columns of floats.
  * Has all the possible operations for matrices.
  * Row major
  */
-class EE_UTILITY_EXPORT Matrix2f
+class NF_UTILITIES_EXPORT Matrix2f
 {
  public:
   /**
@@ -1,6 +1,6 @@
 /************************************************************************/
 /**
- * @file eeMatrix3.h
+ * @file nfMatrix3.h
  * @author Diego Castellanos
  * @date 16/09/21
  * @brief This file defines the Matrix3 in its 3 forms: floats, int32 and
@@ -12,16 +12,19 @@
 /************************************************************************/
 
 #pragma once
-#include "eePrerequisitesUtilities.h"
 
-namespace eeEngineSDK {
+#include <cstring>
+
+#include "nfPrerequisitesUtilities.h"
+
+namespace nfEngineSDK {
 /**
  * @brief
  * Matrix 3x3. Holds 3 rows and 3 columns of floats.
  * Has all the possible operations for matrices.
  * Row major
  */
-class EE_UTILITY_EXPORT Matrix3f
+class NF_UTILITIES_EXPORT Matrix3f
 {
 public:
   /**
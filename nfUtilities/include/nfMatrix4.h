@@ -1,6 +1,6 @@
 /************************************************************************/
 /**
- * @file eeMatrix4.h
+ * @file nfMatrix4.h
  * @author Diego Castellanos
  * @date 18/09/21
  * @brief This file defines the Matrix4 in its 3 forms: floats, int32 and 
@@ -12,16 +12,19 @@
 /************************************************************************/
 
 #pragma once
-#include "eePrerequisitesUtilities.h"
 
-namespace eeEngineSDK {
+#include <cstring>
+
+#include "nfPrerequisitesUtilities.h"
+
+namespace nfEngineSDK {
 /**
  * @brief
  * Matrix 4x4. Holds 4 rows and 4 columns of floats.
  * Has all the possible operations for matrices.
  * Row major
  */
-class EE_UTILITY_EXPORT Matrix4f
+class NF_UTILITIES_EXPORT Matrix4f
 {
 public:
   /**
@@ -602,27 +605,27 @@ public:
        */
       float m_33;
     };
-#ifdef VECTOR4
-    struct
-    {
-      /*
-       * The first row.
-       */
-      Vector4f m_r0;
-      /*
-       * The second row.
-       */
-      Vector4f m_r1;
-      /*
-       * The third row.
-       */
-      Vector4f m_r2;
-      /*
-       * The fourth row.
-       */
-      Vector4f m_r3;
-    };
-#endif
+//#ifdef VECTOR4
+//    struct
+//    {
+//      /*
+//       * The first row.
+//       */
+//      Vector4f m_r0;
+//      /*
+//       * The second row.
+//       */
+//      Vector4f m_r1;
+//      /*
+//       * The third row.
+//       */
+//      Vector4f m_r2;
+//      /*
+//       * The fourth row.
+//       */
+//      Vector4f m_r3;
+//    };
+//#endif
     /*
      * The entire matrix on an array.
      */
@@ -0,0 +1,308 @@
+/************************************************************************/
+/**
+ * @file nfMeshOptimizer.h
+ * @author Mara Castellanos
+ * @date 18/10/26
+ * @brief Reorders and welds the vertices and indices of the meshes for the
+ *        GPU caches.
+ *
+ * @bug Not bug Known.
+ */
+/************************************************************************/
+
+#pragma once
+
+#include "nfPrerequisitesUtilities.h"
+#include "nfVertex.h"
+
+namespace nfEngineSDK {
+  /**
+   * @brief
+   * Post processing of indexed triangle lists, for offline import or for
+   * meshes generated at runtime.
+   *
+   * @description
+   * The usual order is: weld the duplicated vertices, reorder the triangles
+   * for the post transform cache, reorder them again by clusters against
+   * overdraw, and at last reorder the vertices by first use for the fetch.
+   * optimize() runs all of them.
+   *
+   * The index buffers can be used in place, _in and _out can be the same in
+   * every function that has both.
+   */
+  class NF_UTILITIES_EXPORT MeshOptimizer
+  {
+   public:
+    /**
+     * @brief
+     * Finds the vertices that are exactly the same.
+     *
+     * @description
+     * Vertices are hashed and compared by their bits, so 0 and -0 are
+     * different vertices.
+     *
+     * @param _vertices
+     * The vertices.
+     * @param _vertexCount
+     * The number of vertices.
+     * @param _remap
+     * Where the new index of every vertex is written, _vertexCount of them.
+     * @param _threads
+     * The number of threads to hash with, 0 for all the hardware ones.
+     *
+     * @return
+     * The number of unique vertices.
+     */
+    static SIZE_T
+    generateVertexRemap(const SimplexVertex* _vertices,
+                        SIZE_T _vertexCount,
+                        uint32* _remap,
+                        uint32 _threads = 1)
+    {
+      return generateVertexRemap(_vertices, sizeof(SimplexVertex),
+                                 _vertexCount, _remap, _threads);
+    }
+    /**
+     * @brief
+     * Finds the vertices that are exactly the same.
+     */
+    static SIZE_T
+    generateVertexRemap(const ComplexVertex* _vertices,
+                        SIZE_T _vertexCount,
+                        uint32* _remap,
+                        uint32 _threads = 1)
+    {
+      return generateVertexRemap(_vertices, sizeof(ComplexVertex),
+                                 _vertexCount, _remap, _threads);
+    }
+
+    /**
+     * @brief
+     * Moves every vertex to its new index.
+     *
+     * @param _in
+     * The vertices.
+     * @param _vertexCount
+     * The number of vertices in _in.
+     * @param _remap
+     * The new index of every vertex.
+     * @param _out
+     * Where the vertices are written, can't be _in.
+     */
+    template<class T>
+    static void
+    remapVertices(const T* _in, SIZE_T _vertexCount, const uint32* _remap, T* _out)
+    {
+      for (SIZE_T i = 0; i < _vertexCount; ++i) {
+        _out[_remap[i]] = _in[i];
+      }
+    }
+    /**
+     * @brief
+     * Changes every index to the new index of its vertex.
+     *
+     * @param _in
+     * The indices.
+     * @param _indexCount
+     * The number of indices.
+     * @param _remap
+     * The new index of every vertex.
+     * @param _out
+     * Where the indices are written.
+     */
+    static void
+    remapIndices(const uint32* _in,
+                 SIZE_T _indexCount,
+                 const uint32* _remap,
+                 uint32* _out);
+
+    /**
+     * @brief
+     * Reorders the triangles for the post transform vertex cache, with Tom
+     * Forsyth's linear speed algorithm.
+     *
+     * @description
+     * It runs on one thread: splitting the triangles in ranges loses the
+     * locality on meshes whose triangles come unordered.
+     *
+     * @param _in
+     * The indices of the triangle list.
+     * @param _indexCount
+     * The number of indices, a multiple of 3.
+     * @param _vertexCount
+     * The number of vertices.
+     * @param _out
+     * Where the reordered indices are written.
+     */
+    static void
+    optimizeVertexCache(const uint32* _in,
+                        SIZE_T _indexCount,
+                        SIZE_T _vertexCount,
+                        uint32* _out);
+
+    /**
+     * @brief
+     * Reorders clusters of triangles so the ones facing out of the mesh are
+     * drawn first, keeping the vertex cache order inside the clusters.
+     *
+     * @description
+     * The clusters are cut where a triangle misses all its vertices on the
+     * cache, so the input should come from optimizeVertexCache.
+     *
+     * @param _in
+     * The indices of the triangle list.
+     * @param _indexCount
+     * The number of indices, a multiple of 3.
+     * @param _vertices
+     * The vertices.
+     * @param _vertexCount
+     * The number of vertices.
+     * @param _out
+     * Where the reordered indices are written.
+     */
+    static void
+    optimizeOverdraw(const uint32* _in,
+                     SIZE_T _indexCount,
+                     const SimplexVertex* _vertices,
+                     SIZE_T _vertexCount,
+                     uint32* _out)
+    {
+      optimizeOverdraw(_in, _indexCount, &_vertices[0].position.x,
+                       sizeof(SimplexVertex), _vertexCount, _out);
+    }
+    /**
+     * @brief
+     * Reorders clusters of triangles so the ones facing out of the mesh are
+     * drawn first.
+     */
+    static void
+    optimizeOverdraw(const uint32* _in,
+                     SIZE_T _indexCount,
+                     const ComplexVertex* _vertices,
+                     SIZE_T _vertexCount,
+                     uint32* _out)
+    {
+      optimizeOverdraw(_in, _indexCount, &_vertices[0].position.x,
+                       sizeof(ComplexVertex), _vertexCount, _out);
+    }
+
+    /**
+     * @brief
+     * Reorders the vertices by their first use on the indices, and drops
+     * the ones that are never used.
+     *
+     * @param _vertices
+     * The vertices.
+     * @param _vertexCount
+     * The number of vertices.
+     * @param _indices
+     * The indices, they are changed to the new order.
+     * @param _indexCount
+     * The number of indices.
+     * @param _out
+     * Where the vertices are written, can't be _vertices.
+     *
+     * @return
+     * The number of vertices written.
+     */
+    template<class T>
+    static SIZE_T
+    optimizeVertexFetch(const T* _vertices,
+                        SIZE_T _vertexCount,
+                        uint32* _indices,
+                        SIZE_T _indexCount,
+                        T* _out)
+    {
+      Vector<uint32> remap;
+      SIZE_T used = generateFetchRemap(_indices, _indexCount, _vertexCount, remap);
+      for (SIZE_T i = 0; i < _vertexCount; ++i) {
+        if (kUNUSED != remap[i]) {
+          _out[remap[i]] = _vertices[i];
+        }
+      }
+      remapIndices(_indices, _indexCount, remap.data(), _indices);
+      return used;
+    }
+
+    /**
+     * @brief
+     * Runs all the steps on a mesh: weld, vertex cache, overdraw and vertex
+     * fetch.
+     *
+     * @param _vertices
+     * The vertices, replaced by the optimized ones.
+     * @param _indices
+     * The indices of the triangle list, replaced by the optimized ones.
+     * @param _threads
+     * The number of threads to weld with, 0 for all the hardware ones.
+     */
+    static void
+    optimize(Vector<SimplexVertex>& _vertices,
+             Vector<uint32>& _indices,
+             uint32 _threads = 1);
+    /**
+     * @brief
+     * Runs all the steps on a mesh: weld, vertex cache, overdraw and vertex
+     * fetch.
+     */
+    static void
+    optimize(Vector<ComplexVertex>& _vertices,
+             Vector<uint32>& _indices,
+             uint32 _threads = 1);
+
+    /**
+     * @brief
+     * The average cache miss ratio of a triangle list, the vertices
+     * transformed per triangle with a FIFO cache. From 3 (no reuse) down to
+     * about 0.5 on regular grids.
+     *
+     * @param _indices
+     * The indices of the triangle list.
+     * @param _indexCount
+     * The number of indices.
+     * @param _vertexCount
+     * The number of vertices.
+     * @param _cacheSize
+     * The number of vertices on the simulated cache.
+     *
+     * @return
+     * The misses per triangle.
+     */
+    static float
+    getACMR(const uint32* _indices,
+            SIZE_T _indexCount,
+            SIZE_T _vertexCount,
+            uint32 _cacheSize = 16);
+
+    /*
+     * The remap value of the vertices that are never used.
+     */
+    static constexpr uint32 kUNUSED = 0xFFFFFFFFu;
+
+   private:
+    static SIZE_T
+    generateVertexRemap(const void* _vertices,
+                        SIZE_T _vertexSize,
+                        SIZE_T _vertexCount,
+                        uint32* _remap,
+                        uint32 _threads);
+
+    static void
+    optimizeOverdraw(const uint32* _in,
+                     SIZE_T _indexCount,
+                     const float* _positions,
+                     SIZE_T _stride,
+                     SIZE_T _vertexCount,
+                     uint32* _out);
+
+    static SIZE_T
+    generateFetchRemap(const uint32* _indices,
+                       SIZE_T _indexCount,
+                       SIZE_T _vertexCount,
+                       Vector<uint32>& _remap);
+
+    template<class T>
+    static void
+    optimizeMesh(Vector<T>& _vertices, Vector<uint32>& _indices, uint32 _threads);
+  };
+}
@@ -0,0 +1,304 @@
+/************************************************************************/
+/**
+ * @file nfMeshlet.h
+ * @author Mara Castellanos
+ * @date 18/10/26
+ * @brief Splits the meshes in small clusters of triangles with their own
+ *        bounds, so they can be culled one by one.
+ *
+ * @bug Not bug Known.
+ */
+/************************************************************************/
+
+#pragma once
+
+#include "nfPrerequisitesUtilities.h"
+#include "nfSphere.h"
+#include "nfVector3.h"
+#include "nfVertex.h"
+
+namespace nfEngineSDK {
+  /**
+   * @brief
+   * A cluster of triangles, a range on the vertex and triangle arrays of its
+   * MeshletMesh.
+   */
+  struct Meshlet
+  {
+    /*
+     * The first vertex of the meshlet on MeshletMesh::getVertices().
+     */
+    uint32 vertexOffset;
+    /*
+     * The first triangle of the meshlet on MeshletMesh::getTriangles(), in
+     * triangles, not bytes.
+     */
+    uint32 triangleOffset;
+    /*
+     * The number of vertices.
+     */
+    uint32 vertexCount;
+    /*
+     * The number of triangles.
+     */
+    uint32 triangleCount;
+  };
+
+  /**
+   * @brief
+   * The bounds of a meshlet for the culling on the CPU.
+   *
+   * @description
+   * The normal cone has every triangle normal of the meshlet inside, its
+   * half angle is asin(coneCutoff). A cutoff of 1 means the normals are too
+   * spread and the meshlet is never culled by it.
+   */
+  struct MeshletBounds
+  {
+    /*
+     * The sphere around every vertex of the meshlet.
+     */
+    Sphere sphere;
+    /*
+     * The axis of the normal cone, normalized.
+     */
+    Vector3f coneAxis;
+    /*
+     * The sine of the half angle of the normal cone.
+     */
+    float coneCutoff;
+  };
+
+  /**
+   * @brief
+   * A mesh split in meshlets of up to kMAX_VERTICES vertices and
+   * kMAX_TRIANGLES triangles.
+   *
+   * @description
+   * Every meshlet has its list of vertices, indices to the vertex buffer of
+   * the mesh, and its triangles made of 3 uint8 indices to that list. The
+   * builder grows every meshlet from a triangle through its neighbours,
+   * taking first the ones that add less vertices, then the ones with less
+   * triangles left around and then the closest ones, so the meshlets come
+   * out round and full. Run it after MeshOptimizer::optimizeVertexCache,
+   * the order of the input is used to start new meshlets.
+   *
+   * The binary format is little endian: the header, 2 bytes per meshlet
+   * (the counts, the offsets are recomputed), 20 bytes per bounds with the
+   * cone quantized to 8 bits, the vertex indices in 16 bits when they fit
+   * and 3 bytes per triangle. The quantized cone is widened so the culling
+   * stays conservative.
+   */
+  class NF_UTILITIES_EXPORT MeshletMesh
+  {
+   public:
+    /**
+     * @brief
+     * The default constructor.
+     */
+    MeshletMesh() = default;
+    /**
+     * @brief
+     * Frees the memory allocated on the meshlet mesh.
+     */
+    ~MeshletMesh() = default;
+
+    /**
+     * @brief
+     * Splits a triangle list in meshlets, replacing the ones it had.
+     *
+     * @param _indices
+     * The indices of the triangle list.
+     * @param _indexCount
+     * The number of indices, a multiple of 3.
+     * @param _vertices
+     * The vertices.
+     * @param _vertexCount
+     * The number of vertices.
+     * @param _maxVertices
+     * The most vertices of a meshlet, from 3 to 255.
+     * @param _maxTriangles
+     * The most triangles of a meshlet, from 1 to 255.
+     */
+    void
+    build(const uint32* _indices,
+          SIZE_T _indexCount,
+          const SimplexVertex* _vertices,
+          SIZE_T _vertexCount,
+          uint32 _maxVertices = kMAX_VERTICES,
+          uint32 _maxTriangles = kMAX_TRIANGLES)
+    {
+      build(_indices, _indexCount, &_vertices[0].position,
+            sizeof(SimplexVertex), _vertexCount, _maxVertices, _maxTriangles);
+    }
+    /**
+     * @brief
+     * Splits a triangle list in meshlets, replacing the ones it had.
+     */
+    void
+    build(const uint32* _indices,
+          SIZE_T _indexCount,
+          const ComplexVertex* _vertices,
+          SIZE_T _vertexCount,
+          uint32 _maxVertices = kMAX_VERTICES,
+          uint32 _maxTriangles = kMAX_TRIANGLES)
+    {
+      build(_indices, _indexCount, &_vertices[0].position,
+            sizeof(ComplexVertex), _vertexCount, _maxVertices, _maxTriangles);
+    }
+
+    /**
+     * @brief
+     * Returns the meshlets.
+     *
+     * @return
+     * The meshlets.
+     */
+    FORCEINLINE const Vector<Meshlet>&
+    getMeshlets() const
+    {
+      return m_meshlets;
+    }
+    /**
+     * @brief
+     * Returns the bounds of the meshlets, one per meshlet.
+     *
+     * @return
+     * The bounds.
+     */
+    FORCEINLINE const Vector<MeshletBounds>&
+    getBounds() const
+    {
+      return m_bounds;
+    }
+    /**
+     * @brief
+     * Returns the vertex lists of all the meshlets, indices to the vertex
+     * buffer of the mesh.
+     *
+     * @return
+     * The vertex indices.
+     */
+    FORCEINLINE const Vector<uint32>&
+    getVertices() const
+    {
+      return m_vertices;
+    }
+    /**
+     * @brief
+     * Returns the triangles of all the meshlets, 3 indices to the vertex
+     * list of their meshlet each.
+     *
+     * @return
+     * The triangle indices.
+     */
+    FORCEINLINE const Vector<uint8>&
+    getTriangles() const
+    {
+      return m_triangles;
+    }
+
+    /**
+     * @brief
+     * Checks if all the triangles of a meshlet are facing away from a point.
+     *
+     * @param _bounds
+     * The bounds of the meshlet.
+     * @param _cameraPosition
+     * The position of the camera, in the space of the mesh.
+     *
+     * @return
+     * True if the meshlet can't be seen from the camera.
+     */
+    static FORCEINLINE bool
+    isBackfacing(const MeshletBounds& _bounds, const Vector3f& _cameraPosition)
+    {
+      Vector3f d = _bounds.sphere.getCenter() - _cameraPosition;
+      return d.dot(_bounds.coneAxis) >=
+             _bounds.coneCutoff * d.getMagnitude() + _bounds.sphere.getRadious();
+    }
+    /**
+     * @brief
+     * Finds the meshlets that are not facing away from a point.
+     *
+     * @param _cameraPosition
+     * The position of the camera, in the space of the mesh.
+     * @param _visible
+     * Where the indices of the meshlets that pass are written, room for all
+     * the meshlets.
+     *
+     * @return
+     * The number of meshlets written.
+     */
+    SIZE_T
+    cullBackfacing(const Vector3f& _cameraPosition, uint32* _visible) const;
+
+    /**
+     * @brief
+     * Writes the meshlets in the binary format.
+     *
+     * @param _out
+     * Where the bytes are appended.
+     */
+    void
+    serialize(Vector<uint8>& _out) const;
+    /**
+     * @brief
+     * Reads meshlets in the binary format, replacing the ones it had.
+     *
+     * @param _data
+     * The bytes.
+     * @param _size
+     * The number of bytes.
+     *
+     * @return
+     * False if the data is not a valid meshlet mesh of this version, the
+     * meshlet mesh is left empty then.
+     */
+    bool
+    deserialize(const uint8* _data, SIZE_T _size);
+
+    /*
+     * The default most vertices of a meshlet.
+     */
+    static const uint32 kMAX_VERTICES = 64;
+    /*
+     * The default most triangles of a meshlet.
+     */
+    static const uint32 kMAX_TRIANGLES = 124;
+    /*
+     * The version of the binary format written.
+     */
+    static const uint32 kFORMAT_VERSION = 1;
+
+   private:
+    void
+    build(const uint32* _indices,
+          SIZE_T _indexCount,
+          const Vector3f* _positions,
+          SIZE_T _stride,
+          SIZE_T _vertexCount,
+          uint32 _maxVertices,
+          uint32 _maxTriangles);
+
+    void
+    clear();
+
+    /*
+     * The meshlets.
+     */
+    Vector<Meshlet> m_meshlets;
+    /*
+     * The bounds of every meshlet.
+     */
+    Vector<MeshletBounds> m_bounds;
+    /*
+     * The vertex lists of the meshlets.
+     */
+    Vector<uint32> m_vertices;
+    /*
+     * The triangles of the meshlets.
+     */
+    Vector<uint8> m_triangles;
+  };
+}
@@ -80,7 +80,7 @@
 #elif defined (_MSC_VER)
 #   define NF_COMPILER NF_COMPILER_MSVC
 #   define NF_COMP_VER _MSC_VER
-#   define NF_THREADLOCAL __declspec
+#   define NF_THREADLOCAL __declspec(thread)
 #   define NF_STDCALL __stdcall
 #   define NF_CDECL __cdecl
 #   define NF_FALLTHROUHG
@@ -117,6 +117,24 @@
 # endif
 #endif
 
+/************************************************************************/
+/**
+ * If the code is being run by the compiler, for the constexpr functions that
+ * use the library version at run time. Without the builtin it is always
+ * false and those functions can't be used on constant expressions.
+ */
+ /************************************************************************/
+#if defined(__has_builtin)
+# if __has_builtin(__builtin_is_constant_evaluated)
+#   define NF_IS_CONSTANT_EVALUATED() __builtin_is_constant_evaluated()
+# endif
+#elif NF_COMPILER == NF_COMPILER_MSVC && NF_COMP_VER >= 1925
+# define NF_IS_CONSTANT_EVALUATED() __builtin_is_constant_evaluated()
+#endif
+#if !defined(NF_IS_CONSTANT_EVALUATED)
+# define NF_IS_CONSTANT_EVALUATED() false
+#endif
+
 /************************************************************************/
 /**
  * Finds the current platform
@@ -126,7 +144,7 @@
 # define NF_PLATFORM NF_PLATFORM_WIN32
 #elif defined (__APPLE_CC__ )
 # define NF_PLATFORM NF_PLATFORM_OSX
-#elif defined (__ORBIS__)
+#elif defined (__ORBIS__) || defined (__linux__)
 # define NF_PLATFORM NF_PLATFORM_LINUX
 #endif
 
@@ -141,6 +159,106 @@
 #  define NF_ARCH_TYPE NF_ARCHITECTURE_X86_32
 #endif
 
+/************************************************************************/
+/**
+ * SIMD instruction sets enabled for this compilation
+ */
+ /************************************************************************/
+#if defined(__SSE2__) || defined(_M_X64) || \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+# define NF_SIMD_SSE2 1
+#else
+# define NF_SIMD_SSE2 0
+#endif
+
+#if defined(__SSE4_1__) || defined(__AVX__)
+# define NF_SIMD_SSE4_1 1
+#else
+# define NF_SIMD_SSE4_1 0
+#endif
+
+#if defined(__AVX2__)
+# define NF_SIMD_AVX2 1
+#else
+# define NF_SIMD_AVX2 0
+#endif
+
+#if defined(__F16C__) || (defined(_MSC_VER) && defined(__AVX2__))
+# define NF_SIMD_F16C 1
+#else
+# define NF_SIMD_F16C 0
+#endif
+
+#if defined(__FMA__) || (defined(_MSC_VER) && defined(__AVX2__))
+# define NF_SIMD_FMA 1
+#else
+# define NF_SIMD_FMA 0
+#endif
+
+/************************************************************************/
+/**
+ * Runtime CPU dispatch. The batch kernels are compiled once per instruction
+ * set tier, with NF_TARGET_BEGIN/NF_TARGET_END around the code of the tier,
+ * and CPUFeatures picks the best one the CPU runs at startup. Define
+ * NF_CPU_DISPATCH to 0 on the project to only use the tiers enabled for
+ * the build, as the NF_SIMD_* defines above.
+ */
+ /************************************************************************/
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+# define NF_ARCH_X86 1
+#else
+# define NF_ARCH_X86 0
+#endif
+
+#ifndef NF_CPU_DISPATCH
+# define NF_CPU_DISPATCH NF_ARCH_X86
+#endif
+
+#define NF_PRAGMA(x) _Pragma(#x)
+
+#if NF_COMPILER == NF_COMPILER_CLANG
+# define NF_TARGET_BEGIN(_isa)                                                 \
+  NF_PRAGMA(clang attribute push(__attribute__((target(_isa))),                \
+                                 apply_to = function))
+# define NF_TARGET_END _Pragma("clang attribute pop")
+#elif NF_COMPILER == NF_COMPILER_GNUC
+# define NF_TARGET_BEGIN(_isa) _Pragma("GCC push_options") NF_PRAGMA(GCC target(_isa))
+# define NF_TARGET_END _Pragma("GCC pop_options")
+#else
+/*
+ * MSVC compiles the intrinsics of every set without options. The tier files
+ * are not built with /arch either, so the inline functions of the headers
+ * they include stay on the baseline instruction set.
+ */
+# define NF_TARGET_BEGIN(_isa)
+# define NF_TARGET_END
+#endif
+
+/************************************************************************/
+/**
+ * Deterministic math, for simulations that must give the same bits on
+ * every compiler and CPU (lockstep networking, replays). Define it to 1 on
+ * the project to route the transcendental functions of PlatformMath through
+ * DeterministicMath and to stop the compiler from fusing multiplies and adds.
+ */
+ /************************************************************************/
+#ifndef NF_MATH_DETERMINISTIC
+# define NF_MATH_DETERMINISTIC 0
+#endif
+
+#if NF_MATH_DETERMINISTIC
+# if NF_ARCH_TYPE == NF_ARCHITECTURE_X86_32 && !NF_SIMD_SSE2
+#   error "NF_MATH_DETERMINISTIC needs SSE2, x87 keeps extra precision."
+# endif
+# if NF_COMPILER == NF_COMPILER_MSVC
+#   pragma fp_contract(off)
+# elif NF_COMPILER == NF_COMPILER_CLANG
+#   pragma clang fp contract(off)
+# elif NF_COMPILER == NF_COMPILER_GNUC
+#   pragma GCC optimize("fp-contract=off")
+# endif
+#endif
+
 /************************************************************************/
 /**
  * Memory Alignment macros
@@ -290,6 +408,8 @@
 
 # pragma warning(disable : 4251)
 
+# pragma warning(disable : 4275)
+
 # pragma warning(disable : 4503)
 
 #endif
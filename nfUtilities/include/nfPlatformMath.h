@@ -13,8 +13,14 @@
 
 #pragma once
 
+#include <type_traits>
+
 #include "nfPrerequisitesUtilities.h"
 
+#if NF_MATH_DETERMINISTIC
+# include "nfDeterministicMath.h"
+#endif
+
 namespace nfEngineSDK {
   /**
    * @brief
@@ -453,7 +459,7 @@ namespace nfEngineSDK {
      * The degrees result.
      */
     template<typename T>
-    static FORCEINLINE T
+    static FORCEINLINE constexpr T
     radToDeg(const T& _radian);
     /**
      * @brief
@@ -469,7 +475,7 @@ namespace nfEngineSDK {
      * The radians result.
      */
     template<typename T>
-    static FORCEINLINE T
+    static FORCEINLINE constexpr T
     degToRad(const T& _degree);
   
     /***************************************************************************/
@@ -530,12 +536,78 @@ namespace nfEngineSDK {
     template<typename T>
     static FORCEINLINE T
     pow(T _base, T _power);
+    /**
+     * @brief
+     * The exponential operation.
+     *
+     * @description
+     * Returns e raised to the value.
+     *
+     * @param _value
+     * The exponent of e.
+     *
+     * @return
+     * The result of the exponential operation.
+     */
+    template<typename T>
+    static FORCEINLINE T
+    exp(T _value);
+    /**
+     * @brief
+     * The power operation, for a power known at compile time.
+     *
+     * @description
+     * Unrolled into multiplications by repeated squaring, so pow<2>(x) is
+     * x * x and pow<-1>(x) is 1 / x.
+     *
+     * @param _base
+     * The number to be powered.
+     *
+     * @return
+     * The result of the power operation.
+     */
+    template<int32 Power, typename T>
+    static FORCEINLINE T
+    pow(T _base);
+    /**
+     * @brief
+     * The base 2 exponential operation.
+     *
+     * @description
+     * Returns 2 raised to the value.
+     *
+     * @param _value
+     * The exponent of 2.
+     *
+     * @return
+     * The result of the exponential operation.
+     */
+    template<typename T>
+    static FORCEINLINE T
+    exp2(T _value);
+    /**
+     * @brief
+     * The natural logarithmic operation.
+     *
+     * @description
+     * Returns the logarithm of a number in base e.
+     *
+     * @param _value
+     * The number to be log.
+     *
+     * @return
+     * The result of the logarthmic operation.
+     */
+    template<typename T>
+    static FORCEINLINE T
+    log(T _value);
     /**
      * @brief
      * The logarithmic operation.
      *
      * @description
-     * Returns the logarithm of a number with a base.
+     * Returns the logarithm of a number with a base. It's a division of two
+     * logarithms, use log2, log10 or log<Base> when the base is known.
      *
      * @param _value
      * The number to be log.
@@ -547,7 +619,50 @@ namespace nfEngineSDK {
      */
     template<typename T>
     static FORCEINLINE T
-    log(T _value, T _base = kEuler);
+    log(T _value, T _base);
+    /**
+     * @brief
+     * The logarithmic operation, for a base known at compile time.
+     *
+     * @description
+     * Resolves to log2 or log10 for those bases, and to the natural logarithm
+     * times a constant for the rest.
+     *
+     * @param _value
+     * The number to be log.
+     *
+     * @return
+     * The result of the logarthmic operation.
+     */
+    template<uint32 Base, typename T>
+    static FORCEINLINE T
+    log(T _value);
+    /**
+     * @brief
+     * The base 2 logarithmic operation.
+     *
+     * @param _value
+     * The number to be log.
+     *
+     * @return
+     * The result of the logarthmic operation.
+     */
+    template<typename T>
+    static FORCEINLINE T
+    log2(T _value);
+    /**
+     * @brief
+     * The base 10 logarithmic operation.
+     *
+     * @param _value
+     * The number to be log.
+     *
+     * @return
+     * The result of the logarthmic operation.
+     */
+    template<typename T>
+    static FORCEINLINE T
+    log10(T _value);
   
     /**
      * @brief
@@ -581,7 +696,7 @@ namespace nfEngineSDK {
      * The number rounded.
      */
     template<typename T>
-    static FORCEINLINE T
+    static FORCEINLINE constexpr T
     floor(T _val);
     /**
      * @brief
@@ -598,7 +713,7 @@ namespace nfEngineSDK {
      * The number rounded.
      */
     template<typename T>
-    static FORCEINLINE T
+    static FORCEINLINE constexpr T
     ceil(T _val);
   
     /**
@@ -615,14 +730,15 @@ namespace nfEngineSDK {
      * The absolute value.
      */
     template<typename T>
-    static FORCEINLINE T
+    static FORCEINLINE constexpr T
     abs(T _val);
     /**
      * @brief
      * The sign of a value.
      *
      * @description
-     * Returns the sign of the number passed as a 1.0f or -1.0f.
+     * Returns the sign of the number passed as a 1.0f or -1.0f, -1.0f for
+     * -0.0f like std::copysign.
      *
      * @param _val
      * The number to know its sing.
@@ -631,7 +747,7 @@ namespace nfEngineSDK {
      * The sign value.
      */
     template<typename T>
-    static FORCEINLINE T
+    static FORCEINLINE constexpr T
     sign(T _val);
     /**
      * @brief
@@ -650,7 +766,7 @@ namespace nfEngineSDK {
      * The absolute value.
      */
     template<typename T>
-    static FORCEINLINE T
+    static FORCEINLINE constexpr T
     copysign(T _mag, T _sgn);
   
     /**
@@ -669,7 +785,7 @@ namespace nfEngineSDK {
      * The maximum value between the first and the second value.
      */
     template<typename T>
-    static FORCEINLINE T
+    static FORCEINLINE constexpr T
     max(const T& _val1, const T& _val2);
     /**
      * @brief
@@ -687,7 +803,7 @@ namespace nfEngineSDK {
      * The minimum value between the first and the second value.
      */
     template<typename T>
-    static FORCEINLINE T
+    static FORCEINLINE constexpr T
     min(const T& _val1, const T& _val2);
 
     /**
@@ -1188,79 +1304,79 @@ namespace nfEngineSDK {
      * @brief
      * The approximate value of pi.
      */
-    static const float kPI;
+    static constexpr float kPI = 3.14159265358979323846f;
     /**
      * @brief
      * Pi divided by 180.
      */
-    static const float kPI_OVER_180;
+    static constexpr float kPI_OVER_180 = kPI / 180.0f;
     /**
      * @brief
      * 180 divided by pi.
      */
-    static const float k180_OVER_PI;
+    static constexpr float k180_OVER_PI = 180.0f / kPI;
     /**
      * @brief
      * Pi times 2.
      */
-    static const float k2_PI;
+    static constexpr float k2_PI = kPI * 2.0f;
     /**
      * @brief
      * Pi over 2.
      */
-    static const float kPI_OVER_2;
+    static constexpr float kPI_OVER_2 = kPI / 2.0f;
   
     /**
      * @brief
      * The value of e.
      */
-    static const float kEuler;
+    static constexpr float kEuler = 2.71828182845904523536f;
   
     /**
      * @brief
      * The maximum float possible.
      */
-    static const float kMAX_FLOAT;
+    static constexpr float kMAX_FLOAT = std::numeric_limits<float>::max();
     /**
      * @brief
      * The minimum float possible.
      */
-    static const float kMIN_FLOAT;
+    static constexpr float kMIN_FLOAT = std::numeric_limits<float>::min();
     /**
      * @brief
      * The maximum double possible.
      */
-    static const double kMAX_DOUBLE;
+    static constexpr double kMAX_DOUBLE = std::numeric_limits<double>::max();
     /**
      * @brief
      * The minimum long double possible.
      */
-    static const long double kMIN_LONG_DOUBLE;
+    static constexpr long double kMIN_LONG_DOUBLE = std::numeric_limits<long double>::min();
     /**
      * @brief
      * The maximum long double possible.
      */
-    static const long double kMAX_LONG_DOUBLE;
+    static constexpr long double kMAX_LONG_DOUBLE = std::numeric_limits<long double>::max();
     /**
      * @brief
      * The minimum double possible.
      */
-    static const double kMIN_DOUBLE;
+    static constexpr double kMIN_DOUBLE = std::numeric_limits<double>::min();
     /**
      * @brief
      * The minimum integer of 32 bits possible.
      */
-    static const int32 kMIN_INT;
+    static constexpr int32 kMIN_INT = std::numeric_limits<int32>::min();
     /**
      * @brief
      * The maximum integer of 32 bits possible.
      */
-    static const int32 kMAX_INT;
+    static constexpr int32 kMAX_INT = std::numeric_limits<int32>::max();
     /**
      * @brief
      * The maximum integer of 32 bits possible.
      */
-    static const uint32 kMAX_UINT;
+    static constexpr uint32 kMAX_UINT = std::numeric_limits<uint32>::max();
   };
   
   
@@ -1268,37 +1384,52 @@ namespace nfEngineSDK {
   FORCEINLINE T
   PlatformMath::cos(const T& _radian)
   {
+#if NF_MATH_DETERMINISTIC
+    using R = DeterministicReal<T>;
+    return static_cast<T>(DeterministicMath::cos(static_cast<R>(_radian)));
+#else
     return std::cos(_radian);
+#endif
   }
   template<typename T>
   FORCEINLINE T 
   PlatformMath::cosd(const T& _degree)
   {
-    return std::cos(degToRad(_degree));
+    return cos(degToRad(_degree));
   }
   template<typename T>
   FORCEINLINE T 
   PlatformMath::sin(const T& _radian)
   {
+#if NF_MATH_DETERMINISTIC
+    using R = DeterministicReal<T>;
+    return static_cast<T>(DeterministicMath::sin(static_cast<R>(_radian)));
+#else
     return std::sin(_radian);
+#endif
   }
   template<typename T>
   FORCEINLINE T
   PlatformMath::sind(const T& _degree)
   {
-    return std::sin(degToRad(_degree));
+    return sin(degToRad(_degree));
   }
   template<typename T>
   FORCEINLINE T 
   PlatformMath::tan(const T& _radian)
   {
+#if NF_MATH_DETERMINISTIC
+    using R = DeterministicReal<T>;
+    return static_cast<T>(DeterministicMath::tan(static_cast<R>(_radian)));
+#else
     return std::tan(_radian);
+#endif
   }
   template<typename T>
   FORCEINLINE T
   PlatformMath::tand(const T& _degree)
   {
-    return std::tan(degToRad(_degree));
+    return tan(degToRad(_degree));
   }
   template<typename T>
   FORCEINLINE T 
@@ -1341,43 +1472,63 @@ namespace nfEngineSDK {
   FORCEINLINE T 
   PlatformMath::acos(const T& _value)
   {
+#if NF_MATH_DETERMINISTIC
+    using R = DeterministicReal<T>;
+    return static_cast<T>(DeterministicMath::acos(static_cast<R>(_value)));
+#else
     return std::acos(_value);
+#endif
   }
   template<typename T>
   FORCEINLINE T
   PlatformMath::acosd(const T& _value)
   {
-    return degToRad(std::acos(_value));
+    return degToRad(acos(_value));
   }
   template<typename T>
   FORCEINLINE T 
   PlatformMath::asin(const T& _value)
   {
+#if NF_MATH_DETERMINISTIC
+    using R = DeterministicReal<T>;
+    return static_cast<T>(DeterministicMath::asin(static_cast<R>(_value)));
+#else
     return std::asin(_value);
+#endif
   }
   template<typename T>
   FORCEINLINE T
   PlatformMath::asind(const T& _value)
   {
-    return degToRad(std::asin(_value));
+    return degToRad(asin(_value));
   }
   template<typename T>
   FORCEINLINE T 
   PlatformMath::atan(const T& _value)
   {
+#if NF_MATH_DETERMINISTIC
+    using R = DeterministicReal<T>;
+    return static_cast<T>(DeterministicMath::atan(static_cast<R>(_value)));
+#else
     return std::atan(_value);
+#endif
   }
   template<typename T>
   FORCEINLINE T 
   PlatformMath::atan2(const T& Y, const T& X)
   {
+#if NF_MATH_DETERMINISTIC
+    using R = DeterministicReal<T>;
+    return static_cast<T>(DeterministicMath::atan2(static_cast<R>(Y), static_cast<R>(X)));
+#else
     return std::atan2(Y, X);
+#endif
   }
   template<typename T>
   FORCEINLINE T
   PlatformMath::atand(const T& _value)
   {
-    return degToRad(std::atan(_value));
+    return degToRad(atan(_value));
   }
   template<typename T>
   FORCEINLINE T 
@@ -1417,13 +1568,13 @@ namespace nfEngineSDK {
   }
   
   template<typename T>
-  FORCEINLINE T 
+  FORCEINLINE constexpr T
   PlatformMath::radToDeg(const T& _radian)
   {
     return _radian * k180_OVER_PI;
   }
   template<typename T>
-  FORCEINLINE T 
+  FORCEINLINE constexpr T
   PlatformMath::degToRad(const T& _degree)
   {
     return _degree * kPI_OVER_180;
@@ -1439,19 +1590,129 @@ namespace nfEngineSDK {
   FORCEINLINE T 
   PlatformMath::sqrt(T _val)
   {
+#if NF_MATH_DETERMINISTIC
+    using R = DeterministicReal<T>;
+    return static_cast<T>(DeterministicMath::sqrt(static_cast<R>(_val)));
+#else
     return std::sqrt(_val);
+#endif
   }
   template<typename T>
   FORCEINLINE T 
   PlatformMath::pow(T _base, T _power)
   {
+#if NF_MATH_DETERMINISTIC
+    using R = DeterministicReal<T>;
+    return static_cast<T>(DeterministicMath::pow(static_cast<R>(_base), static_cast<R>(_power)));
+#else
     return std::pow(_base, _power);
+#endif
+  }
+  template<typename T>
+  FORCEINLINE T 
+  PlatformMath::exp(T _value)
+  {
+#if NF_MATH_DETERMINISTIC
+    using R = DeterministicReal<T>;
+    return static_cast<T>(DeterministicMath::exp(static_cast<R>(_value)));
+#else
+    return std::exp(_value);
+#endif
+  }
+  template<int32 Power, typename T>
+  FORCEINLINE T
+  PlatformMath::pow(T _base)
+  {
+    if constexpr (Power < 0) {
+      return T(1) / pow<-Power>(_base);
+    }
+    else if constexpr (Power == 0) {
+      return T(1);
+    }
+    else if constexpr (Power == 1) {
+      return _base;
+    }
+    else {
+      T half = pow<Power / 2>(_base);
+      if constexpr (Power % 2 == 0) {
+        return half * half;
+      }
+      else {
+        return half * half * _base;
+      }
+    }
+  }
+  template<typename T>
+  FORCEINLINE T
+  PlatformMath::exp2(T _value)
+  {
+#if NF_MATH_DETERMINISTIC
+    using R = DeterministicReal<T>;
+    return static_cast<T>(DeterministicMath::exp2(static_cast<R>(_value)));
+#else
+    return std::exp2(_value);
+#endif
+  }
+  template<typename T>
+  FORCEINLINE T
+  PlatformMath::log(T _value)
+  {
+#if NF_MATH_DETERMINISTIC
+    using R = DeterministicReal<T>;
+    return static_cast<T>(DeterministicMath::log(static_cast<R>(_value)));
+#else
+    return std::log(_value);
+#endif
+  }
+  template<uint32 Base, typename T>
+  FORCEINLINE T
+  PlatformMath::log(T _value)
+  {
+    static_assert(Base > 1, "The base of a logarithm must be bigger than 1");
+    if constexpr (Base == 2) {
+      return log2(_value);
+    }
+    else if constexpr (Base == 10) {
+      return log10(_value);
+    }
+    else {
+      return log(_value) / log(static_cast<T>(Base));
+    }
+  }
+  template<typename T>
+  FORCEINLINE T
+  PlatformMath::log2(T _value)
+  {
+#if NF_MATH_DETERMINISTIC
+    using R = DeterministicReal<T>;
+    return static_cast<T>(DeterministicMath::log2(static_cast<R>(_value)));
+#else
+    return std::log2(_value);
+#endif
+  }
+  template<typename T>
+  FORCEINLINE T
+  PlatformMath::log10(T _value)
+  {
+#if NF_MATH_DETERMINISTIC
+    using R = DeterministicReal<T>;
+    return static_cast<T>(DeterministicMath::log(static_cast<R>(_value)) /
+                          DeterministicMath::log(static_cast<R>(10)));
+#else
+    return std::log10(_value);
+#endif
   }
   template<typename T>
   FORCEINLINE T 
   PlatformMath::log(T _value, T _base)
   {
+#if NF_MATH_DETERMINISTIC
+    using R = DeterministicReal<T>;
+    return static_cast<T>(DeterministicMath::log(static_cast<R>(_value)) /
+                          DeterministicMath::log(static_cast<R>(_base)));
+#else
     return std::log(_value) / std::log(_base);
+#endif
   }
   
   template<typename T>
@@ -1460,46 +1721,103 @@ namespace nfEngineSDK {
   {
     return std::round(_val);
   }
+  /*
+   * At run time floor, ceil, abs, sign and copysign are the ones of the
+   * library. The versions for the compiler give the same results, signed
+   * zeros included, except for the sign of -0.0, that can't be seen there.
+   */
   template<typename T>
-  FORCEINLINE T 
+  FORCEINLINE constexpr T
   PlatformMath::floor(T _val)
   {
-    return std::floor(_val);
+    if constexpr (std::is_integral<T>::value) {
+      return _val;
+    }
+    else {
+      if (!NF_IS_CONSTANT_EVALUATED()) {
+        return std::floor(_val);
+      }
+      /*
+       * Over 2^52 every floating point is already an integer (NaN and
+       * infinity fall here too), and the zeros keep their sign.
+       */
+      if (!(abs(_val) < T(4503599627370496.0)) || _val == T(0)) {
+        return _val;
+      }
+      T truncated = static_cast<T>(static_cast<int64>(_val));
+      return truncated > _val ? truncated - T(1) : truncated;
+    }
   }
   template<typename T>
-  FORCEINLINE T 
+  FORCEINLINE constexpr T
   PlatformMath::ceil(T _val)
   {
-    return std::ceil(_val);
+    if constexpr (std::is_integral<T>::value) {
+      return _val;
+    }
+    else {
+      if (!NF_IS_CONSTANT_EVALUATED()) {
+        return std::ceil(_val);
+      }
+      if (!(abs(_val) < T(4503599627370496.0)) || _val == T(0)) {
+        return _val;
+      }
+      /*
+       * The negative values that round to zero give -0.
+       */
+      if (_val > T(-1) && _val < T(0)) {
+        return -T(0);
+      }
+      T truncated = static_cast<T>(static_cast<int64>(_val));
+      return truncated < _val ? truncated + T(1) : truncated;
+    }
   }
   
   template<typename T>
-  FORCEINLINE T 
+  FORCEINLINE constexpr T
   PlatformMath::abs(T _val)
   {
-    return std::abs(_val);
+    if constexpr (std::is_floating_point<T>::value) {
+      if (!NF_IS_CONSTANT_EVALUATED()) {
+        return std::fabs(_val);
+      }
+      return _val < T(0) ? -_val : (_val == T(0) ? T(0) : _val);
+    }
+    else {
+      return _val < T(0) ? -_val : _val;
+    }
   }
   template<typename T>
-  FORCEINLINE T
+  FORCEINLINE constexpr T
   PlatformMath::sign(T _val)
   {
-    return abs(_val) / _val;
+    if constexpr (std::is_floating_point<T>::value) {
+      if (!NF_IS_CONSTANT_EVALUATED()) {
+        return std::copysign(T(1), _val);
+      }
+    }
+    return _val < T(0) ? T(-1) : T(1);
   }
   template<typename T>
-  FORCEINLINE T
+  FORCEINLINE constexpr T
   PlatformMath::copysign(T _mag, T _sgn)
   {
+    if constexpr (std::is_floating_point<T>::value) {
+      if (!NF_IS_CONSTANT_EVALUATED()) {
+        return std::copysign(_mag, _sgn);
+      }
+    }
     return abs(_mag) * sign(_sgn);
   }
   
   template<typename T>
-  FORCEINLINE T
+  FORCEINLINE constexpr T
   PlatformMath::max(const T& _val1, const T& _val2)
   {
     return _val1 > _val2 ? _val1 : _val2;
   }
   template<typename T>
-  FORCEINLINE T
+  FORCEINLINE constexpr T
   PlatformMath::min(const T& _val1, const T& _val2)
   {
     return _val1 < _val2 ? _val1 : _val2;
@@ -0,0 +1,296 @@
+/************************************************************************/
+/**
+ * @file nfProfiler.h
+ * @author Mara Castellanos
+ * @date 18/10/26
+ * @brief Scoped CPU profiler with per thread event buffers, frame timings
+ *        and Chrome trace export.
+ *
+ * @bug Not bug Known.
+ */
+/************************************************************************/
+
+#pragma once
+
+#include <atomic>
+
+#include "nfPrerequisitesUtilities.h"
+#include "nfTime.h"
+
+/**
+ * Define it to 0 on the project to compile out every NF_PROFILE_SCOPE.
+ */
+#ifndef NF_PROFILE_ENABLED
+# define NF_PROFILE_ENABLED 1
+#endif
+
+#define NF_PROFILE_CONCAT_IMPL(_a, _b) _a##_b
+#define NF_PROFILE_CONCAT(_a, _b) NF_PROFILE_CONCAT_IMPL(_a, _b)
+
+#if NF_PROFILE_ENABLED
+/**
+ * Measures the rest of the scope. The name must live for the whole run, a
+ * string literal usually.
+ */
+# define NF_PROFILE_SCOPE(_name)                                               \
+  ::nfEngineSDK::ProfileScope NF_PROFILE_CONCAT(nfProfileScope, __COUNTER__)(_name)
+/**
+ * Measures the rest of the function.
+ */
+# define NF_PROFILE_FUNCTION() NF_PROFILE_SCOPE(__FUNCTION__)
+#else
+# define NF_PROFILE_SCOPE(_name)
+# define NF_PROFILE_FUNCTION()
+#endif
+
+namespace nfEngineSDK {
+  /**
+   * @brief
+   * A scope measured by a thread.
+   */
+  struct ProfileEvent
+  {
+    /*
+     * The name given to the scope.
+     */
+    const char* name;
+    /*
+     * The Time::now() when the scope started and ended.
+     */
+    uint64 begin;
+    uint64 end;
+    /*
+     * The number of scopes open around this one on its thread.
+     */
+    uint32 depth;
+    /*
+     * The index of the thread on the profiler.
+     */
+    uint32 thread;
+  };
+
+  /**
+   * @brief
+   * The time of a scope on a frame, added for all the times it ran under
+   * the same parent.
+   */
+  struct ProfileNode
+  {
+    /*
+     * The name of the scope.
+     */
+    const char* name;
+    /*
+     * The index of the parent node, kNO_PARENT on the scopes at the top of
+     * a thread.
+     */
+    uint32 parent;
+    /*
+     * The number of parents.
+     */
+    uint32 depth;
+    /*
+     * The index of the thread on the profiler.
+     */
+    uint32 thread;
+    /*
+     * The times the scope ran.
+     */
+    uint32 calls;
+    /*
+     * The seconds the scope took, adding all the calls.
+     */
+    double seconds;
+
+    /*
+     * The parent of the top nodes.
+     */
+    static const uint32 kNO_PARENT = 0xFFFFFFFFu;
+  };
+
+  /**
+   * @brief
+   * Collects the scopes measured by all the threads.
+   *
+   * @description
+   * Every thread writes its events to its own ring buffer, with no locks;
+   * the buffer is made on the first event of the thread. endFrame(), called
+   * once per frame by the main thread, takes the events of all the buffers.
+   *
+   * The scopes only record while a capture is running, outside of it a
+   * scope costs a load and a branch, so the instrumentation can stay on the
+   * release builds and frames are captured on demand:
+   *
+   *   Profiler::beginCapture(120);
+   *   ...
+   *   Profiler::endFrame();              // every frame
+   *   ...
+   *   if (!Profiler::isCapturing()) {
+   *     Profiler::exportChromeTrace("frames.json");
+   *   }
+   *
+   * The Chrome trace JSON opens on chrome://tracing and on Perfetto.
+   * A buffer that fills before endFrame() drops the new events, see
+   * getDroppedEvents().
+   */
+  class NF_UTILITIES_EXPORT Profiler
+  {
+   public:
+    /**
+     * @brief
+     * Returns true if the scopes are being recorded.
+     */
+    static FORCEINLINE bool
+    isCapturing()
+    {
+      return s_capturing.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief
+     * Starts recording, it clears the last capture.
+     *
+     * @param _frames
+     * The number of endFrame() to record, 0 to record until endCapture().
+     */
+    static void
+    beginCapture(uint32 _frames = 0);
+
+    /**
+     * @brief
+     * Stops recording, the events stay until the next capture.
+     */
+    static void
+    endCapture();
+
+    /**
+     * @brief
+     * Ends a frame: takes the events of all the threads and adds up the
+     * timings of the frame.
+     */
+    static void
+    endFrame();
+
+    /**
+     * @brief
+     * Names the calling thread on the exported traces.
+     *
+     * @param _name
+     * The name.
+     */
+    static void
+    setThreadName(const String& _name);
+
+    /**
+     * @brief
+     * Returns the timings of the last frame captured, ordered depth first.
+     */
+    static Vector<ProfileNode>
+    getLastFrame();
+
+    /**
+     * @brief
+     * Returns the events of the capture.
+     */
+    static Vector<ProfileEvent>
+    getEvents();
+
+    /**
+     * @brief
+     * Returns the events lost because a buffer was full.
+     */
+    static uint64
+    getDroppedEvents();
+
+    /**
+     * @brief
+     * Writes the capture as a Chrome trace JSON.
+     *
+     * @param _path
+     * The path of the file.
+     *
+     * @return
+     * False if the file couldn't be written.
+     */
+    static bool
+    exportChromeTrace(const String& _path);
+
+    /**
+     * @brief
+     * Starts a scope on the calling thread, for ProfileScope.
+     *
+     * @return
+     * The time now.
+     */
+    static uint64
+    enterScope();
+
+    /**
+     * @brief
+     * Ends the last scope started on the calling thread, for ProfileScope.
+     *
+     * @param _name
+     * The name of the scope.
+     * @param _begin
+     * What enterScope() returned.
+     */
+    static void
+    exitScope(const char* _name, uint64 _begin);
+
+    /*
+     * The events a thread can hold between two endFrame().
+     */
+    static const uint32 kEVENTS_PER_THREAD = 16384;
+
+   private:
+    /*
+     * True while the scopes are recorded.
+     */
+    static std::atomic<bool> s_capturing;
+  };
+
+  /**
+   * @brief
+   * Measures its life on the profiler, use it with NF_PROFILE_SCOPE.
+   */
+  class ProfileScope
+  {
+   public:
+    /**
+     * @brief
+     * Starts the scope if there is a capture running.
+     *
+     * @param _name
+     * The name of the scope, it must live for the whole run.
+     */
+    FORCEINLINE explicit
+    ProfileScope(const char* _name)
+      : m_name(_name),
+        m_begin(Profiler::isCapturing() ? Profiler::enterScope() : 0) {}
+    ProfileScope(const ProfileScope&) = delete;
+    /**
+     * @brief
+     * Ends the scope.
+     */
+    FORCEINLINE
+    ~ProfileScope()
+    {
+      if (0 != m_begin) {
+        Profiler::exitScope(m_name, m_begin);
+      }
+    }
+
+    ProfileScope&
+    operator=(const ProfileScope&) = delete;
+
+   private:
+    /*
+     * The name of the scope.
+     */
+    const char* m_name;
+    /*
+     * When the scope started, 0 if it is not being recorded.
+     */
+    uint64 m_begin;
+  };
+}
@@ -0,0 +1,259 @@
+/************************************************************************/
+/**
+ * @file nfQuaternion.h
+ * @author Mara Castellanos
+ * @date 18/10/26
+ * @brief This file defines the Quaternion, for rotations, as well as its
+ *        functions, operators and members.
+ *
+ * @bug Not bug Known.
+ */
+/************************************************************************/
+
+#pragma once
+
+#include "nfPrerequisitesUtilities.h"
+#include "nfVector3.h"
+
+namespace nfEngineSDK {
+  /**
+   * @brief
+   * Quaternion made by floats, x, y and z are the vector part and w the
+   * scalar part.
+   *
+   * @description
+   * Unit quaternions are rotations. The multiplication is the Hamilton
+   * product, so (a * b) rotates by b and then by a.
+   */
+  class NF_UTILITIES_EXPORT Quaternion
+  {
+   public:
+    /**
+     * @brief
+     * The default constructor.
+     */
+    Quaternion() = default;
+    /**
+     * @brief
+     * Initializes the quaternion with the values given.
+     *
+     * @param _x
+     * The x of the vector part.
+     * @param _y
+     * The y of the vector part.
+     * @param _z
+     * The z of the vector part.
+     * @param _w
+     * The scalar part.
+     */
+    FORCEINLINE constexpr explicit
+    Quaternion(float _x, float _y, float _z, float _w)
+      : x(_x), y(_y), z(_z), w(_w) {}
+    /**
+     * @brief
+     * The rotation of a row major matrix.
+     *
+     * @description
+     * Takes the upper 3x3 part, which must be a rotation without scale.
+     *
+     * @param _matrix
+     * The matrix.
+     */
+    explicit
+    Quaternion(const Matrix4f& _matrix);
+    /**
+     * @brief
+     * Frees the memory allocated on the quaternion.
+     */
+    ~Quaternion() = default;
+
+    /**
+     * @brief
+     * The rotation of an angle around an axis.
+     *
+     * @param _axis
+     * The axis of the rotation, normalized.
+     * @param _angle
+     * The angle in radians.
+     *
+     * @return
+     * The rotation quaternion.
+     */
+    static Quaternion
+    fromAxisAngle(const Vector3f& _axis, float _angle);
+
+    /**
+     * @brief
+     * The dot product of two quaternions.
+     *
+     * @description
+     * For unit quaternions it's the cosine of half the angle between them,
+     * negative when they are on opposite hemispheres.
+     */
+    FORCEINLINE float
+    dot(const Quaternion& other) const
+    {
+      return x * other.x + y * other.y + z * other.z + w * other.w;
+    }
+    /**
+     * @brief
+     * The length of the quaternion.
+     */
+    float
+    getMagnitude() const;
+    /**
+     * @brief
+     * The quaternion with length 1.
+     */
+    Quaternion
+    getNormalized() const;
+    /**
+     * @brief
+     * Makes the length of the quaternion 1.
+     *
+     * @return
+     * This quaternion, normalized.
+     */
+    Quaternion&
+    normalize();
+    /**
+     * @brief
+     * The quaternion with the vector part negated, the inverse of a unit
+     * quaternion.
+     */
+    FORCEINLINE Quaternion
+    getConjugate() const
+    {
+      return Quaternion(-x, -y, -z, w);
+    }
+    /**
+     * @brief
+     * The inverse of the quaternion, for any length.
+     */
+    Quaternion
+    getInverse() const;
+
+    /**
+     * @brief
+     * Rotates a vector by this unit quaternion.
+     *
+     * @param _v
+     * The vector to rotate.
+     *
+     * @return
+     * The rotated vector.
+     */
+    Vector3f
+    rotate(const Vector3f& _v) const;
+    /**
+     * @brief
+     * The row major rotation matrix of this unit quaternion.
+     */
+    Matrix4f
+    toMatrix4() const;
+
+    /**
+     * @brief
+     * Interpolates linearly and normalizes, through the shortest arc.
+     *
+     * @param _a
+     * The rotation at 0.
+     * @param _b
+     * The rotation at 1.
+     * @param _t
+     * The interpolation value.
+     *
+     * @return
+     * The interpolated rotation.
+     */
+    static Quaternion
+    nlerp(const Quaternion& _a, const Quaternion& _b, float _t);
+    /**
+     * @brief
+     * Interpolates with constant angular speed, through the shortest arc.
+     *
+     * @param _a
+     * The rotation at 0.
+     * @param _b
+     * The rotation at 1.
+     * @param _t
+     * The interpolation value.
+     *
+     * @return
+     * The interpolated rotation.
+     */
+    static Quaternion
+    slerp(const Quaternion& _a, const Quaternion& _b, float _t);
+
+    /**
+     * @brief
+     * The Hamilton product.
+     */
+    Quaternion
+    operator*(const Quaternion& other) const;
+    /**
+     * @brief
+     * Sum of the components.
+     */
+    FORCEINLINE Quaternion
+    operator+(const Quaternion& other) const
+    {
+      return Quaternion(x + other.x, y + other.y, z + other.z, w + other.w);
+    }
+    /**
+     * @brief
+     * Subtraction of the components.
+     */
+    FORCEINLINE Quaternion
+    operator-(const Quaternion& other) const
+    {
+      return Quaternion(x - other.x, y - other.y, z - other.z, w - other.w);
+    }
+    /**
+     * @brief
+     * Every component times the value.
+     */
+    FORCEINLINE Quaternion
+    operator*(float k) const
+    {
+      return Quaternion(x * k, y * k, z * k, w * k);
+    }
+    /**
+     * @brief
+     * Every component negated, the same rotation.
+     */
+    FORCEINLINE Quaternion
+    operator-() const
+    {
+      return Quaternion(-x, -y, -z, -w);
+    }
+    /**
+     * @brief
+     * Compares the components, with a small tolerance.
+     */
+    bool
+    operator==(const Quaternion& other) const;
+
+    /*
+     * The x of the vector part.
+     */
+    float x;
+    /*
+     * The y of the vector part.
+     */
+    float y;
+    /*
+     * The z of the vector part.
+     */
+    float z;
+    /*
+     * The scalar part.
+     */
+    float w;
+
+    /*
+     * The rotation that does nothing.
+     */
+    static const Quaternion kIDENTITY;
+  };
+}
@@ -15,6 +15,7 @@
 #include <map>
 #include <memory>
 #include <cmath>
+#include <limits>
 #include <functional>
 
 #include <fstream>
@@ -0,0 +1,648 @@
+/************************************************************************/
+/**
+ * @file nfSerializer.h
+ * @author Mara Castellanos
+ * @date 18/10/26
+ * @brief Binary serialization of the math types, the vertices and any type
+ *        that describes itself, with versioned objects.
+ *
+ * @bug Not bug Known.
+ */
+/************************************************************************/
+
+#pragma once
+
+#include <cstddef>
+#include <cstring>
+#include <type_traits>
+
+#include "nfPrerequisitesUtilities.h"
+#include "nfFile.h"
+#include "nfMatrix2.h"
+#include "nfMatrix3.h"
+#include "nfMatrix4.h"
+#include "nfQuaternion.h"
+#include "nfVector2.h"
+#include "nfVector3.h"
+#include "nfVector4.h"
+#include "nfVertex.h"
+
+namespace nfEngineSDK {
+  /**
+   * @brief
+   * Reverses the bytes of arrays of 2, 4 and 8 bytes values, with SIMD when
+   * it is available.
+   */
+  class NF_UTILITIES_EXPORT ByteSwap
+  {
+   public:
+    /**
+     * @brief
+     * Reverses the bytes of every 2 bytes value.
+     *
+     * @param _data
+     * The values, without any alignment.
+     * @param _count
+     * The number of values.
+     */
+    static void
+    swap16(void* _data, SIZE_T _count);
+    /**
+     * @brief
+     * Reverses the bytes of every 4 bytes value.
+     *
+     * @param _data
+     * The values, without any alignment.
+     * @param _count
+     * The number of values.
+     */
+    static void
+    swap32(void* _data, SIZE_T _count);
+    /**
+     * @brief
+     * Reverses the bytes of every 8 bytes value.
+     *
+     * @param _data
+     * The values, without any alignment.
+     * @param _count
+     * The number of values.
+     */
+    static void
+    swap64(void* _data, SIZE_T _count);
+
+    /**
+     * @brief
+     * Reverses the bytes of every value of 'size' bytes.
+     */
+    template<SIZE_T size>
+    static FORCEINLINE void
+    swap(void* _data, SIZE_T _count)
+    {
+      if constexpr (2 == size) {
+        swap16(_data, _count);
+      }
+      else if constexpr (4 == size) {
+        swap32(_data, _count);
+      }
+      else if constexpr (8 == size) {
+        swap64(_data, _count);
+      }
+    }
+  };
+
+  /**
+   * @brief
+   * How a type is written.
+   *
+   * @description
+   * The types with kBULK are written as their bytes, arrays of them in a
+   * single copy, and must give swap() to convert their bytes between the
+   * little endian of the format and big endian. The rest must have the
+   * member functions:
+   *
+   *   void serialize(Serializer& _serializer) const;
+   *   void deserialize(Deserializer& _deserializer);
+   */
+  template<class T, class = void>
+  struct SerializeTraits
+  {
+    static constexpr bool kBULK = false;
+  };
+
+  /**
+   * @brief
+   * The numbers and the enums are written as their bytes.
+   */
+  template<class T>
+  struct SerializeTraits<T, std::enable_if_t<std::is_arithmetic<T>::value ||
+                                             std::is_enum<T>::value>>
+  {
+    static constexpr bool kBULK = true;
+
+    static FORCEINLINE void
+    swap(uint8* _bytes, SIZE_T _count)
+    {
+      ByteSwap::swap<sizeof(T)>(_bytes, _count);
+    }
+  };
+
+/**
+ * Declares a type made only of 4 bytes values (floats, int32, uint32) as
+ * written by its bytes.
+ */
+#define NF_SERIALIZE_WORDS(_type)                                             \
+  template<>                                                                  \
+  struct SerializeTraits<_type>                                               \
+  {                                                                           \
+    static_assert(0 == sizeof(_type) % 4, #_type " is not made of words");   \
+    static constexpr bool kBULK = true;                                       \
+                                                                              \
+    static FORCEINLINE void                                                   \
+    swap(uint8* _bytes, SIZE_T _count)                                        \
+    {                                                                         \
+      ByteSwap::swap32(_bytes, _count * (sizeof(_type) / 4));                 \
+    }                                                                         \
+  };
+
+  NF_SERIALIZE_WORDS(Vector2f)
+  NF_SERIALIZE_WORDS(Vector2i)
+  NF_SERIALIZE_WORDS(Vector2u)
+  NF_SERIALIZE_WORDS(Vector3f)
+  NF_SERIALIZE_WORDS(Vector3i)
+  NF_SERIALIZE_WORDS(Vector3u)
+  NF_SERIALIZE_WORDS(Vector4f)
+  NF_SERIALIZE_WORDS(Vector4i)
+  NF_SERIALIZE_WORDS(Point4D)
+  NF_SERIALIZE_WORDS(Matrix2f)
+  NF_SERIALIZE_WORDS(Matrix3f)
+  NF_SERIALIZE_WORDS(Matrix4f)
+  NF_SERIALIZE_WORDS(Quaternion)
+  NF_SERIALIZE_WORDS(SimplexVertex)
+  NF_SERIALIZE_WORDS(ComplexVertex)
+  NF_SERIALIZE_WORDS(SimpleAnimVertex)
+  NF_SERIALIZE_WORDS(ComplexAnimVertex)
+
+  /**
+   * @brief
+   * The big vertices are floats and int32 too, for any number of bones.
+   */
+  template<uint32 size>
+  struct SerializeTraits<SimpleBigAnimVertex<size>>
+  {
+    static constexpr bool kBULK = true;
+
+    static FORCEINLINE void
+    swap(uint8* _bytes, SIZE_T _count)
+    {
+      ByteSwap::swap32(_bytes, _count * (sizeof(SimpleBigAnimVertex<size>) / 4));
+    }
+  };
+  template<uint32 size>
+  struct SerializeTraits<ComplexBigAnimVertex<size>>
+  {
+    static constexpr bool kBULK = true;
+
+    static FORCEINLINE void
+    swap(uint8* _bytes, SIZE_T _count)
+    {
+      ByteSwap::swap32(_bytes, _count * (sizeof(ComplexBigAnimVertex<size>) / 4));
+    }
+  };
+
+  /**
+   * @brief
+   * The quantized vertices mix sizes, every field is swapped by its own
+   * size. The bone indices are bytes and the padding is left as it is.
+   */
+  template<class T, uint32 tangentSpace, uint32 bones>
+  struct QuantizedVertexSwap
+  {
+    static constexpr bool kBULK = true;
+
+    static void
+    swap(uint8* _bytes, SIZE_T _count)
+    {
+      for (SIZE_T i = 0; i < _count; ++i, _bytes += sizeof(T)) {
+        ByteSwap::swap32(_bytes + offsetof(T, position), 3);
+        ByteSwap::swap16(_bytes + offsetof(T, texCoords), 2);
+        /* normal, tangent and binormal are contiguous. */
+        ByteSwap::swap32(_bytes + offsetof(T, normal), tangentSpace ? 3 : 1);
+        if constexpr (bones > 0) {
+          ByteSwap::swap16(_bytes + offsetof(T, boneWeights), bones);
+        }
+      }
+    }
+  };
+  template<>
+  struct SerializeTraits<QuantizedSimplexVertex>
+    : QuantizedVertexSwap<QuantizedSimplexVertex, 0, 0> {};
+  template<>
+  struct SerializeTraits<QuantizedComplexVertex>
+    : QuantizedVertexSwap<QuantizedComplexVertex, 1, 0> {};
+  template<>
+  struct SerializeTraits<QuantizedSimpleAnimVertex>
+    : QuantizedVertexSwap<QuantizedSimpleAnimVertex, 0, 4> {};
+  template<>
+  struct SerializeTraits<QuantizedComplexAnimVertex>
+    : QuantizedVertexSwap<QuantizedComplexAnimVertex, 1, 4> {};
+  template<uint32 size>
+  struct SerializeTraits<QuantizedSimpleBigAnimVertex<size>>
+    : QuantizedVertexSwap<QuantizedSimpleBigAnimVertex<size>, 0, size> {};
+  template<uint32 size>
+  struct SerializeTraits<QuantizedComplexBigAnimVertex<size>>
+    : QuantizedVertexSwap<QuantizedComplexBigAnimVertex<size>, 1, size> {};
+
+  /**
+   * @brief
+   * Writes values to a little endian binary buffer.
+   *
+   * @description
+   * The types written by their bytes go with one copy, a Vector<T> of them
+   * is its size and one copy of all the elements. On big endian systems the
+   * copy is byte swapped after.
+   *
+   * The objects are versioned: beginObject() writes the version and a
+   * place for the size, endObject() fills the size. When reading, an old
+   * reader skips the fields added by a newer version and a new reader knows
+   * which fields an old version has:
+   *
+   *   void Player::serialize(Serializer& _s) const {
+   *     _s.beginObject(2);
+   *     _s.write(m_position);
+   *     _s.write(m_name);     // added on version 2
+   *     _s.endObject();
+   *   }
+   *   void Player::deserialize(Deserializer& _d) {
+   *     uint32 version = _d.beginObject();
+   *     _d.read(m_position);
+   *     if (version >= 2) { _d.read(m_name); }
+   *     _d.endObject();
+   *   }
+   */
+  class NF_UTILITIES_EXPORT Serializer
+  {
+   public:
+    /**
+     * @brief
+     * The default constructor, an empty buffer.
+     */
+    Serializer() = default;
+    /**
+     * @brief
+     * Frees the memory allocated on the serializer.
+     */
+    ~Serializer() = default;
+
+    /**
+     * @brief
+     * Writes a value.
+     *
+     * @param _value
+     * The value.
+     */
+    template<class T>
+    void
+    write(const T& _value)
+    {
+      if constexpr (SerializeTraits<T>::kBULK) {
+        write(&_value, 1);
+      }
+      else {
+        _value.serialize(*this);
+      }
+    }
+    /**
+     * @brief
+     * Writes an array of values, without its size.
+     *
+     * @param _values
+     * The values.
+     * @param _count
+     * The number of values.
+     */
+    template<class T>
+    void
+    write(const T* _values, SIZE_T _count)
+    {
+      if constexpr (SerializeTraits<T>::kBULK) {
+        uint8* bytes = reserveBytes(sizeof(T) * _count);
+        if (0 != _count) {
+          std::memcpy(bytes, _values, sizeof(T) * _count);
+        }
+#if NF_ENDIAN != NF_ENDIAN_LITTLE
+        SerializeTraits<T>::swap(bytes, _count);
+#endif
+      }
+      else {
+        for (SIZE_T i = 0; i < _count; ++i) {
+          _values[i].serialize(*this);
+        }
+      }
+    }
+    /**
+     * @brief
+     * Writes a vector, its size and its elements.
+     *
+     * @param _values
+     * The vector.
+     */
+    template<class T, class A>
+    void
+    write(const Vector<T, A>& _values)
+    {
+      write(static_cast<uint64>(_values.size()));
+      write(_values.data(), _values.size());
+    }
+    /**
+     * @brief
+     * Writes a string, its size and its characters.
+     *
+     * @param _value
+     * The string.
+     */
+    void
+    write(const String& _value);
+    /**
+     * @brief
+     * Writes raw bytes, they are never swapped.
+     *
+     * @param _data
+     * The bytes.
+     * @param _size
+     * The number of bytes.
+     */
+    void
+    writeBytes(const void* _data, SIZE_T _size);
+
+    /**
+     * @brief
+     * Starts a versioned object, the objects can be nested.
+     *
+     * @param _version
+     * The version of the object being written.
+     */
+    void
+    beginObject(uint32 _version);
+    /**
+     * @brief
+     * Ends the last object started.
+     */
+    void
+    endObject();
+
+    /**
+     * @brief
+     * Returns the bytes written.
+     *
+     * @return
+     * The buffer.
+     */
+    FORCEINLINE const Vector<uint8>&
+    getBuffer() const
+    {
+      return m_buffer;
+    }
+    /**
+     * @brief
+     * Removes everything written.
+     */
+    void
+    clear();
+
+    /**
+     * @brief
+     * Writes the buffer to a file, replacing it.
+     *
+     * @param _path
+     * The path of the file.
+     *
+     * @return
+     * False if the file couldn't be written.
+     */
+    bool
+    saveToFile(const String& _path) const;
+
+   private:
+    /*
+     * Grows the buffer and returns where the new bytes go.
+     */
+    uint8*
+    reserveBytes(SIZE_T _size);
+
+    /*
+     * The bytes written.
+     */
+    Vector<uint8> m_buffer;
+    /*
+     * Where the size of every open object goes.
+     */
+    Vector<SIZE_T> m_objects;
+  };
+
+  /**
+   * @brief
+   * Reads values from a little endian binary buffer written by Serializer.
+   *
+   * @description
+   * The buffer is not copied, it must live while the deserializer is used.
+   * Any read past the end of the buffer or of the current object fails,
+   * leaves the value as it was and marks the deserializer as not valid, the
+   * reads after it fail too. Check isValid() once at the end.
+   */
+  class NF_UTILITIES_EXPORT Deserializer
+  {
+   public:
+    /**
+     * @brief
+     * Reads from a buffer.
+     *
+     * @param _data
+     * The bytes.
+     * @param _size
+     * The number of bytes.
+     */
+    Deserializer(const void* _data, SIZE_T _size)
+      : m_data(static_cast<const uint8*>(_data)),
+        m_end(_size) {}
+    /**
+     * @brief
+     * Reads from a view, of a mapped File usually.
+     *
+     * @param _view
+     * The bytes.
+     */
+    explicit
+    Deserializer(const FileView& _view)
+      : Deserializer(_view.data(), _view.size()) {}
+    /**
+     * @brief
+     * Frees the memory allocated on the deserializer.
+     */
+    ~Deserializer() = default;
+
+    /**
+     * @brief
+     * Reads a value.
+     *
+     * @param _value
+     * Where the value is written.
+     *
+     * @return
+     * False if there was not enough data.
+     */
+    template<class T>
+    bool
+    read(T& _value)
+    {
+      if constexpr (SerializeTraits<T>::kBULK) {
+        return read(&_value, 1);
+      }
+      else {
+        _value.deserialize(*this);
+        return m_valid;
+      }
+    }
+    /**
+     * @brief
+     * Reads an array of values written without its size.
+     *
+     * @param _values
+     * Where the values are written.
+     * @param _count
+     * The number of values.
+     *
+     * @return
+     * False if there was not enough data.
+     */
+    template<class T>
+    bool
+    read(T* _values, SIZE_T _count)
+    {
+      if constexpr (SerializeTraits<T>::kBULK) {
+        const uint8* bytes = takeBytes(sizeof(T) * _count);
+        if (nullptr == bytes) {
+          return false;
+        }
+        if (0 != _count) {
+          std::memcpy(static_cast<void*>(_values), bytes, sizeof(T) * _count);
+        }
+#if NF_ENDIAN != NF_ENDIAN_LITTLE
+        SerializeTraits<T>::swap(reinterpret_cast<uint8*>(_values), _count);
+#endif
+        return true;
+      }
+      else {
+        for (SIZE_T i = 0; i < _count && m_valid; ++i) {
+          _values[i].deserialize(*this);
+        }
+        return m_valid;
+      }
+    }
+    /**
+     * @brief
+     * Reads a vector, replacing its elements.
+     *
+     * @param _values
+     * Where the elements are written.
+     *
+     * @return
+     * False if there was not enough data.
+     */
+    template<class T, class A>
+    bool
+    read(Vector<T, A>& _values)
+    {
+      uint64 count = 0;
+      /* Every element takes a byte at least, a bigger count is corrupted. */
+      if (!read(count) ||
+          count > (getRemaining() / (SerializeTraits<T>::kBULK ? sizeof(T) : 1))) {
+        return fail();
+      }
+      _values.resize(static_cast<SIZE_T>(count));
+      return read(_values.data(), _values.size());
+    }
+    /**
+     * @brief
+     * Reads a string.
+     *
+     * @param _value
+     * Where the string is written.
+     *
+     * @return
+     * False if there was not enough data.
+     */
+    bool
+    read(String& _value);
+    /**
+     * @brief
+     * Reads raw bytes.
+     *
+     * @param _out
+     * Where the bytes are written.
+     * @param _size
+     * The number of bytes.
+     *
+     * @return
+     * False if there was not enough data.
+     */
+    bool
+    readBytes(void* _out, SIZE_T _size);
+
+    /**
+     * @brief
+     * Starts reading a versioned object.
+     *
+     * @return
+     * The version the object was written with, 0 if there was not enough
+     * data.
+     */
+    uint32
+    beginObject();
+    /**
+     * @brief
+     * Ends the object, skipping the fields that were not read.
+     */
+    void
+    endObject();
+
+    /**
+     * @brief
+     * Checks if every read has succeeded.
+     *
+     * @return
+     * False after the first read that failed.
+     */
+    FORCEINLINE bool
+    isValid() const
+    {
+      return m_valid;
+    }
+    /**
+     * @brief
+     * Returns the bytes left to read, on the current object if there is one.
+     *
+     * @return
+     * The number of bytes.
+     */
+    FORCEINLINE SIZE_T
+    getRemaining() const
+    {
+      return m_end - m_position;
+    }
+
+   private:
+    /*
+     * Returns the next _size bytes and moves past them, null if there are
+     * not enough.
+     */
+    const uint8*
+    takeBytes(SIZE_T _size);
+
+    /*
+     * Marks the deserializer as not valid.
+     */
+    bool
+    fail();
+
+    /*
+     * The bytes.
+     */
+    const uint8* m_data;
+    /*
+     * The next byte to read.
+     */
+    SIZE_T m_position = 0;
+    /*
+     * The end of the current object or of the buffer.
+     */
+    SIZE_T m_end;
+    /*
+     * The ends of the objects that contain the current one.
+     */
+    Vector<SIZE_T> m_objects;
+    /*
+     * If every read has succeeded.
+     */
+    bool m_valid = true;
+  };
+}
@@ -0,0 +1,405 @@
+/************************************************************************/
+/**
+ * @file nfSkinning.h
+ * @author Mara Castellanos
+ * @date 18/10/26
+ * @brief Linear blend and dual quaternion skinning of the animated vertices
+ *        on the CPU.
+ *
+ * @bug Not bug Known.
+ */
+/************************************************************************/
+
+#pragma once
+
+#include "nfPrerequisitesUtilities.h"
+#include "nfMatrix4.h"
+#include "nfQuaternion.h"
+#include "nfVertex.h"
+
+namespace nfEngineSDK {
+  /**
+   * @brief
+   * An affine 3x4 bone matrix, stored by columns so the skinning kernels can
+   * blend it and transform with vertical operations only.
+   *
+   * @description
+   * Every column is padded to 4 floats, the last column is the translation.
+   * Build the palette once per frame from the bone matrices.
+   */
+  struct MS_ALIGN(32) SkinningMatrix
+  {
+    /**
+     * @brief
+     * The default constructor.
+     */
+    SkinningMatrix() = default;
+    /**
+     * @brief
+     * Takes the affine part of a row major Matrix4f.
+     *
+     * @param _matrix
+     * The bone matrix, its last row is ignored.
+     */
+    explicit
+    SkinningMatrix(const Matrix4f& _matrix)
+    {
+      setRows(&_matrix.m[0], &_matrix.m[4], &_matrix.m[8]);
+    }
+    /**
+     * @brief
+     * Takes a row major 3x4 affine matrix.
+     *
+     * @param _rows
+     * The 12 values, ordered from left to right, up to down.
+     */
+    explicit
+    SkinningMatrix(const float _rows[12])
+    {
+      setRows(&_rows[0], &_rows[4], &_rows[8]);
+    }
+
+    /*
+     * The columns of the matrix, the fourth float of each one is 0.
+     */
+    float m[16];
+
+   private:
+    void
+    setRows(const float* _r0, const float* _r1, const float* _r2)
+    {
+      for (uint32 c = 0; c < 4; ++c) {
+        m[c * 4 + 0] = _r0[c];
+        m[c * 4 + 1] = _r1[c];
+        m[c * 4 + 2] = _r2[c];
+        m[c * 4 + 3] = 0.0f;
+      }
+    }
+  } GCC_ALIGN(32);
+
+  /**
+   * @brief
+   * A rigid bone transform as a unit dual quaternion, for the dual
+   * quaternion skinning.
+   *
+   * @description
+   * The real part is the rotation and the dual part is half the translation
+   * times the rotation. Both are together so a bone is one 32 bytes load.
+   */
+  struct MS_ALIGN(32) SkinningDualQuaternion
+  {
+    /**
+     * @brief
+     * The default constructor.
+     */
+    SkinningDualQuaternion() = default;
+    /**
+     * @brief
+     * Initializes the dual quaternion with a rotation and a translation.
+     *
+     * @param _rotation
+     * The rotation, normalized.
+     * @param _translation
+     * The translation, applied after the rotation.
+     */
+    SkinningDualQuaternion(const Quaternion& _rotation,
+                           const Vector3f& _translation)
+      : real(_rotation),
+        dual(Quaternion(_translation.x, _translation.y, _translation.z, 0.0f) *
+             _rotation * 0.5f) {}
+    /**
+     * @brief
+     * Takes the rotation and the translation of a row major Matrix4f.
+     *
+     * @param _matrix
+     * The bone matrix, a rotation and a translation without scale.
+     */
+    explicit
+    SkinningDualQuaternion(const Matrix4f& _matrix)
+      : SkinningDualQuaternion(Quaternion(_matrix),
+                               Vector3f(_matrix.m_03, _matrix.m_13, _matrix.m_23)) {}
+
+    /*
+     * The rotation.
+     */
+    Quaternion real;
+    /*
+     * Half the translation times the rotation.
+     */
+    Quaternion dual;
+  } GCC_ALIGN(32);
+
+  /**
+   * @brief
+   * Skinning of the animated vertices, linear blend with a SkinningMatrix
+   * palette or dual quaternion with a SkinningDualQuaternion palette.
+   *
+   * @description
+   * Both blend the bones of a vertex in registers (a 3x4 matrix in two AVX
+   * registers, a dual quaternion in one) and transform with broadcasts and
+   * fused multiply adds, no horizontal operations. The linear blend loop is
+   * unrolled for every bone count from 1 to 8, with 1 taking the bone matrix
+   * as is. Linear blend normals are renormalized, so that palette must not
+   * have non uniform scale; dual quaternions are rigid and keep the length.
+   *
+   * The dual quaternion path flips the bones on the opposite hemisphere of
+   * the first one before blending, so a vertex never takes the long way
+   * around. It doesn't collapse on twists like the linear blend, at the cost
+   * of the conversion to a matrix per vertex.
+   *
+   * The kernels are compiled for every CPU tier (scalar, SSE2, SSE4.1 and
+   * AVX2, AVX-512 CPUs take the AVX2 ones) and the tier of the CPU is picked
+   * at startup, see CPUFeatures.
+   *
+   * Big arrays can be split between threads, every thread takes a
+   * contiguous chunk of at least kMIN_VERTICES_PER_THREAD vertices.
+   */
+  class NF_UTILITIES_EXPORT Skinning
+  {
+   public:
+    /**
+     * @brief
+     * Converts the bone matrices to a linear blend palette.
+     *
+     * @param _bones
+     * The row major bone matrices, already multiplied by the inverse bind
+     * pose.
+     * @param _palette
+     * Where the palette is written.
+     * @param _count
+     * The number of bones.
+     */
+    static void
+    preparePalette(const Matrix4f* _bones,
+                   SkinningMatrix* _palette,
+                   SIZE_T _count);
+    /**
+     * @brief
+     * Converts the bone matrices to a dual quaternion palette.
+     *
+     * @param _bones
+     * The row major bone matrices, already multiplied by the inverse bind
+     * pose. Only rotation and translation, the scale is lost.
+     * @param _palette
+     * Where the palette is written.
+     * @param _count
+     * The number of bones.
+     */
+    static void
+    preparePalette(const Matrix4f* _bones,
+                   SkinningDualQuaternion* _palette,
+                   SIZE_T _count);
+
+    /**
+     * @brief
+     * Skins an array of vertices moved by up to 4 bones.
+     *
+     * @param _palette
+     * The bone palette, indexed by the bone indices of the vertices.
+     * @param _in
+     * The vertices in bind pose.
+     * @param _positions
+     * Where the skinned positions are written.
+     * @param _normals
+     * Where the skinned normals are written.
+     * @param _count
+     * The number of vertices.
+     * @param _threads
+     * The number of threads to use, 0 for all the hardware ones.
+     */
+    static void
+    skin(const SkinningMatrix* _palette,
+         const SimpleAnimVertex* _in,
+         Vector3f* _positions,
+         Vector3f* _normals,
+         SIZE_T _count,
+         uint32 _threads = 1);
+    /**
+     * @brief
+     * Skins an array of vertices moved by up to 4 bones, with their tangent
+     * space.
+     *
+     * @param _palette
+     * The bone palette, indexed by the bone indices of the vertices.
+     * @param _in
+     * The vertices in bind pose.
+     * @param _positions
+     * Where the skinned positions are written.
+     * @param _normals
+     * Where the skinned normals are written.
+     * @param _tangents
+     * Where the skinned tangents are written.
+     * @param _binormals
+     * Where the skinned binormals are written.
+     * @param _count
+     * The number of vertices.
+     * @param _threads
+     * The number of threads to use, 0 for all the hardware ones.
+     */
+    static void
+    skin(const SkinningMatrix* _palette,
+         const ComplexAnimVertex* _in,
+         Vector3f* _positions,
+         Vector3f* _normals,
+         Vector3f* _tangents,
+         Vector3f* _binormals,
+         SIZE_T _count,
+         uint32 _threads = 1);
+    /**
+     * @brief
+     * Skins an array of vertices moved by up to 'size' bones, 'size' from 1
+     * to 8.
+     *
+     * @param _palette
+     * The bone palette, indexed by the bone indices of the vertices.
+     * @param _in
+     * The vertices in bind pose.
+     * @param _positions
+     * Where the skinned positions are written.
+     * @param _normals
+     * Where the skinned normals are written.
+     * @param _count
+     * The number of vertices.
+     * @param _threads
+     * The number of threads to use, 0 for all the hardware ones.
+     */
+    template<uint32 size>
+    static void
+    skin(const SkinningMatrix* _palette,
+         const SimpleBigAnimVertex<size>* _in,
+         Vector3f* _positions,
+         Vector3f* _normals,
+         SIZE_T _count,
+         uint32 _threads = 1)
+    {
+      static_assert(size >= 1 && size <= 8, "Skinning supports 1 to 8 bones");
+      if (0 == _count) {
+        return;
+      }
+      Streams streams{};
+      streams.positions = &_in[0].position.x;
+      streams.normals = &_in[0].normal.x;
+      streams.indices = &_in[0].boneIndices[0];
+      streams.weights = &_in[0].boneWeights[0];
+      streams.stride = sizeof(SimpleBigAnimVertex<size>);
+      Outputs outputs{ _positions, _normals, nullptr, nullptr };
+      run(getLinearKernel(size), _palette, streams, outputs, _count, _threads);
+    }
+
+    /**
+     * @brief
+     * Skins an array of vertices moved by up to 4 bones, with dual
+     * quaternions.
+     *
+     * @param _palette
+     * The bone palette, indexed by the bone indices of the vertices.
+     * @param _in
+     * The vertices in bind pose.
+     * @param _positions
+     * Where the skinned positions are written.
+     * @param _normals
+     * Where the skinned normals are written.
+     * @param _count
+     * The number of vertices.
+     * @param _threads
+     * The number of threads to use, 0 for all the hardware ones.
+     */
+    static void
+    skin(const SkinningDualQuaternion* _palette,
+         const SimpleAnimVertex* _in,
+         Vector3f* _positions,
+         Vector3f* _normals,
+         SIZE_T _count,
+         uint32 _threads = 1);
+    /**
+     * @brief
+     * Skins an array of vertices moved by up to 4 bones, with their tangent
+     * space, with dual quaternions.
+     *
+     * @param _palette
+     * The bone palette, indexed by the bone indices of the vertices.
+     * @param _in
+     * The vertices in bind pose.
+     * @param _positions
+     * Where the skinned positions are written.
+     * @param _normals
+     * Where the skinned normals are written.
+     * @param _tangents
+     * Where the skinned tangents are written.
+     * @param _binormals
+     * Where the skinned binormals are written.
+     * @param _count
+     * The number of vertices.
+     * @param _threads
+     * The number of threads to use, 0 for all the hardware ones.
+     */
+    static void
+    skin(const SkinningDualQuaternion* _palette,
+         const ComplexAnimVertex* _in,
+         Vector3f* _positions,
+         Vector3f* _normals,
+         Vector3f* _tangents,
+         Vector3f* _binormals,
+         SIZE_T _count,
+         uint32 _threads = 1);
+
+    /*
+     * Where the skinning inputs of the first vertex are, and the bytes
+     * between vertices. Tangents and binormals can be null. These types are
+     * public for the kernel tables of BatchMath.
+     */
+    struct Streams
+    {
+      const float* positions;
+      const float* normals;
+      const float* tangents;
+      const float* binormals;
+      const int32* indices;
+      const float* weights;
+      SIZE_T stride;
+    };
+    /*
+     * Where the results are written. Tangents and binormals can be null.
+     */
+    struct Outputs
+    {
+      Vector3f* positions;
+      Vector3f* normals;
+      Vector3f* tangents;
+      Vector3f* binormals;
+    };
+
+    template<class Palette>
+    using RangeKernel = void(*)(const Palette*,
+                                const Streams&,
+                                const Outputs&,
+                                SIZE_T,
+                                SIZE_T);
+
+    /*
+     * The smallest chunk given to a thread, below it the thread start costs
+     * more than the work.
+     */
+    static const SIZE_T kMIN_VERTICES_PER_THREAD = 4096;
+
+   private:
+    /*
+     * The linear blend kernel of the CPU tier in use, for 'size' bones per
+     * vertex.
+     */
+    static RangeKernel<SkinningMatrix>
+    getLinearKernel(uint32 _size);
+
+    /*
+     * Splits the vertices between the threads and runs the kernel.
+     */
+    template<class Palette>
+    static void
+    run(RangeKernel<Palette> _kernel,
+        const Palette* _palette,
+        const Streams& _streams,
+        const Outputs& _outputs,
+        SIZE_T _count,
+        uint32 _threads);
+  };
+}
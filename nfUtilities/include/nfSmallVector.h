@@ -0,0 +1,682 @@
+/************************************************************************/
+/**
+ * @file nfSmallVector.h
+ * @author Mara Castellanos
+ * @date 18/10/26
+ * @brief Vectors with their first elements inside the object: SmallVector,
+ *        that moves to the heap when it fills, and FixedVector, that never
+ *        allocates.
+ *
+ * @bug Not bug Known.
+ */
+/************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <initializer_list>
+#include <iterator>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "nfPrerequisitesUtilities.h"
+
+namespace nfEngineSDK {
+  /**
+   * @brief
+   * Tells if a T can be moved to another address copying its bytes and
+   * forgetting the old ones, without calling its move constructor and
+   * destructor.
+   *
+   * @description
+   * True for the trivially copyable types. Specialize it for the types that
+   * aren't but don't point to themselves, the math types with a user copy
+   * constructor are below.
+   */
+  template<typename T>
+  struct IsTriviallyRelocatable : std::is_trivially_copyable<T> {};
+
+  template<> struct IsTriviallyRelocatable<Matrix2f> : std::true_type {};
+  template<> struct IsTriviallyRelocatable<Matrix3f> : std::true_type {};
+  template<> struct IsTriviallyRelocatable<Matrix4f> : std::true_type {};
+
+  /*
+   * A pair is if both its members are, even with a const key.
+   */
+  template<typename A, typename B>
+  struct IsTriviallyRelocatable<std::pair<A, B>>
+    : std::integral_constant<bool,
+                             IsTriviallyRelocatable<typename std::remove_const<A>::type>::value &&
+                             IsTriviallyRelocatable<typename std::remove_const<B>::type>::value> {};
+
+  /**
+   * @brief
+   * Where a TInlineVector keeps its elements.
+   *
+   * @description
+   * The fixed version is only the inline buffer and the size, the growing
+   * one adds a pointer to the elements, the inline buffer or the heap, and
+   * the capacity.
+   */
+  template<typename T, SIZE_T N, bool canGrow>
+  class InlineVectorStorage
+  {
+   protected:
+    FORCEINLINE T*
+    getBuffer()
+    {
+      return reinterpret_cast<T*>(m_inline);
+    }
+    FORCEINLINE const T*
+    getBuffer() const
+    {
+      return reinterpret_cast<const T*>(m_inline);
+    }
+    static FORCEINLINE constexpr SIZE_T
+    getBufferCapacity()
+    {
+      return N;
+    }
+    static FORCEINLINE constexpr bool
+    isBufferInline()
+    {
+      return true;
+    }
+
+    alignas(T) unsigned char m_inline[N * sizeof(T)];
+    SIZE_T m_size = 0;
+  };
+
+  template<typename T, SIZE_T N>
+  class InlineVectorStorage<T, N, true>
+  {
+   protected:
+    FORCEINLINE T*
+    getBuffer()
+    {
+      return m_data;
+    }
+    FORCEINLINE const T*
+    getBuffer() const
+    {
+      return m_data;
+    }
+    FORCEINLINE SIZE_T
+    getBufferCapacity() const
+    {
+      return m_capacity;
+    }
+    FORCEINLINE bool
+    isBufferInline() const
+    {
+      return m_data == reinterpret_cast<const T*>(m_inline);
+    }
+
+    T* m_data = reinterpret_cast<T*>(m_inline);
+    SIZE_T m_size = 0;
+    SIZE_T m_capacity = N;
+    alignas(T) unsigned char m_inline[N * sizeof(T)];
+  };
+
+  /**
+   * @brief
+   * A vector that keeps up to N elements inside of it.
+   *
+   * @description
+   * It has the interface of std::vector and its iterators are pointers, the
+   * standard algorithms work with it. Use the aliases: SmallVector moves the
+   * elements to the heap past N, FixedVector can't hold more than N and
+   * aborts the program on overflow, on the release builds too, instead of
+   * writing past its buffer. Check size() against capacity() before adding
+   * to a FixedVector that can fill.
+   *
+   * The elements that are IsTriviallyRelocatable are moved with memcpy when
+   * the vector grows, inserts or erases.
+   */
+  template<typename T, SIZE_T N, bool canGrow>
+  class TInlineVector : public InlineVectorStorage<T, N, canGrow>
+  {
+    static_assert(N > 0, "The inline capacity can't be 0");
+
+    using Storage = InlineVectorStorage<T, N, canGrow>;
+    using Storage::m_size;
+    using Storage::m_inline;
+
+   public:
+    using value_type = T;
+    using size_type = SIZE_T;
+    using difference_type = std::ptrdiff_t;
+    using reference = T&;
+    using const_reference = const T&;
+    using pointer = T*;
+    using const_pointer = const T*;
+    using iterator = T*;
+    using const_iterator = const T*;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    /*
+     * The number of elements inside the object.
+     */
+    static constexpr SIZE_T kINLINE_CAPACITY = N;
+
+    TInlineVector() = default;
+    /**
+     * @brief
+     * Initializes the vector with _count copies of _value.
+     */
+    TInlineVector(SIZE_T _count, const T& _value)
+    {
+      resize(_count, _value);
+    }
+    /**
+     * @brief
+     * Initializes the vector with _count value initialized elements.
+     */
+    explicit TInlineVector(SIZE_T _count)
+    {
+      resize(_count);
+    }
+    TInlineVector(std::initializer_list<T> _values)
+    {
+      append(_values.begin(), _values.size());
+    }
+    TInlineVector(const TInlineVector& _other)
+    {
+      append(_other.data(), _other.size());
+    }
+    TInlineVector(TInlineVector&& _other) noexcept
+    {
+      take(_other);
+    }
+    /**
+     * @brief
+     * Destroys the elements and frees the heap memory.
+     */
+    ~TInlineVector()
+    {
+      clear();
+      freeHeap();
+    }
+
+    TInlineVector&
+    operator=(const TInlineVector& _other)
+    {
+      if (this != &_other) {
+        clear();
+        append(_other.data(), _other.size());
+      }
+      return *this;
+    }
+    TInlineVector&
+    operator=(TInlineVector&& _other) noexcept
+    {
+      if (this != &_other) {
+        clear();
+        freeHeap();
+        take(_other);
+      }
+      return *this;
+    }
+    TInlineVector&
+    operator=(std::initializer_list<T> _values)
+    {
+      clear();
+      append(_values.begin(), _values.size());
+      return *this;
+    }
+
+    FORCEINLINE T*
+    data()
+    {
+      return this->getBuffer();
+    }
+    FORCEINLINE const T*
+    data() const
+    {
+      return this->getBuffer();
+    }
+    FORCEINLINE SIZE_T
+    size() const
+    {
+      return m_size;
+    }
+    FORCEINLINE SIZE_T
+    capacity() const
+    {
+      return this->getBufferCapacity();
+    }
+    FORCEINLINE bool
+    empty() const
+    {
+      return 0 == m_size;
+    }
+    /**
+     * @brief
+     * Tells if the elements are inside the object, always true for a
+     * FixedVector.
+     */
+    FORCEINLINE bool
+    isInline() const
+    {
+      return this->isBufferInline();
+    }
+
+    FORCEINLINE iterator begin() { return data(); }
+    FORCEINLINE iterator end() { return data() + m_size; }
+    FORCEINLINE const_iterator begin() const { return data(); }
+    FORCEINLINE const_iterator end() const { return data() + m_size; }
+    FORCEINLINE const_iterator cbegin() const { return data(); }
+    FORCEINLINE const_iterator cend() const { return data() + m_size; }
+    FORCEINLINE reverse_iterator rbegin() { return reverse_iterator(end()); }
+    FORCEINLINE reverse_iterator rend() { return reverse_iterator(begin()); }
+    FORCEINLINE const_reverse_iterator rbegin() const { return const_reverse_iterator(end()); }
+    FORCEINLINE const_reverse_iterator rend() const { return const_reverse_iterator(begin()); }
+
+    FORCEINLINE T&
+    operator[](SIZE_T _index)
+    {
+      NF_ASSERT(_index < m_size);
+      return data()[_index];
+    }
+    FORCEINLINE const T&
+    operator[](SIZE_T _index) const
+    {
+      NF_ASSERT(_index < m_size);
+      return data()[_index];
+    }
+    FORCEINLINE T&
+    front()
+    {
+      NF_ASSERT(m_size > 0);
+      return data()[0];
+    }
+    FORCEINLINE const T&
+    front() const
+    {
+      NF_ASSERT(m_size > 0);
+      return data()[0];
+    }
+    FORCEINLINE T&
+    back()
+    {
+      NF_ASSERT(m_size > 0);
+      return data()[m_size - 1];
+    }
+    FORCEINLINE const T&
+    back() const
+    {
+      NF_ASSERT(m_size > 0);
+      return data()[m_size - 1];
+    }
+
+    /**
+     * @brief
+     * Makes room for _capacity elements. A FixedVector aborts if it is
+     * bigger than N.
+     */
+    void
+    reserve(SIZE_T _capacity)
+    {
+      if (_capacity > capacity()) {
+        reallocate(_capacity);
+      }
+    }
+    /**
+     * @brief
+     * Moves the elements back inside the object if they fit, or to a heap
+     * block of their size if they don't.
+     */
+    void
+    shrink_to_fit()
+    {
+      if constexpr (canGrow) {
+        if (!isInline() && m_size < capacity()) {
+          reallocate(m_size);
+        }
+      }
+    }
+
+    template<typename... Args>
+    FORCEINLINE T&
+    emplace_back(Args&&... _args)
+    {
+      if (m_size == capacity()) {
+        return growAndEmplace(std::forward<Args>(_args)...);
+      }
+      T* element = new (data() + m_size) T(std::forward<Args>(_args)...);
+      ++m_size;
+      return *element;
+    }
+    FORCEINLINE void
+    push_back(const T& _value)
+    {
+      emplace_back(_value);
+    }
+    FORCEINLINE void
+    push_back(T&& _value)
+    {
+      emplace_back(std::move(_value));
+    }
+    FORCEINLINE void
+    pop_back()
+    {
+      NF_ASSERT(m_size > 0);
+      --m_size;
+      data()[m_size].~T();
+    }
+
+    /**
+     * @brief
+     * Inserts a value before _position.
+     *
+     * @return
+     * The iterator to the new element.
+     */
+    iterator
+    insert(const_iterator _position, T _value)
+    {
+      SIZE_T index = static_cast<SIZE_T>(_position - cbegin());
+      NF_ASSERT(index <= m_size);
+      if (index == m_size) {
+        emplace_back(std::move(_value));
+        return data() + index;
+      }
+      if constexpr (IsTriviallyRelocatable<T>::value) {
+        if (m_size == capacity()) {
+          reserve(nextCapacity(m_size + 1));
+        }
+        T* position = data() + index;
+        std::memmove(static_cast<void*>(position + 1),
+                     static_cast<const void*>(position),
+                     (m_size - index) * sizeof(T));
+        new (position) T(std::move(_value));
+        ++m_size;
+        return position;
+      }
+      else {
+        emplace_back(std::move(back()));
+        T* position = data() + index;
+        std::move_backward(position, end() - 2, end() - 1);
+        *position = std::move(_value);
+        return position;
+      }
+    }
+    /**
+     * @brief
+     * Removes the element at _position.
+     *
+     * @return
+     * The iterator to the element after it.
+     */
+    iterator
+    erase(const_iterator _position)
+    {
+      return erase(_position, _position + 1);
+    }
+    /**
+     * @brief
+     * Removes the elements between _first and _last.
+     *
+     * @return
+     * The iterator to the element after them.
+     */
+    iterator
+    erase(const_iterator _first, const_iterator _last)
+    {
+      T* first = data() + (_first - cbegin());
+      T* last = data() + (_last - cbegin());
+      NF_ASSERT(first <= last && last <= end());
+      SIZE_T count = static_cast<SIZE_T>(last - first);
+      if (0 == count) {
+        return first;
+      }
+      if constexpr (IsTriviallyRelocatable<T>::value) {
+        destroy(first, count);
+        std::memmove(static_cast<void*>(first),
+                     static_cast<const void*>(last),
+                     static_cast<SIZE_T>(end() - last) * sizeof(T));
+      }
+      else {
+        T* newEnd = std::move(last, end(), first);
+        destroy(newEnd, count);
+      }
+      m_size -= count;
+      return first;
+    }
+
+    /**
+     * @brief
+     * Changes the size, the new elements are value initialized.
+     */
+    void
+    resize(SIZE_T _size)
+    {
+      if (_size < m_size) {
+        destroy(data() + _size, m_size - _size);
+      }
+      else {
+        reserve(_size);
+        for (T* element = data() + m_size; element != data() + _size; ++element) {
+          new (element) T();
+        }
+      }
+      m_size = _size;
+    }
+    /**
+     * @brief
+     * Changes the size, the new elements are copies of _value.
+     */
+    void
+    resize(SIZE_T _size, const T& _value)
+    {
+      if (_size < m_size) {
+        destroy(data() + _size, m_size - _size);
+        m_size = _size;
+      }
+      else {
+        while (m_size < _size) {
+          push_back(_value);
+        }
+      }
+    }
+    /**
+     * @brief
+     * Destroys the elements, the capacity stays.
+     */
+    FORCEINLINE void
+    clear()
+    {
+      destroy(data(), m_size);
+      m_size = 0;
+    }
+
+    bool
+    operator==(const TInlineVector& _other) const
+    {
+      return m_size == _other.m_size && std::equal(begin(), end(), _other.begin());
+    }
+    FORCEINLINE bool
+    operator!=(const TInlineVector& _other) const
+    {
+      return !(*this == _other);
+    }
+
+   private:
+    static FORCEINLINE void
+    destroy(T* _first, SIZE_T _count)
+    {
+      if constexpr (!std::is_trivially_destructible<T>::value) {
+        for (SIZE_T i = 0; i < _count; ++i) {
+          _first[i].~T();
+        }
+      }
+    }
+    /*
+     * Moves _count elements to uninitialized memory, the old ones are left
+     * destroyed.
+     */
+    static FORCEINLINE void
+    relocate(T* _from, T* _to, SIZE_T _count)
+    {
+      if constexpr (IsTriviallyRelocatable<T>::value) {
+        if (_count > 0) {
+          std::memcpy(static_cast<void*>(_to), static_cast<const void*>(_from), _count * sizeof(T));
+        }
+      }
+      else {
+        for (SIZE_T i = 0; i < _count; ++i) {
+          new (_to + i) T(std::move(_from[i]));
+          _from[i].~T();
+        }
+      }
+    }
+
+    static FORCEINLINE T*
+    allocate(SIZE_T _count)
+    {
+      if constexpr (alignof(T) > __STDCPP_DEFAULT_NEW_ALIGNMENT__) {
+        return static_cast<T*>(::operator new(_count * sizeof(T), std::align_val_t(alignof(T))));
+      }
+      else {
+        return static_cast<T*>(::operator new(_count * sizeof(T)));
+      }
+    }
+    static FORCEINLINE void
+    deallocate(T* _block)
+    {
+      if constexpr (alignof(T) > __STDCPP_DEFAULT_NEW_ALIGNMENT__) {
+        ::operator delete(_block, std::align_val_t(alignof(T)));
+      }
+      else {
+        ::operator delete(_block);
+      }
+    }
+
+    FORCEINLINE void
+    freeHeap()
+    {
+      if constexpr (canGrow) {
+        if (!isInline()) {
+          deallocate(this->m_data);
+          this->m_data = reinterpret_cast<T*>(m_inline);
+          this->m_capacity = N;
+        }
+      }
+    }
+
+    FORCEINLINE SIZE_T
+    nextCapacity(SIZE_T _needed) const
+    {
+      SIZE_T doubled = capacity() * 2;
+      return doubled > _needed ? doubled : _needed;
+    }
+
+    /*
+     * Moves the elements to a block of _capacity, the inline buffer if they
+     * fit.
+     */
+    void
+    reallocate(SIZE_T _capacity)
+    {
+      if constexpr (canGrow) {
+        T* block = _capacity <= N ? reinterpret_cast<T*>(m_inline) : allocate(_capacity);
+        if (block == data()) {
+          return;
+        }
+        relocate(data(), block, m_size);
+        freeHeap();
+        this->m_data = block;
+        this->m_capacity = _capacity <= N ? N : _capacity;
+      }
+      else if (_capacity > N) {
+        overflow();
+      }
+    }
+
+    /*
+     * The new element is built before the old ones move, _args can point
+     * inside the vector.
+     */
+    template<typename... Args>
+    T&
+    growAndEmplace(Args&&... _args)
+    {
+      if constexpr (canGrow) {
+        SIZE_T newCapacity = nextCapacity(m_size + 1);
+        T* block = allocate(newCapacity);
+        T* element = new (block + m_size) T(std::forward<Args>(_args)...);
+        relocate(data(), block, m_size);
+        freeHeap();
+        this->m_data = block;
+        this->m_capacity = newCapacity;
+        ++m_size;
+        return *element;
+      }
+      else {
+        overflow();
+      }
+    }
+
+    /*
+     * A FixedVector has no room left, and writing past the buffer would
+     * corrupt the memory around it silently.
+     */
+    [[noreturn]] static void
+    overflow()
+    {
+      NF_ASSERT(false && "FixedVector overflow");
+      std::abort();
+    }
+
+    FORCEINLINE void
+    append(const T* _values, SIZE_T _count)
+    {
+      reserve(m_size + _count);
+      std::uninitialized_copy(_values, _values + _count, data() + m_size);
+      m_size += _count;
+    }
+
+    /*
+     * Takes the elements of _other, that is left empty. A heap block is
+     * stolen, inline elements are relocated one by one.
+     */
+    void
+    take(TInlineVector& _other)
+    {
+      if constexpr (canGrow) {
+        if (!_other.isInline()) {
+          this->m_data = _other.m_data;
+          this->m_capacity = _other.m_capacity;
+          m_size = _other.m_size;
+          _other.m_data = reinterpret_cast<T*>(_other.m_inline);
+          _other.m_capacity = N;
+          _other.m_size = 0;
+          return;
+        }
+      }
+      relocate(_other.data(), data(), _other.m_size);
+      m_size = _other.m_size;
+      _other.m_size = 0;
+    }
+  };
+
+  /**
+   * @brief
+   * A vector with room for N elements inside, past them it moves to the
+   * heap like a Vector.
+   */
+  template<typename T, SIZE_T N>
+  using SmallVector = TInlineVector<T, N, true>;
+
+  /**
+   * @brief
+   * A vector of up to N elements that never allocates, going past N aborts
+   * the program.
+   */
+  template<typename T, SIZE_T N>
+  using FixedVector = TInlineVector<T, N, false>;
+}
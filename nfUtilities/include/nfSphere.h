@@ -0,0 +1,144 @@
+/************************************************************************/
+/**
+ * @file nfSphere.h
+ * @author Mara Castellanos
+ * @date 18/10/26
+ * @brief This file defines the Sphere, a center and a radius.
+ *
+ * @bug Not bug Known.
+ */
+/************************************************************************/
+
+#pragma once
+
+#include "nfPrerequisitesUtilities.h"
+#include "nfVector3.h"
+
+namespace nfEngineSDK {
+  /**
+   * @brief
+   * A sphere, for bounding volumes and intersections.
+   */
+  class NF_UTILITIES_EXPORT Sphere
+  {
+   public:
+    /**
+     * @brief
+     * The default constructor.
+     */
+    Sphere() = default;
+    /**
+     * @brief
+     * Initializes the sphere with the center and radius given.
+     *
+     * @param _center
+     * The center of the sphere.
+     * @param _radious
+     * The radius of the sphere.
+     */
+    FORCEINLINE
+    Sphere(const Vector3f& _center, float _radious)
+      : m_center(_center), m_radious(_radious) {}
+    /**
+     * @brief
+     * Frees the memory allocated on the sphere.
+     */
+    ~Sphere() = default;
+
+    /**
+     * @brief
+     * Returns the center of the sphere.
+     *
+     * @return
+     * The center of the sphere.
+     */
+    FORCEINLINE const Vector3f&
+    getCenter() const
+    {
+      return m_center;
+    }
+    /**
+     * @brief
+     * Changes the center of the sphere.
+     *
+     * @param _center
+     * The new center.
+     */
+    FORCEINLINE void
+    setCenter(const Vector3f& _center)
+    {
+      m_center = _center;
+    }
+    /**
+     * @brief
+     * Returns the radius of the sphere.
+     *
+     * @return
+     * The radius of the sphere.
+     */
+    FORCEINLINE float
+    getRadious() const
+    {
+      return m_radious;
+    }
+    /**
+     * @brief
+     * Changes the radius of the sphere.
+     *
+     * @param _radious
+     * The new radius.
+     */
+    FORCEINLINE void
+    setRadious(float _radious)
+    {
+      m_radious = _radious;
+    }
+
+    /**
+     * @brief
+     * Checks if a point is inside the sphere or on its surface.
+     *
+     * @param _point
+     * The point to check.
+     *
+     * @return
+     * True if the point is inside.
+     */
+    FORCEINLINE bool
+    contains(const Vector3f& _point) const
+    {
+      Vector3f d = _point - m_center;
+      return d.dot(d) <= m_radious * m_radious;
+    }
+
+    /**
+     * @brief
+     * A sphere around a set of points, with Ritter's algorithm. It is not the
+     * smallest one, usually up to 5% to 20% bigger, but it takes only two
+     * passes over the points.
+     *
+     * @param _points
+     * The first point.
+     * @param _stride
+     * The bytes between a point and the next one, to read the positions of
+     * an array of vertices.
+     * @param _count
+     * The number of points.
+     *
+     * @return
+     * A sphere that contains all the points.
+     */
+    static Sphere
+    fromPoints(const Vector3f* _points, SIZE_T _stride, SIZE_T _count);
+
+   private:
+    /*
+     * The center of the sphere.
+     */
+    Vector3f m_center;
+    /*
+     * The radius of the sphere.
+     */
+    float m_radious;
+  };
+}
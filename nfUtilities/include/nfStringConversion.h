@@ -0,0 +1,413 @@
+/************************************************************************/
+/**
+ * @file nfStringConversion.h
+ * @author Mara Castellanos
+ * @date 18/10/26
+ * @brief Text formatting and parsing of the numbers, vectors and matrices
+ *        into buffers of the caller, without allocations.
+ *
+ * @bug Not bug Known.
+ */
+/************************************************************************/
+
+#pragma once
+
+#include "nfPrerequisitesUtilities.h"
+#include "nfVectorN.h"
+
+namespace nfEngineSDK {
+  /**
+   * @brief
+   * Writes and reads the math types as text, "{ x, y, z }" for the vectors
+   * and "{ { m00, m01 }, { m10, m11 } }" for the matrices, by rows.
+   *
+   * @description
+   * The floats are written with std::to_chars in the shortest form that
+   * reads back to the same float, so fromChars(toChars(v)) == v for every
+   * finite value. Nothing is allocated, the caller gives the buffer.
+   *
+   * toChars returns the end of what was written, or null if the buffer is
+   * too small (maxChars<T>() is always enough). fromChars skips the spaces
+   * and returns the end of what was read, or null if the text is not
+   * valid.
+   */
+  class NF_UTILITIES_EXPORT StringConversion
+  {
+   public:
+    /**
+     * @brief
+     * The most chars toChars() writes for a value of type T.
+     *
+     * @return
+     * The number of chars.
+     */
+    template<class T>
+    static constexpr SIZE_T
+    maxChars()
+    {
+      if constexpr (std::is_same<T, float>::value) {
+        /* -1.23456789e-38 */
+        return 16;
+      }
+      else if constexpr (std::is_same<T, int32>::value ||
+                         std::is_same<T, uint32>::value) {
+        return 11;
+      }
+      else if constexpr (std::is_same<T, int64>::value ||
+                         std::is_same<T, uint64>::value) {
+        return 20;
+      }
+      else if constexpr (std::is_same<T, Matrix2f>::value) {
+        return matrixChars(2, 2);
+      }
+      else if constexpr (std::is_same<T, Matrix3f>::value) {
+        return matrixChars(3, 3);
+      }
+      else if constexpr (std::is_same<T, Matrix4f>::value) {
+        return matrixChars(4, 4);
+      }
+      else {
+        /* The vectors, "{ " + N components + (N-1) ", " + " }". */
+        return T::kSIZE * maxChars<typename T::ValueType>() + T::kSIZE * 2 + 2;
+      }
+    }
+
+    /**
+     * @brief
+     * Writes a float.
+     *
+     * @param _first
+     * The first char of the buffer.
+     * @param _last
+     * The end of the buffer.
+     * @param _value
+     * The value.
+     *
+     * @return
+     * The end of the text, null if it doesn't fit.
+     */
+    static char*
+    toChars(char* _first, char* _last, float _value);
+    /**
+     * @brief
+     * Writes an int32.
+     */
+    static char*
+    toChars(char* _first, char* _last, int32 _value);
+    /**
+     * @brief
+     * Writes an uint32.
+     */
+    static char*
+    toChars(char* _first, char* _last, uint32 _value);
+    /**
+     * @brief
+     * Writes an int64.
+     */
+    static char*
+    toChars(char* _first, char* _last, int64 _value);
+    /**
+     * @brief
+     * Writes an uint64.
+     */
+    static char*
+    toChars(char* _first, char* _last, uint64 _value);
+    /**
+     * @brief
+     * Writes a vector, "{ x, y, z }".
+     *
+     * @param _first
+     * The first char of the buffer.
+     * @param _last
+     * The end of the buffer.
+     * @param _vector
+     * The vector.
+     *
+     * @return
+     * The end of the text, null if it doesn't fit.
+     */
+    template<typename T, uint32 N, class Derived>
+    static char*
+    toChars(char* _first, char* _last, const TVector<T, N, Derived>& _vector)
+    {
+      return toCharsList(_first, _last, _vector.data(), N);
+    }
+    /**
+     * @brief
+     * Writes a matrix, "{ { m00, m01 }, { m10, m11 } }".
+     */
+    static char*
+    toChars(char* _first, char* _last, const Matrix2f& _matrix);
+    /**
+     * @brief
+     * Writes a matrix, by rows.
+     */
+    static char*
+    toChars(char* _first, char* _last, const Matrix3f& _matrix);
+    /**
+     * @brief
+     * Writes a matrix, by rows.
+     */
+    static char*
+    toChars(char* _first, char* _last, const Matrix4f& _matrix);
+
+    /**
+     * @brief
+     * Reads a float.
+     *
+     * @param _first
+     * The first char of the text.
+     * @param _last
+     * The end of the text.
+     * @param _value
+     * Where the value is written, only on success.
+     *
+     * @return
+     * The end of the value read, null if the text is not a float.
+     */
+    static const char*
+    fromChars(const char* _first, const char* _last, float& _value);
+    /**
+     * @brief
+     * Reads an int32.
+     */
+    static const char*
+    fromChars(const char* _first, const char* _last, int32& _value);
+    /**
+     * @brief
+     * Reads an uint32.
+     */
+    static const char*
+    fromChars(const char* _first, const char* _last, uint32& _value);
+    /**
+     * @brief
+     * Reads a vector, "{ x, y, z }".
+     *
+     * @param _first
+     * The first char of the text.
+     * @param _last
+     * The end of the text.
+     * @param _vector
+     * Where the vector is written, only on success.
+     *
+     * @return
+     * The end of the vector read, null if the text is not valid.
+     */
+    template<typename T, uint32 N, class Derived>
+    static const char*
+    fromChars(const char* _first, const char* _last, TVector<T, N, Derived>& _vector)
+    {
+      T values[N];
+      const char* end = fromCharsList(_first, _last, values, N);
+      if (nullptr != end) {
+        for (uint32 i = 0; i < N; ++i) {
+          _vector[i] = values[i];
+        }
+      }
+      return end;
+    }
+    /**
+     * @brief
+     * Reads a matrix, "{ { m00, m01 }, { m10, m11 } }".
+     */
+    static const char*
+    fromChars(const char* _first, const char* _last, Matrix2f& _matrix);
+    /**
+     * @brief
+     * Reads a matrix, by rows.
+     */
+    static const char*
+    fromChars(const char* _first, const char* _last, Matrix3f& _matrix);
+    /**
+     * @brief
+     * Reads a matrix, by rows.
+     */
+    static const char*
+    fromChars(const char* _first, const char* _last, Matrix4f& _matrix);
+
+   private:
+    static constexpr SIZE_T
+    matrixChars(SIZE_T _rows, SIZE_T _columns)
+    {
+      return _rows * (_columns * 16 + _columns * 2 + 2) + _rows * 2 + 2;
+    }
+
+    /*
+     * Write "{ a, b, c }".
+     */
+    static char*
+    toCharsList(char* _first, char* _last, const float* _values, uint32 _count);
+    static char*
+    toCharsList(char* _first, char* _last, const int32* _values, uint32 _count);
+    static char*
+    toCharsList(char* _first, char* _last, const uint32* _values, uint32 _count);
+
+    /*
+     * Read "{ a, b, c }".
+     */
+    static const char*
+    fromCharsList(const char* _first, const char* _last, float* _values, uint32 _count);
+    static const char*
+    fromCharsList(const char* _first, const char* _last, int32* _values, uint32 _count);
+    static const char*
+    fromCharsList(const char* _first, const char* _last, uint32* _values, uint32 _count);
+
+    static char*
+    toCharsMatrix(char* _first, char* _last, const float* _values, uint32 _size);
+
+    static const char*
+    fromCharsMatrix(const char* _first, const char* _last, float* _values, uint32 _size);
+  };
+
+  /**
+   * @brief
+   * Writes text to a fixed buffer and gives it to a sink when it fills, for
+   * dumps of many values without an allocation per value.
+   */
+  class NF_UTILITIES_EXPORT TextWriter
+  {
+   public:
+    /*
+     * Where the text goes, a file or a socket usually.
+     */
+    using Sink = Function<void(const char*, SIZE_T)>;
+
+    /**
+     * @brief
+     * Creates the writer.
+     *
+     * @param _sink
+     * Called with the text every time the buffer fills and on flush().
+     * @param _bufferSize
+     * The size of the buffer, it must fit the biggest value written.
+     */
+    explicit
+    TextWriter(const Sink& _sink, SIZE_T _bufferSize = kDEFAULT_BUFFER_SIZE);
+    /**
+     * @brief
+     * Creates a writer to a stream.
+     *
+     * @param _stream
+     * The stream, it must live while the writer does.
+     * @param _bufferSize
+     * The size of the buffer, it must fit the biggest value written.
+     */
+    explicit
+    TextWriter(OFStream& _stream, SIZE_T _bufferSize = kDEFAULT_BUFFER_SIZE);
+    TextWriter(const TextWriter&) = delete;
+    /**
+     * @brief
+     * Flushes the text left.
+     */
+    ~TextWriter();
+
+    TextWriter&
+    operator=(const TextWriter&) = delete;
+
+    /**
+     * @brief
+     * Writes a value with StringConversion::toChars().
+     *
+     * @param _value
+     * The value.
+     *
+     * @return
+     * This writer.
+     */
+    template<class T>
+    TextWriter&
+    write(const T& _value)
+    {
+      char* end = StringConversion::toChars(m_position, m_end, _value);
+      if (nullptr == end) {
+        flush();
+        end = StringConversion::toChars(m_position, m_end, _value);
+        assertm(nullptr != end, "The buffer of the TextWriter is too small");
+      }
+      m_position = end;
+      return *this;
+    }
+    /**
+     * @brief
+     * Writes some text as it is.
+     *
+     * @param _text
+     * The text.
+     * @param _size
+     * The number of chars.
+     *
+     * @return
+     * This writer.
+     */
+    TextWriter&
+    write(const char* _text, SIZE_T _size);
+    /**
+     * @brief
+     * Writes a null terminated text as it is.
+     */
+    TextWriter&
+    write(const char* _text);
+    /**
+     * @brief
+     * Writes a string as it is.
+     */
+    TextWriter&
+    write(const String& _text);
+
+    /**
+     * @brief
+     * Writes an array of values with a separator after each one.
+     *
+     * @param _values
+     * The values.
+     * @param _count
+     * The number of values.
+     * @param _separator
+     * What goes after every value.
+     *
+     * @return
+     * This writer.
+     */
+    template<class T>
+    TextWriter&
+    writeArray(const T* _values, SIZE_T _count, const char* _separator = "\n")
+    {
+      SIZE_T separatorSize = std::char_traits<char>::length(_separator);
+      for (SIZE_T i = 0; i < _count; ++i) {
+        write(_values[i]);
+        write(_separator, separatorSize);
+      }
+      return *this;
+    }
+
+    /**
+     * @brief
+     * Gives the text in the buffer to the sink.
+     */
+    void
+    flush();
+
+    /*
+     * The buffer size when none is given.
+     */
+    static const SIZE_T kDEFAULT_BUFFER_SIZE = 64 * 1024;
+
+   private:
+    /*
+     * Where the text goes.
+     */
+    Sink m_sink;
+    /*
+     * The buffer.
+     */
+    Vector<char> m_buffer;
+    /*
+     * Where the next char goes.
+     */
+    char* m_position;
+    /*
+     * The end of the buffer.
+     */
+    char* m_end;
+  };
+}
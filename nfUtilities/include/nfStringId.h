@@ -0,0 +1,265 @@
+/************************************************************************/
+/**
+ * @file nfStringId.h
+ * @author Mara Castellanos
+ * @date 18/10/26
+ * @brief This file defines the StringId, a 64 bits hash of a string that
+ *        replaces it as a key, and the StringInterner that keeps the text
+ *        of the ids.
+ *
+ * @bug Not bug Known.
+ */
+/************************************************************************/
+
+#pragma once
+
+#include "nfPrerequisitesUtilities.h"
+#include "nfFlatHashMap.h"
+
+namespace nfEngineSDK {
+  /**
+   * @brief
+   * The FNV-1a hash of a string, in 8 bytes.
+   *
+   * @description
+   * The ids of the literals are computed by the compiler:
+   *
+   *   constexpr StringId kJUMP("Jump");
+   *   switch (event.getId()) { case StringId("Jump").getId(): ... }
+   *
+   * Comparing or hashing an id is comparing an integer, a map keyed by
+   * StringId never compares or allocates strings. The id doesn't keep the
+   * text, StringInterner does it for the strings that need it back.
+   *
+   * Two strings can give the same id, with 64 bits it is unlikely for the
+   * number of names of a game; the interner asserts if it sees it.
+   */
+  class StringId
+  {
+   public:
+    static constexpr uint64 kFNV_OFFSET = 0xCBF29CE484222325ull;
+    static constexpr uint64 kFNV_PRIME = 0x00000100000001B3ull;
+
+    /**
+     * @brief
+     * The null id, of no string.
+     */
+    constexpr StringId() = default;
+    /**
+     * @brief
+     * The id of a string literal, at compile time. The characters up to
+     * the first '\0' are hashed, so a char buffer gives the id of its string
+     * and not of the garbage after it. Use the pointer and size constructor
+     * for a string with '\0' inside.
+     */
+    template<SIZE_T N>
+    explicit constexpr StringId(const char (&_literal)[N])
+      : m_id(hash(_literal, length(_literal, N - 1))) {}
+    /**
+     * @brief
+     * The id of _size characters.
+     */
+    constexpr StringId(const char* _string, SIZE_T _size)
+      : m_id(hash(_string, _size)) {}
+    /**
+     * @brief
+     * The id of a string.
+     */
+    explicit StringId(const String& _string)
+      : m_id(hash(_string.data(), _string.size())) {}
+
+    /**
+     * @brief
+     * The id of a value returned by getId().
+     */
+    static constexpr StringId
+    fromId(uint64 _id)
+    {
+      StringId id;
+      id.m_id = _id;
+      return id;
+    }
+
+    /**
+     * @brief
+     * The FNV-1a hash of the characters.
+     */
+    static constexpr uint64
+    hash(const char* _string, SIZE_T _size)
+    {
+      uint64 value = kFNV_OFFSET;
+      for (SIZE_T i = 0; i < _size; ++i) {
+        value ^= static_cast<uint8>(_string[i]);
+        value *= kFNV_PRIME;
+      }
+      return value;
+    }
+
+    /**
+     * @brief
+     * The characters before the first '\0', up to _max.
+     */
+    static constexpr SIZE_T
+    length(const char* _string, SIZE_T _max)
+    {
+      SIZE_T size = 0;
+      while (size < _max && '\0' != _string[size]) {
+        ++size;
+      }
+      return size;
+    }
+
+    FORCEINLINE constexpr uint64
+    getId() const
+    {
+      return m_id;
+    }
+    /**
+     * @brief
+     * If it is not the null id.
+     */
+    FORCEINLINE constexpr bool
+    isValid() const
+    {
+      return 0 != m_id;
+    }
+
+    FORCEINLINE constexpr bool
+    operator==(const StringId& _other) const
+    {
+      return m_id == _other.m_id;
+    }
+    FORCEINLINE constexpr bool
+    operator!=(const StringId& _other) const
+    {
+      return m_id != _other.m_id;
+    }
+    /**
+     * @brief
+     * An order of the ids to use them on a Map, not the order of the
+     * strings.
+     */
+    FORCEINLINE constexpr bool
+    operator<(const StringId& _other) const
+    {
+      return m_id < _other.m_id;
+    }
+
+   private:
+    uint64 m_id = 0;
+  };
+
+  /**
+   * @brief
+   * The id is already a hash, FlatHashMap only mixes it.
+   */
+  template<>
+  struct FlatHash<StringId>
+  {
+    FORCEINLINE SIZE_T
+    operator()(const StringId& _id) const
+    {
+      return HashMix::mix(_id.getId());
+    }
+  };
+
+  /**
+   * @brief
+   * Keeps one copy of every string interned, found by its StringId.
+   *
+   * @description
+   * intern() gives the id of a string and keeps its text, getString() gives
+   * the text back: to write names on the logs or the tools, or to pass the
+   * text of a name from a file around as an id and a pointer that lives
+   * until the end of the program. The text is never freed or moved.
+   *
+   * On the debug builds, the ids made at run time from a String or a
+   * pointer and a size with make() are interned too, so getString() can
+   * show most of the ids. The literal ids can't record their text from the
+   * compiler, only the literals that also went through intern() or make()
+   * are found.
+   *
+   * All the functions can be called from any thread. The ids are the same
+   * with or without the interner, two threads or two runs.
+   */
+  class NF_UTILITIES_EXPORT StringInterner
+  {
+   public:
+    /**
+     * @brief
+     * Keeps the string and gives its id.
+     *
+     * @param _string
+     * The characters, don't need a '\0'.
+     * @param _size
+     * The number of characters.
+     *
+     * @return
+     * The id, the same as StringId(_string, _size).
+     */
+    static StringId
+    intern(const char* _string, SIZE_T _size);
+    static FORCEINLINE StringId
+    intern(const String& _string)
+    {
+      return intern(_string.data(), _string.size());
+    }
+
+    /**
+     * @brief
+     * The id of a string made at run time, interned on the debug builds
+     * for getString().
+     */
+    static FORCEINLINE StringId
+    make(const char* _string, SIZE_T _size)
+    {
+#if NF_DEBUG_MODE
+      return intern(_string, _size);
+#else
+      return StringId(_string, _size);
+#endif
+    }
+    static FORCEINLINE StringId
+    make(const String& _string)
+    {
+      return make(_string.data(), _string.size());
+    }
+
+    /**
+     * @brief
+     * The text of an id.
+     *
+     * @return
+     * The interned string, ended by '\0', or nullptr if the id was never
+     * interned.
+     */
+    static const char*
+    getString(StringId _id);
+
+    /**
+     * @brief
+     * The text of an id for the logs: the string or the id in hexadecimal.
+     */
+    static String
+    toString(StringId _id);
+
+    /**
+     * @brief
+     * The number of strings interned.
+     */
+    static SIZE_T
+    getCount();
+  };
+}
+
+namespace std {
+  template<>
+  struct hash<nfEngineSDK::StringId>
+  {
+    size_t
+    operator()(const nfEngineSDK::StringId& _id) const
+    {
+      return static_cast<size_t>(_id.getId());
+    }
+  };
+}
@@ -0,0 +1,238 @@
+/************************************************************************/
+/**
+ * @file nfTime.h
+ * @author Mara Castellanos
+ * @date 18/10/26
+ * @brief The frame time, the fixed time step and a fast monotonic clock.
+ *
+ * @bug Not bug Known.
+ */
+/************************************************************************/
+
+#pragma once
+
+#include "nfPrerequisitesUtilities.h"
+
+namespace nfEngineSDK {
+  /**
+   * @brief
+   * Measures the time of the frames and accumulates it for the fixed time
+   * step, and gives the clock used by the instrumentation.
+   *
+   * @description
+   * now() reads the time stamp counter of the CPU when it ticks at a
+   * constant rate (invariant TSC), calibrated once against steady_clock on
+   * the first call, so a read costs a few nanoseconds. Without it now()
+   * falls back to steady_clock in nanoseconds. The ticks are only
+   * comparable inside the same run, convert them with toSeconds().
+   *
+   * The fixed time step is consumed on a loop after update():
+   *
+   *   time.update();
+   *   while (time.consumeFixedStep()) {
+   *     simulate(time.getFixedStep());
+   *   }
+   *   render(time.getFixedAlpha());
+   */
+  class NF_UTILITIES_EXPORT Time
+  {
+   public:
+    /**
+     * @brief
+     * Starts counting from now.
+     */
+    Time();
+
+    /**
+     * @brief
+     * Starts a new frame, it must be called once per frame.
+     */
+    void
+    update();
+
+    /**
+     * @brief
+     * Restarts the elapsed time, the frames and the fixed step accumulator.
+     */
+    void
+    reset();
+
+    /**
+     * @brief
+     * Returns the seconds between the last two update(), clamped to the max
+     * delta.
+     */
+    FORCEINLINE float
+    getDelta() const
+    {
+      return m_delta;
+    }
+
+    /**
+     * @brief
+     * Returns the seconds from the start to the last update().
+     */
+    FORCEINLINE double
+    getElapsed() const
+    {
+      return m_elapsed;
+    }
+
+    /**
+     * @brief
+     * Returns the number of update() since the start.
+     */
+    FORCEINLINE uint64
+    getFrameCount() const
+    {
+      return m_frameCount;
+    }
+
+    /**
+     * @brief
+     * Sets the longest delta a frame can have, so a stall (a breakpoint, a
+     * load) doesn't make the simulation run hundreds of fixed steps.
+     *
+     * @param _seconds
+     * The max delta.
+     */
+    FORCEINLINE void
+    setMaxDelta(float _seconds)
+    {
+      m_maxDelta = _seconds;
+    }
+
+    /**
+     * @brief
+     * Returns the longest delta a frame can have.
+     */
+    FORCEINLINE float
+    getMaxDelta() const
+    {
+      return m_maxDelta;
+    }
+
+    /**
+     * @brief
+     * Sets the seconds of every fixed step.
+     *
+     * @param _seconds
+     * The fixed step, bigger than 0.
+     */
+    void
+    setFixedStep(float _seconds);
+
+    /**
+     * @brief
+     * Returns the seconds of every fixed step.
+     */
+    FORCEINLINE float
+    getFixedStep() const
+    {
+      return m_fixedStep;
+    }
+
+    /**
+     * @brief
+     * Takes a fixed step from the time accumulated.
+     *
+     * @return
+     * True if there was a whole step to take.
+     */
+    bool
+    consumeFixedStep();
+
+    /**
+     * @brief
+     * Returns how far the time is between the last fixed step and the next,
+     * from 0 to 1, to interpolate the states for rendering.
+     */
+    FORCEINLINE float
+    getFixedAlpha() const
+    {
+      return static_cast<float>(m_accumulator / m_fixedStep);
+    }
+
+    /**
+     * @brief
+     * Reads the fast monotonic clock.
+     *
+     * @return
+     * The ticks, only for differences and toSeconds().
+     */
+    static uint64
+    now();
+
+    /**
+     * @brief
+     * Converts ticks of now() to seconds.
+     *
+     * @param _ticks
+     * The ticks, usually a difference between two now().
+     *
+     * @return
+     * The seconds.
+     */
+    static double
+    toSeconds(uint64 _ticks);
+
+    /**
+     * @brief
+     * Converts seconds to ticks of now().
+     *
+     * @param _seconds
+     * The seconds.
+     *
+     * @return
+     * The ticks.
+     */
+    static uint64
+    fromSeconds(double _seconds);
+
+    /**
+     * @brief
+     * Returns the ticks of now() in a second.
+     */
+    static double
+    getTicksPerSecond();
+
+    /**
+     * @brief
+     * Returns true if now() reads the time stamp counter, false if it uses
+     * steady_clock.
+     */
+    static bool
+    isUsingTSC();
+
+   private:
+    /*
+     * The now() of the start and of the last update().
+     */
+    uint64 m_start;
+    uint64 m_last;
+    /*
+     * The seconds from the start to the last update().
+     */
+    double m_elapsed;
+    /*
+     * The time accumulated and not consumed by the fixed steps.
+     */
+    double m_accumulator;
+    /*
+     * The delta of the last frame.
+     */
+    float m_delta;
+    /*
+     * The longest delta of a frame.
+     */
+    float m_maxDelta = 0.25f;
+    /*
+     * The seconds of a fixed step.
+     */
+    float m_fixedStep = 1.0f / 60.0f;
+    /*
+     * The number of update().
+     */
+    uint64 m_frameCount;
+  };
+}
@@ -0,0 +1,339 @@
+/************************************************************************/
+/**
+ * @file nfUtilityCamera.h
+ * @author Mara Castellanos
+ * @date 18/10/26
+ * @brief This file defines the UtilityCamera, a perspective camera that
+ *        keeps its matrices and frustum until its values change.
+ *
+ * @bug Not bug Known.
+ */
+/************************************************************************/
+
+#pragma once
+
+#include "nfPrerequisitesUtilities.h"
+#include "nfFrustum.h"
+#include "nfMatrix4.h"
+#include "nfVector3.h"
+
+namespace nfEngineSDK {
+  /**
+   * @brief
+   * A perspective camera made by an eye, a target and a field of view.
+   *
+   * @description
+   * The view, projection, view projection, their inverses and the frustum
+   * are computed the first time they are asked after a change and kept
+   * until the next one, every setter only marks what depends on it. Several
+   * systems can ask for the matrices every frame without paying for them
+   * more than once.
+   *
+   * The matrices are for row vectors (clip = point * view * projection),
+   * with a depth between 0 and 1, as Matrix4f::viewMatrix and
+   * Matrix4f::perspectiveMatrix. The projection can be reverse-Z (1 at the
+   * near plane, 0 at the far one, for float depth buffers) and can have the
+   * far plane at the infinity.
+   *
+   * The getters update the caches, so a camera shared between threads must
+   * call update before they read it.
+   */
+  class NF_UTILITIES_EXPORT UtilityCamera
+  {
+   public:
+    /**
+     * @brief
+     * A camera on the origin looking to +z, with a field of view of 60
+     * degrees, aspect ratio 1 and planes at 0.1 and 1000.
+     */
+    UtilityCamera();
+    /**
+     * @brief
+     * Frees the memory allocated on the camera.
+     */
+    ~UtilityCamera() = default;
+
+    /**
+     * @brief
+     * Places the camera.
+     *
+     * @param _eye
+     * The position of the camera.
+     * @param _target
+     * The point it looks at.
+     * @param _up
+     * The world up, can't be parallel to the view direction.
+     */
+    FORCEINLINE void
+    lookAt(const Vector3f& _eye, const Vector3f& _target, const Vector3f& _up)
+    {
+      m_eye = _eye;
+      m_target = _target;
+      m_up = _up;
+      m_dirty |= kVIEW_CHANGED;
+    }
+    FORCEINLINE void
+    setEye(const Vector3f& _eye)
+    {
+      m_eye = _eye;
+      m_dirty |= kVIEW_CHANGED;
+    }
+    FORCEINLINE void
+    setTarget(const Vector3f& _target)
+    {
+      m_target = _target;
+      m_dirty |= kVIEW_CHANGED;
+    }
+    FORCEINLINE void
+    setUp(const Vector3f& _up)
+    {
+      m_up = _up;
+      m_dirty |= kVIEW_CHANGED;
+    }
+    /**
+     * @brief
+     * Changes the vertical field of view, in radians.
+     */
+    FORCEINLINE void
+    setFovY(float _fovY)
+    {
+      m_fovY = _fovY;
+      m_dirty |= kPROJECTION_CHANGED;
+    }
+    /**
+     * @brief
+     * Changes the aspect ratio, the width over the height.
+     */
+    FORCEINLINE void
+    setAspectRatio(float _aspectRatio)
+    {
+      m_aspectRatio = _aspectRatio;
+      m_dirty |= kPROJECTION_CHANGED;
+    }
+    /**
+     * @brief
+     * Changes the distances to the near and far planes. The far one is
+     * ignored while the far plane is infinite.
+     */
+    FORCEINLINE void
+    setNearFar(float _near, float _far)
+    {
+      m_near = _near;
+      m_far = _far;
+      m_dirty |= kPROJECTION_CHANGED;
+    }
+    /**
+     * @brief
+     * Uses a reverse-Z projection, 1 at the near plane and 0 at the far one.
+     */
+    FORCEINLINE void
+    setReverseZ(bool _reverseZ)
+    {
+      m_reverseZ = _reverseZ;
+      m_dirty |= kPROJECTION_CHANGED;
+    }
+    /**
+     * @brief
+     * Puts the far plane at the infinity.
+     */
+    FORCEINLINE void
+    setInfiniteFar(bool _infiniteFar)
+    {
+      m_infiniteFar = _infiniteFar;
+      m_dirty |= kPROJECTION_CHANGED;
+    }
+
+    FORCEINLINE const Vector3f&
+    getEye() const
+    {
+      return m_eye;
+    }
+    FORCEINLINE const Vector3f&
+    getTarget() const
+    {
+      return m_target;
+    }
+    FORCEINLINE const Vector3f&
+    getUp() const
+    {
+      return m_up;
+    }
+    FORCEINLINE float
+    getFovY() const
+    {
+      return m_fovY;
+    }
+    FORCEINLINE float
+    getAspectRatio() const
+    {
+      return m_aspectRatio;
+    }
+    FORCEINLINE float
+    getNear() const
+    {
+      return m_near;
+    }
+    FORCEINLINE float
+    getFar() const
+    {
+      return m_far;
+    }
+    FORCEINLINE bool
+    isReverseZ() const
+    {
+      return m_reverseZ;
+    }
+    FORCEINLINE bool
+    isInfiniteFar() const
+    {
+      return m_infiniteFar;
+    }
+
+    /**
+     * @brief
+     * The view matrix, world to camera.
+     */
+    const Matrix4f&
+    getView() const;
+    /**
+     * @brief
+     * The projection matrix, camera to clip.
+     */
+    const Matrix4f&
+    getProjection() const;
+    /**
+     * @brief
+     * The view times the projection, world to clip.
+     */
+    const Matrix4f&
+    getViewProjection() const;
+    /**
+     * @brief
+     * The inverse of the view, camera to world.
+     */
+    const Matrix4f&
+    getInverseView() const;
+    /**
+     * @brief
+     * The inverse of the projection, clip to camera.
+     */
+    const Matrix4f&
+    getInverseProjection() const;
+    /**
+     * @brief
+     * The inverse of the view projection, clip to world.
+     */
+    const Matrix4f&
+    getInverseViewProjection() const;
+    /**
+     * @brief
+     * The frustum of the view projection, in world space.
+     */
+    const Frustum&
+    getFrustum() const;
+    /**
+     * @brief
+     * Computes everything that is out of date, after it the getters don't
+     * write and the camera can be read from several threads.
+     */
+    void
+    update() const;
+
+    /**
+     * @brief
+     * Calculates a perspective matrix with the options of the camera.
+     *
+     * @description
+     * Like Matrix4f::perspectiveMatrix. The reverse-Z and infinite
+     * versions keep the precision of the depth where it is needed: with a
+     * float depth buffer, reverse-Z spreads the error evenly over the
+     * distance.
+     *
+     * @param _fovY
+     * The vertical field of view, in radians.
+     * @param _aspectRatio
+     * The width over the height.
+     * @param _near
+     * The distance to the near plane, bigger than 0.
+     * @param _far
+     * The distance to the far plane, ignored if _infiniteFar.
+     * @param _reverseZ
+     * If the depth goes from 1 at the near plane to 0 at the far one.
+     * @param _infiniteFar
+     * If the far plane is at the infinity.
+     *
+     * @return
+     * The projection matrix.
+     */
+    static Matrix4f
+    perspectiveMatrix(float _fovY,
+                      float _aspectRatio,
+                      float _near,
+                      float _far,
+                      bool _reverseZ,
+                      bool _infiniteFar);
+
+   private:
+    /*
+     * What has to be computed again, a bit per cached value.
+     */
+    static const uint32 kVIEW = 1u << 0;
+    static const uint32 kPROJECTION = 1u << 1;
+    static const uint32 kVIEW_PROJECTION = 1u << 2;
+    static const uint32 kINVERSE_VIEW = 1u << 3;
+    static const uint32 kINVERSE_PROJECTION = 1u << 4;
+    static const uint32 kINVERSE_VIEW_PROJECTION = 1u << 5;
+    static const uint32 kFRUSTUM = 1u << 6;
+    /*
+     * The values that depend on the view and on the projection.
+     */
+    static const uint32 kVIEW_CHANGED = kVIEW | kVIEW_PROJECTION | kINVERSE_VIEW |
+                                        kINVERSE_VIEW_PROJECTION | kFRUSTUM;
+    static const uint32 kPROJECTION_CHANGED = kPROJECTION | kVIEW_PROJECTION |
+                                              kINVERSE_PROJECTION |
+                                              kINVERSE_VIEW_PROJECTION | kFRUSTUM;
+
+    /*
+     * The position of the camera.
+     */
+    Vector3f m_eye;
+    /*
+     * The point the camera looks at.
+     */
+    Vector3f m_target;
+    /*
+     * The world up.
+     */
+    Vector3f m_up;
+    /*
+     * The vertical field of view, in radians.
+     */
+    float m_fovY;
+    /*
+     * The width over the height.
+     */
+    float m_aspectRatio;
+    /*
+     * The distances to the planes.
+     */
+    float m_near;
+    float m_far;
+    /*
+     * The options of the projection.
+     */
+    bool m_reverseZ;
+    bool m_infiniteFar;
+
+    /*
+     * The cached values and the bits of the ones out of date.
+     */
+    mutable Matrix4f m_view;
+    mutable Matrix4f m_projection;
+    mutable Matrix4f m_viewProjection;
+    mutable Matrix4f m_inverseView;
+    mutable Matrix4f m_inverseProjection;
+    mutable Matrix4f m_inverseViewProjection;
+    mutable Frustum m_frustum;
+    mutable uint32 m_dirty;
+  };
+}
@@ -0,0 +1,202 @@
+/************************************************************************/
+/**
+ * @file nfVectorBatch.h
+ * @author Mara Castellanos
+ * @date 18/10/26
+ * @brief Operations over whole arrays of integer vectors, for grid, tile and
+ *        voxel coordinates.
+ *
+ * @bug Not bug Known.
+ */
+/************************************************************************/
+
+#pragma once
+
+#include "nfPrerequisitesUtilities.h"
+
+namespace nfEngineSDK {
+  /**
+   * @brief
+   * Operations over whole arrays of integer vectors.
+   *
+   * @description
+   * The arrays are processed as flat runs of 32 bits integers, with the
+   * widest integer SIMD enabled for the build (AVX2, then SSE4.1), and a
+   * scalar loop for the tail. The output is allowed to be the same array as
+   * any of the inputs.
+   */
+  class NF_UTILITIES_EXPORT VectorBatch
+  {
+   public:
+    /**
+     * @brief
+     * The sum of two arrays of vectors.
+     *
+     * @param a
+     * The first array.
+     * @param b
+     * The second array.
+     * @param out
+     * The array where the results are written.
+     * @param count
+     * The number of vectors on each array.
+     */
+    static void
+    add(const Vector3i* a, const Vector3i* b, Vector3i* out, SIZE_T count);
+    /**
+     * @brief
+     * The subtraction of two arrays of vectors.
+     *
+     * @param a
+     * The first array.
+     * @param b
+     * The second array.
+     * @param out
+     * The array where the results are written.
+     * @param count
+     * The number of vectors on each array.
+     */
+    static void
+    sub(const Vector3i* a, const Vector3i* b, Vector3i* out, SIZE_T count);
+    /**
+     * @brief
+     * The component wise multiplication of two arrays of vectors.
+     *
+     * @param a
+     * The first array.
+     * @param b
+     * The second array.
+     * @param out
+     * The array where the results are written.
+     * @param count
+     * The number of vectors on each array.
+     */
+    static void
+    mul(const Vector3i* a, const Vector3i* b, Vector3i* out, SIZE_T count);
+    /**
+     * @brief
+     * Moves every vector of the array by the same offset.
+     *
+     * @param a
+     * The array of vectors.
+     * @param offset
+     * The offset added to every vector.
+     * @param out
+     * The array where the results are written.
+     * @param count
+     * The number of vectors on the array.
+     */
+    static void
+    add(const Vector3i* a, const Vector3i& offset, Vector3i* out, SIZE_T count);
+    /**
+     * @brief
+     * The cell of a grid where every point of the array falls.
+     *
+     * @description
+     * Divides every component rounding towards negative infinity.
+     *
+     * @param a
+     * The array of points.
+     * @param cellSize
+     * The size of the cells on every axis, can't have 0s.
+     * @param out
+     * The array where the cell coordinates are written.
+     * @param count
+     * The number of vectors on the array.
+     */
+    static void
+    floorDivide(const Vector3i* a,
+                const Vector3i& cellSize,
+                Vector3i* out,
+                SIZE_T count);
+    /**
+     * @brief
+     * The position of every point of the array inside its cell of a grid.
+     *
+     * @description
+     * The residue of floorDivide, between 0 and the cell size.
+     *
+     * @param a
+     * The array of points.
+     * @param cellSize
+     * The size of the cells on every axis, can't have 0s.
+     * @param out
+     * The array where the local coordinates are written.
+     * @param count
+     * The number of vectors on the array.
+     */
+    static void
+    floorModulo(const Vector3i* a,
+                const Vector3i& cellSize,
+                Vector3i* out,
+                SIZE_T count);
+
+    /**
+     * @brief
+     * The sum of two arrays of vectors.
+     */
+    static void
+    add(const Vector2i* a, const Vector2i* b, Vector2i* out, SIZE_T count);
+    /**
+     * @brief
+     * The subtraction of two arrays of vectors.
+     */
+    static void
+    sub(const Vector2i* a, const Vector2i* b, Vector2i* out, SIZE_T count);
+    /**
+     * @brief
+     * The component wise multiplication of two arrays of vectors.
+     */
+    static void
+    mul(const Vector2i* a, const Vector2i* b, Vector2i* out, SIZE_T count);
+    /**
+     * @brief
+     * Moves every vector of the array by the same offset.
+     */
+    static void
+    add(const Vector2i* a, const Vector2i& offset, Vector2i* out, SIZE_T count);
+    /**
+     * @brief
+     * The cell of a grid where every point of the array falls.
+     */
+    static void
+    floorDivide(const Vector2i* a,
+                const Vector2i& cellSize,
+                Vector2i* out,
+                SIZE_T count);
+    /**
+     * @brief
+     * The position of every point of the array inside its cell of a grid.
+     */
+    static void
+    floorModulo(const Vector2i* a,
+                const Vector2i& cellSize,
+                Vector2i* out,
+                SIZE_T count);
+
+    /**
+     * @brief
+     * The sum of two arrays of vectors.
+     */
+    static void
+    add(const Vector3u* a, const Vector3u* b, Vector3u* out, SIZE_T count);
+    /**
+     * @brief
+     * The subtraction of two arrays of vectors.
+     */
+    static void
+    sub(const Vector3u* a, const Vector3u* b, Vector3u* out, SIZE_T count);
+    /**
+     * @brief
+     * The component wise multiplication of two arrays of vectors.
+     */
+    static void
+    mul(const Vector3u* a, const Vector3u* b, Vector3u* out, SIZE_T count);
+    /**
+     * @brief
+     * Moves every vector of the array by the same offset.
+     */
+    static void
+    add(const Vector3u* a, const Vector3u& offset, Vector3u* out, SIZE_T count);
+  };
+}
@@ -0,0 +1,1516 @@
+/************************************************************************/
+/**
+ * @file nfVectorN.h
+ * @author Mara Castellanos
+ * @date 18/10/26
+ * @brief This file defines the generic vector core shared by every Vector2,
+ *        Vector3 and Vector4 form: the component storage, the per type and
+ *        size kernels, and the TVector template with all the component wise
+ *        operations.
+ *
+ * @bug Not bug Known.
+ */
+/************************************************************************/
+
+#pragma once
+
+#include <type_traits>
+
+#include "nfPrerequisitesUtilities.h"
+#include "nfPlatformMath.h"
+#include "nfIntDivisor.h"
+
+#if NF_SIMD_SSE2
+# include <emmintrin.h>
+#endif
+#if NF_SIMD_SSE4_1
+# include <smmintrin.h>
+#endif
+
+namespace nfEngineSDK {
+  /**
+   * @brief
+   * The components of a vector of N elements of type T.
+   *
+   * @description
+   * The generic form only holds an array. The 2, 3 and 4 dimensional forms
+   * are specialized so the components can be taken separately, by name, or
+   * together, in an array.
+   */
+  template<typename T, uint32 N>
+  struct TVectorStorage
+  {
+    TVectorStorage() = default;
+
+    /**
+     * @brief
+     * Pointer to the first component.
+     */
+    FORCEINLINE T*
+    data() { return v; }
+    /**
+     * @brief
+     * Pointer to the first component.
+     */
+    FORCEINLINE const T*
+    data() const { return v; }
+
+    /*
+     * All the components of the vector in an array
+     */
+    T v[N];
+  };
+
+  /**
+   * @brief
+   * The components of a two dimensional vector.
+   */
+  template<typename T>
+  struct TVectorStorage<T, 2>
+  {
+    TVectorStorage() = default;
+    FORCEINLINE constexpr
+    TVectorStorage(T _x, T _y) : x(_x), y(_y) {}
+
+    /**
+     * @brief
+     * Pointer to the first component.
+     */
+    FORCEINLINE T*
+    data() { return xy; }
+    /**
+     * @brief
+     * Pointer to the first component.
+     */
+    FORCEINLINE const T*
+    data() const { return xy; }
+
+    /**
+     * @brief
+     * The components of the vector, in a union so they can be taken separately
+     * or together.
+     */
+    union
+    {
+      struct
+      {
+        /*
+         * The x component of the vector
+         */
+        T x;
+        /*
+         * The y component of the vector
+         */
+        T y;
+      };
+      /*
+       * Both components of the vector in an array
+       */
+      T xy[2];
+    };
+  };
+
+  /**
+   * @brief
+   * The components of a three dimensional vector.
+   */
+  template<typename T>
+  struct TVectorStorage<T, 3>
+  {
+    TVectorStorage() = default;
+    FORCEINLINE constexpr
+    TVectorStorage(T _x, T _y, T _z) : x(_x), y(_y), z(_z) {}
+
+    /**
+     * @brief
+     * Pointer to the first component.
+     */
+    FORCEINLINE T*
+    data() { return xyz; }
+    /**
+     * @brief
+     * Pointer to the first component.
+     */
+    FORCEINLINE const T*
+    data() const { return xyz; }
+
+    /**
+     * @brief
+     * The components of the vector, in a union so they can be taken separately
+     * or together.
+     */
+    union
+    {
+      struct
+      {
+        /*
+         * The x component of the vector
+         */
+        T x;
+        /*
+         * The y component of the vector
+         */
+        T y;
+        /*
+         * The z component of the vector
+         */
+        T z;
+      };
+      /*
+       * All the components of the vector in an array
+       */
+      T xyz[3];
+    };
+  };
+
+  /**
+   * @brief
+   * The components of a four dimensional vector.
+   *
+   * @description
+   * The storage is kept at the natural alignment of T, rather than 16 bytes,
+   * so the vector can live inside packed vertex layouts. The kernels use
+   * unaligned loads, which cost the same as aligned ones on aligned data.
+   */
+  template<typename T>
+  struct TVectorStorage<T, 4>
+  {
+    TVectorStorage() = default;
+    FORCEINLINE constexpr
+    TVectorStorage(T _x, T _y, T _z, T _w) : x(_x), y(_y), z(_z), w(_w) {}
+
+    /**
+     * @brief
+     * Pointer to the first component.
+     */
+    FORCEINLINE T*
+    data() { return xyzw; }
+    /**
+     * @brief
+     * Pointer to the first component.
+     */
+    FORCEINLINE const T*
+    data() const { return xyzw; }
+
+    /**
+     * @brief
+     * The components of the vector, in a union so they can be taken separately
+     * or together.
+     */
+    union
+    {
+      struct
+      {
+        /*
+         * The x component of the vector
+         */
+        T x;
+        /*
+         * The y component of the vector
+         */
+        T y;
+        /*
+         * The z component of the vector
+         */
+        T z;
+        /*
+         * The w component of the vector
+         */
+        T w;
+      };
+      /*
+       * All the components of the vector in an array
+       */
+      T xyzw[4];
+    };
+  };
+
+  /**
+   * @brief
+   * The floating point type used for the magnitudes and distances of a vector
+   * made by T. Specialized by the number types that have their own.
+   */
+  template<typename T>
+  struct TVectorReal
+  {
+    using type = typename std::conditional<std::is_floating_point<T>::value,
+                                           T,
+                                           float>::type;
+  };
+
+  /**
+   * @brief
+   * The scalar, component wise, operations over N elements of type T.
+   *
+   * @description
+   * Every kernel takes raw component pointers, and the result is allowed to
+   * alias any of the inputs. The loops have a compile time trip count so the
+   * compiler fully unrolls them.
+   */
+  template<typename T, uint32 N>
+  struct TVectorKernelsGeneric
+  {
+    static FORCEINLINE void
+    add(const T* a, const T* b, T* r)
+    {
+      for (uint32 i = 0; i < N; ++i) { r[i] = a[i] + b[i]; }
+    }
+    static FORCEINLINE void
+    sub(const T* a, const T* b, T* r)
+    {
+      for (uint32 i = 0; i < N; ++i) { r[i] = a[i] - b[i]; }
+    }
+    static FORCEINLINE void
+    mul(const T* a, const T* b, T* r)
+    {
+      for (uint32 i = 0; i < N; ++i) { r[i] = a[i] * b[i]; }
+    }
+    static FORCEINLINE void
+    div(const T* a, const T* b, T* r)
+    {
+      for (uint32 i = 0; i < N; ++i) { r[i] = a[i] / b[i]; }
+    }
+    static FORCEINLINE void
+    mod(const T* a, const T* b, T* r)
+    {
+      for (uint32 i = 0; i < N; ++i) { r[i] = modOne(a[i], b[i]); }
+    }
+
+    static FORCEINLINE void
+    addScalar(const T* a, T s, T* r)
+    {
+      for (uint32 i = 0; i < N; ++i) { r[i] = a[i] + s; }
+    }
+    static FORCEINLINE void
+    subScalar(const T* a, T s, T* r)
+    {
+      for (uint32 i = 0; i < N; ++i) { r[i] = a[i] - s; }
+    }
+    static FORCEINLINE void
+    mulScalar(const T* a, T s, T* r)
+    {
+      for (uint32 i = 0; i < N; ++i) { r[i] = a[i] * s; }
+    }
+    static FORCEINLINE void
+    divScalar(const T* a, T s, T* r)
+    {
+      for (uint32 i = 0; i < N; ++i) { r[i] = a[i] / s; }
+    }
+    static FORCEINLINE void
+    modScalar(const T* a, T s, T* r)
+    {
+      for (uint32 i = 0; i < N; ++i) { r[i] = modOne(a[i], s); }
+    }
+
+    static FORCEINLINE void
+    scalarSub(T s, const T* a, T* r)
+    {
+      for (uint32 i = 0; i < N; ++i) { r[i] = s - a[i]; }
+    }
+    static FORCEINLINE void
+    scalarDiv(T s, const T* a, T* r)
+    {
+      for (uint32 i = 0; i < N; ++i) { r[i] = s / a[i]; }
+    }
+    static FORCEINLINE void
+    scalarMod(T s, const T* a, T* r)
+    {
+      for (uint32 i = 0; i < N; ++i) { r[i] = modOne(s, a[i]); }
+    }
+
+    static FORCEINLINE void
+    negate(const T* a, T* r)
+    {
+      for (uint32 i = 0; i < N; ++i) { r[i] = -a[i]; }
+    }
+
+    static FORCEINLINE T
+    dot(const T* a, const T* b)
+    {
+      T r = a[0] * b[0];
+      for (uint32 i = 1; i < N; ++i) { r += a[i] * b[i]; }
+      return r;
+    }
+
+    static FORCEINLINE bool
+    equal(const T* a, const T* b)
+    {
+      for (uint32 i = 0; i < N; ++i) {
+        if constexpr (std::is_floating_point<T>::value) {
+          if (!PlatformMath::checkEqual(a[i], b[i])) { return false; }
+        }
+        else {
+          if (a[i] != b[i]) { return false; }
+        }
+      }
+      return true;
+    }
+
+   private:
+    static FORCEINLINE T
+    modOne(T a, T b)
+    {
+      if constexpr (std::is_floating_point<T>::value) {
+        return PlatformMath::fmod(a, b);
+      }
+      else {
+        return a % b;
+      }
+    }
+  };
+
+  /**
+   * @brief
+   * The component wise operations over N elements of type T.
+   *
+   * @description
+   * Selected at compile time. The generic form is the scalar one, the sizes
+   * that fill a SIMD register are specialized below with the instruction sets
+   * enabled for the build.
+   */
+  template<typename T, uint32 N>
+  struct TVectorKernels : public TVectorKernelsGeneric<T, N>
+  {};
+
+#if NF_SIMD_SSE2 && !NF_MATH_DETERMINISTIC
+  /**
+   * @brief
+   * SSE kernels for four floats. The dot product adds in a different order
+   * than the generic one, so the deterministic math keeps the generic form.
+   */
+  template<>
+  struct TVectorKernels<float, 4> : public TVectorKernelsGeneric<float, 4>
+  {
+    static FORCEINLINE void
+    add(const float* a, const float* b, float* r)
+    {
+      _mm_storeu_ps(r, _mm_add_ps(_mm_loadu_ps(a), _mm_loadu_ps(b)));
+    }
+    static FORCEINLINE void
+    sub(const float* a, const float* b, float* r)
+    {
+      _mm_storeu_ps(r, _mm_sub_ps(_mm_loadu_ps(a), _mm_loadu_ps(b)));
+    }
+    static FORCEINLINE void
+    mul(const float* a, const float* b, float* r)
+    {
+      _mm_storeu_ps(r, _mm_mul_ps(_mm_loadu_ps(a), _mm_loadu_ps(b)));
+    }
+    static FORCEINLINE void
+    div(const float* a, const float* b, float* r)
+    {
+      _mm_storeu_ps(r, _mm_div_ps(_mm_loadu_ps(a), _mm_loadu_ps(b)));
+    }
+
+    static FORCEINLINE void
+    addScalar(const float* a, float s, float* r)
+    {
+      _mm_storeu_ps(r, _mm_add_ps(_mm_loadu_ps(a), _mm_set1_ps(s)));
+    }
+    static FORCEINLINE void
+    subScalar(const float* a, float s, float* r)
+    {
+      _mm_storeu_ps(r, _mm_sub_ps(_mm_loadu_ps(a), _mm_set1_ps(s)));
+    }
+    static FORCEINLINE void
+    mulScalar(const float* a, float s, float* r)
+    {
+      _mm_storeu_ps(r, _mm_mul_ps(_mm_loadu_ps(a), _mm_set1_ps(s)));
+    }
+    static FORCEINLINE void
+    divScalar(const float* a, float s, float* r)
+    {
+      _mm_storeu_ps(r, _mm_div_ps(_mm_loadu_ps(a), _mm_set1_ps(s)));
+    }
+
+    static FORCEINLINE void
+    scalarSub(float s, const float* a, float* r)
+    {
+      _mm_storeu_ps(r, _mm_sub_ps(_mm_set1_ps(s), _mm_loadu_ps(a)));
+    }
+    static FORCEINLINE void
+    scalarDiv(float s, const float* a, float* r)
+    {
+      _mm_storeu_ps(r, _mm_div_ps(_mm_set1_ps(s), _mm_loadu_ps(a)));
+    }
+
+    static FORCEINLINE void
+    negate(const float* a, float* r)
+    {
+      _mm_storeu_ps(r, _mm_xor_ps(_mm_loadu_ps(a), _mm_set1_ps(-0.0f)));
+    }
+
+    static FORCEINLINE float
+    dot(const float* a, const float* b)
+    {
+      __m128 m = _mm_mul_ps(_mm_loadu_ps(a), _mm_loadu_ps(b));
+      __m128 s = _mm_add_ps(m, _mm_shuffle_ps(m, m, _MM_SHUFFLE(1, 0, 3, 2)));
+      s = _mm_add_ss(s, _mm_shuffle_ps(s, s, _MM_SHUFFLE(0, 1, 0, 1)));
+      return _mm_cvtss_f32(s);
+    }
+  };
+#endif
+
+#if NF_SIMD_SSE2
+  /**
+   * @brief
+   * SSE kernels for four 32 bits integers, signed or unsigned. Division and
+   * module have no SIMD instruction, so they stay on the generic form.
+   */
+  template<typename T>
+  struct TVectorKernelsSSEInt32 : public TVectorKernelsGeneric<T, 4>
+  {
+    static FORCEINLINE __m128i
+    load(const T* a)
+    {
+      return _mm_loadu_si128(reinterpret_cast<const __m128i*>(a));
+    }
+    static FORCEINLINE void
+    store(T* r, __m128i v)
+    {
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(r), v);
+    }
+    static FORCEINLINE __m128i
+    splat(T s)
+    {
+      return _mm_set1_epi32(static_cast<int32>(s));
+    }
+    static FORCEINLINE __m128i
+    mullo(__m128i a, __m128i b)
+    {
+#if NF_SIMD_SSE4_1
+      return _mm_mullo_epi32(a, b);
+#else
+      __m128i even = _mm_mul_epu32(a, b);
+      __m128i odd = _mm_mul_epu32(_mm_srli_epi64(a, 32), _mm_srli_epi64(b, 32));
+      return _mm_unpacklo_epi32(_mm_shuffle_epi32(even, _MM_SHUFFLE(0, 0, 2, 0)),
+                                _mm_shuffle_epi32(odd, _MM_SHUFFLE(0, 0, 2, 0)));
+#endif
+    }
+
+    static FORCEINLINE void
+    add(const T* a, const T* b, T* r)
+    {
+      store(r, _mm_add_epi32(load(a), load(b)));
+    }
+    static FORCEINLINE void
+    sub(const T* a, const T* b, T* r)
+    {
+      store(r, _mm_sub_epi32(load(a), load(b)));
+    }
+    static FORCEINLINE void
+    mul(const T* a, const T* b, T* r)
+    {
+      store(r, mullo(load(a), load(b)));
+    }
+
+    static FORCEINLINE void
+    addScalar(const T* a, T s, T* r)
+    {
+      store(r, _mm_add_epi32(load(a), splat(s)));
+    }
+    static FORCEINLINE void
+    subScalar(const T* a, T s, T* r)
+    {
+      store(r, _mm_sub_epi32(load(a), splat(s)));
+    }
+    static FORCEINLINE void
+    mulScalar(const T* a, T s, T* r)
+    {
+      store(r, mullo(load(a), splat(s)));
+    }
+
+    static FORCEINLINE void
+    scalarSub(T s, const T* a, T* r)
+    {
+      store(r, _mm_sub_epi32(splat(s), load(a)));
+    }
+  };
+
+  template<>
+  struct TVectorKernels<int32, 4> : public TVectorKernelsSSEInt32<int32>
+  {};
+  template<>
+  struct TVectorKernels<uint32, 4> : public TVectorKernelsSSEInt32<uint32>
+  {};
+#endif
+
+  /**
+   * @brief
+   * Generic vector of N components of type T.
+   *
+   * @description
+   * Holds every operation that is the same for all the vector forms, so each
+   * one is written once and dispatched at compile time to the kernels of its
+   * type and size. The concrete vectors (Vector3f, Vector2i, Point4D...)
+   * derive from it passing themselves as Derived, so every operation returns
+   * the concrete type. With Derived left as void the template can be used by
+   * itself, for any size.
+   */
+  template<typename T, uint32 N, class Derived = void>
+  class TVector : public TVectorStorage<T, N>
+  {
+   public:
+    /**
+     * @brief
+     * The type returned by the operations.
+     */
+    using Self = typename std::conditional<std::is_void<Derived>::value,
+                                           TVector,
+                                           Derived>::type;
+    /**
+     * @brief
+     * The type of the components.
+     */
+    using ValueType = T;
+    /**
+     * @brief
+     * The floating point type used for magnitudes and distances.
+     */
+    using RealType = typename TVectorReal<T>::type;
+    /**
+     * @brief
+     * The kernels used for the operations.
+     */
+    using Kernels = TVectorKernels<T, N>;
+
+    /**
+     * @brief
+     * The number of components.
+     */
+    static constexpr uint32 kSIZE = N;
+
+    /**
+     * @brief
+     * The default constructor.
+     */
+    TVector() = default;
+
+    using TVectorStorage<T, N>::TVectorStorage;
+
+    /**
+     * @brief
+     * Access to a component.
+     *
+     * @param index
+     * The index of the component, less than N.
+     *
+     * @return
+     * The component on that index.
+     */
+    FORCEINLINE T&
+    operator[](uint32 index)
+    {
+      NF_ASSERT(index < N);
+      return this->data()[index];
+    }
+    /**
+     * @brief
+     * Access to a component.
+     *
+     * @param index
+     * The index of the component, less than N.
+     *
+     * @return
+     * The component on that index.
+     */
+    FORCEINLINE const T&
+    operator[](uint32 index) const
+    {
+      NF_ASSERT(index < N);
+      return this->data()[index];
+    }
+
+    /**
+     * @brief
+     * The dot product of two vectors.
+     *
+     * @description
+     * Returns the result of the dot product between the
+     * current vector and the one pass to the function.
+     *
+     * @param other
+     * The other vector for the dot product.
+     *
+     * @return
+     * The result of the dot product of the two vectors.
+     */
+    FORCEINLINE T
+    dot(const Self& other) const
+    {
+      return Kernels::dot(this->data(), other.data());
+    }
+
+    /**
+     * @brief
+     * The squared distance between two points.
+     *
+     * @description
+     * Returns the squared distance between the current point and the one
+     * given in the function. Cheaper than getDistance, for comparisons.
+     *
+     * @param other
+     * The other point for the distance calculation.
+     *
+     * @return
+     * The squared distance between the point and the other point.
+     */
+    FORCEINLINE T
+    getDistanceSquared(const Self& other) const
+    {
+      Self d = other - self();
+      return d.dot(d);
+    }
+    /**
+     * @brief
+     * The distance between two points.
+     *
+     * @description
+     * Returns the distance between the current point and
+     * the one given in the function.
+     *
+     * @param other
+     * The other point for the distance calculation.
+     *
+     * @return
+     * The distance between the point and the other point.
+     */
+    FORCEINLINE RealType
+    getDistance(const Self& other) const
+    {
+      return PlatformMath::sqrt(static_cast<RealType>(getDistanceSquared(other)));
+    }
+
+    /**
+     * @brief
+     * The squared length of the vector.
+     *
+     * @description
+     * Returns the squared size of the vector in the space. Cheaper than
+     * getMagnitude, for comparisons.
+     *
+     * @return
+     * The squared length of the vector.
+     */
+    FORCEINLINE T
+    getMagnitudeSquared() const
+    {
+      return Kernels::dot(this->data(), this->data());
+    }
+    /**
+     * @brief
+     * The length of the vector.
+     *
+     * @description
+     * Returns the size of the vector in the space.
+     *
+     * @return
+     * The length of the vector.
+     */
+    FORCEINLINE RealType
+    getMagnitude() const
+    {
+      return PlatformMath::sqrt(static_cast<RealType>(getMagnitudeSquared()));
+    }
+    /**
+     * @brief
+     * The normalization of the vector.
+     *
+     * @description
+     * Returns an unitary vector with the same direction
+     * of the original.
+     *
+     * @return
+     * The vector normalized.
+     */
+    FORCEINLINE Self
+    getNormalized() const
+    {
+      static_assert(!std::is_integral<T>::value,
+                    "Integer vectors can't be normalized");
+      return self() / getMagnitude();
+    }
+    /**
+     * @brief
+     * Normalizes the vector.
+     *
+     * @description
+     * Modifies the vector to its unitary form, maintaining its direction
+     * and returns this new vector.
+     *
+     * @return
+     * The vector normalized.
+     */
+    FORCEINLINE Self
+    normalize()
+    {
+      static_assert(!std::is_integral<T>::value,
+                    "Integer vectors can't be normalized");
+      return self() /= getMagnitude();
+    }
+    /**
+     * @brief
+     * A truncate version of the vector with the new size.
+     *
+     * @description
+     * Returns a vector with the same direction as the original
+     * but with the new size given.
+     *
+     * @param newSize
+     * The desired size of the new vector.
+     *
+     * @return
+     * The vector truncated with the new size.
+     */
+    FORCEINLINE Self
+    getTruncate(T newSize) const
+    {
+      assertm(newSize >= T(0), "Size can't be negative for a Vector");
+      return getNormalized() * newSize;
+    }
+    /**
+     * @brief
+     * Changes the magnitude of the vector with the new size.
+     *
+     * @description
+     * Modifies the vector with the same direction as the original
+     * but with the new size given and returns the new vector.
+     *
+     * @param newSize
+     * The desired size of the new vector.
+     *
+     * @return
+     * The vector truncated with the new size.
+     */
+    FORCEINLINE Self
+    truncate(T newSize)
+    {
+      self() = getTruncate(newSize);
+      return self();
+    }
+
+    /**
+     * @brief
+     * The sum of two vectors.
+     *
+     * @description
+     * Returns a vector with the sum of every component of
+     * the original plus their counterpart on the other vector.
+     *
+     * @param other
+     * The other vector for the operation.
+     *
+     * @return
+     * The sum of the two vectors.
+     */
+    FORCEINLINE Self
+    operator+(const Self& other) const
+    {
+      Self r;
+      Kernels::add(this->data(), other.data(), r.data());
+      return r;
+    }
+    /**
+     * @brief
+     * The subtraction of two vectors.
+     *
+     * @description
+     * Returns a vector with the subtraction of every component of
+     * the original minus their counterpart on the other vector.
+     *
+     * @param other
+     * The other vector for the operation.
+     *
+     * @return
+     * The subtraction of the two vectors.
+     */
+    FORCEINLINE Self
+    operator-(const Self& other) const
+    {
+      Self r;
+      Kernels::sub(this->data(), other.data(), r.data());
+      return r;
+    }
+    /**
+     * @brief
+     * The multiplication of two vectors.
+     *
+     * @description
+     * Returns a vector with the multiplication of every component of
+     * the original times their counterpart on the other vector.
+     *
+     * @param other
+     * The other vector for the operation.
+     *
+     * @return
+     * The multiplication of the two vectors.
+     */
+    FORCEINLINE Self
+    operator*(const Self& other) const
+    {
+      Self r;
+      Kernels::mul(this->data(), other.data(), r.data());
+      return r;
+    }
+    /**
+     * @brief
+     * The quotient of two vectors.
+     *
+     * @description
+     * Returns a vector with the quotient of every component of
+     * the original divided by their counterpart on the other vector.
+     *
+     * @param other
+     * The other vector for the operation.
+     *
+     * @return
+     * The quotient of the original vector divided by the other vector.
+     */
+    FORCEINLINE Self
+    operator/(const Self& other) const
+    {
+      Self r;
+      Kernels::div(this->data(), other.data(), r.data());
+      return r;
+    }
+    /**
+     * @brief
+     * The residue of the division of two vectors.
+     *
+     * @description
+     * Returns a vector with the residue of the division of every
+     * component of the original divided by their counterpart on the other vector.
+     *
+     * @param other
+     * The other vector for the operation.
+     *
+     * @return
+     * The residue of the original vector divided by the other vector.
+     */
+    FORCEINLINE Self
+    operator%(const Self& other) const
+    {
+      Self r;
+      Kernels::mod(this->data(), other.data(), r.data());
+      return r;
+    }
+
+    /**
+     * @brief
+     * The sum of the vector plus a number.
+     *
+     * @description
+     * Returns a vector with the sum of every component of
+     * the original plus the given number.
+     *
+     * @param other
+     * The number for the operation.
+     *
+     * @return
+     * The sum of the vector plus the number.
+     */
+    FORCEINLINE Self
+    operator+(T other) const
+    {
+      Self r;
+      Kernels::addScalar(this->data(), other, r.data());
+      return r;
+    }
+    /**
+     * @brief
+     * The subtraction of the vector minus a number.
+     *
+     * @description
+     * Returns a vector with the subtraction of every component of
+     * the original minus the given number.
+     *
+     * @param other
+     * The number for the operation.
+     *
+     * @return
+     * The subtraction of the vector minus the number.
+     */
+    FORCEINLINE Self
+    operator-(T other) const
+    {
+      Self r;
+      Kernels::subScalar(this->data(), other, r.data());
+      return r;
+    }
+    /**
+     * @brief
+     * The multiplication of the vector times a number.
+     *
+     * @description
+     * Returns a vector with the multiplication of every component of
+     * the original times the given number.
+     *
+     * @param other
+     * The number for the operation.
+     *
+     * @return
+     * The multiplication of the vector times the number.
+     */
+    FORCEINLINE Self
+    operator*(T other) const
+    {
+      Self r;
+      Kernels::mulScalar(this->data(), other, r.data());
+      return r;
+    }
+    /**
+     * @brief
+     * The quotient of the vector divided by a number.
+     *
+     * @description
+     * Returns a vector with the quotient of every component of
+     * the original divided by the given number.
+     *
+     * @param other
+     * The number for the operation.
+     *
+     * @return
+     * The quotient of the vector divided by the number.
+     */
+    FORCEINLINE Self
+    operator/(T other) const
+    {
+      Self r;
+      Kernels::divScalar(this->data(), other, r.data());
+      return r;
+    }
+    /**
+     * @brief
+     * The residue of the vector divided by a number.
+     *
+     * @description
+     * Returns a vector with the residue of every component of
+     * the original divided by the given number.
+     *
+     * @param other
+     * The number for the operation.
+     *
+     * @return
+     * The residue of the vector divided by the number.
+     */
+    FORCEINLINE Self
+    operator%(T other) const
+    {
+      Self r;
+      Kernels::modScalar(this->data(), other, r.data());
+      return r;
+    }
+    /**
+     * @brief
+     * The quotient of the vector divided by a precomputed divisor.
+     *
+     * @description
+     * Same result as dividing by the number, but with a multiply and shift
+     * per component instead of a hardware division. For divisors that are
+     * only known at runtime but reused for many vectors.
+     *
+     * @param divisor
+     * The divisor for the operation.
+     *
+     * @return
+     * The quotient of the vector divided by the divisor.
+     */
+    FORCEINLINE Self
+    operator/(const IntDivisor& divisor) const
+    {
+      static_assert(std::is_same<T, int32>::value,
+                    "IntDivisor only divides int32 vectors");
+      Self r;
+      for (uint32 i = 0; i < N; ++i) {
+        r.data()[i] = divisor.divide(this->data()[i]);
+      }
+      return r;
+    }
+    /**
+     * @brief
+     * The quotient of the vector divided by a precomputed divisor.
+     *
+     * @description
+     * Same result as dividing by the number, but with a multiply and shift
+     * per component instead of a hardware division. For divisors that are
+     * only known at runtime but reused for many vectors.
+     *
+     * @param divisor
+     * The divisor for the operation.
+     *
+     * @return
+     * The quotient of the vector divided by the divisor.
+     */
+    FORCEINLINE Self
+    operator/(const UIntDivisor& divisor) const
+    {
+      static_assert(std::is_same<T, uint32>::value,
+                    "UIntDivisor only divides uint32 vectors");
+      Self r;
+      for (uint32 i = 0; i < N; ++i) {
+        r.data()[i] = divisor.divide(this->data()[i]);
+      }
+      return r;
+    }
+    /**
+     * @brief
+     * The cell of a grid where this point falls.
+     *
+     * @description
+     * Divides every component rounding towards negative infinity, so the
+     * cells on the negative side have the same size as the positive ones.
+     *
+     * @param divisor
+     * The size of the cells.
+     *
+     * @return
+     * The coordinates of the cell.
+     */
+    FORCEINLINE Self
+    floorDivide(const IntDivisor& divisor) const
+    {
+      static_assert(std::is_same<T, int32>::value,
+                    "IntDivisor only divides int32 vectors");
+      Self r;
+      for (uint32 i = 0; i < N; ++i) {
+        r.data()[i] = divisor.floorDivide(this->data()[i]);
+      }
+      return r;
+    }
+    /**
+     * @brief
+     * The position of this point inside its cell of a grid.
+     *
+     * @description
+     * The residue of floorDivide, always between 0 and the size of the cell
+     * for positive sizes.
+     *
+     * @param divisor
+     * The size of the cells.
+     *
+     * @return
+     * The local coordinates inside the cell.
+     */
+    FORCEINLINE Self
+    floorModulo(const IntDivisor& divisor) const
+    {
+      static_assert(std::is_same<T, int32>::value,
+                    "IntDivisor only divides int32 vectors");
+      Self r;
+      for (uint32 i = 0; i < N; ++i) {
+        r.data()[i] = divisor.floorModulo(this->data()[i]);
+      }
+      return r;
+    }
+
+    /**
+     * @brief
+     * The sum of a number plus the vector.
+     *
+     * @description
+     * Returns a vector with the sum of the given number plus every component
+     * of the vector.
+     *
+     * @param other
+     * The number for the operation.
+     * @param otherV
+     * The vector for the operation.
+     *
+     * @return
+     * The sum of the number plus the vector.
+     */
+    friend FORCEINLINE Self
+    operator+(T other, const Self& otherV)
+    {
+      return otherV + other;
+    }
+    /**
+     * @brief
+     * The subtraction of a number minus the vector.
+     *
+     * @description
+     * Returns a vector with the subtraction of the given number minus every
+     * component of the vector.
+     *
+     * @param other
+     * The number for the operation.
+     * @param otherV
+     * The vector for the operation.
+     *
+     * @return
+     * The subtraction of the number minus the vector.
+     */
+    friend FORCEINLINE Self
+    operator-(T other, const Self& otherV)
+    {
+      Self r;
+      Kernels::scalarSub(other, otherV.data(), r.data());
+      return r;
+    }
+    /**
+     * @brief
+     * The multiplication of a number times the vector.
+     *
+     * @description
+     * Returns a vector with the multiplication of the given number times
+     * every component of the vector.
+     *
+     * @param other
+     * The number for the operation.
+     * @param otherV
+     * The vector for the operation.
+     *
+     * @return
+     * The multiplication of the number times the vector.
+     */
+    friend FORCEINLINE Self
+    operator*(T other, const Self& otherV)
+    {
+      return otherV * other;
+    }
+    /**
+     * @brief
+     * The quotient of a number divided by the vector.
+     *
+     * @description
+     * Returns a vector with the quotient of the given number divided by every
+     * component of the vector.
+     *
+     * @param other
+     * The number for the operation.
+     * @param otherV
+     * The vector for the operation.
+     *
+     * @return
+     * The quotient of the number divided by the vector.
+     */
+    friend FORCEINLINE Self
+    operator/(T other, const Self& otherV)
+    {
+      Self r;
+      Kernels::scalarDiv(other, otherV.data(), r.data());
+      return r;
+    }
+    /**
+     * @brief
+     * The residue of a number divided by the vector.
+     *
+     * @description
+     * Returns a vector with the residue of the given number divided by every
+     * component of the vector.
+     *
+     * @param other
+     * The number for the operation.
+     * @param otherV
+     * The vector for the operation.
+     *
+     * @return
+     * The residue of the number divided by the vector.
+     */
+    friend FORCEINLINE Self
+    operator%(T other, const Self& otherV)
+    {
+      Self r;
+      Kernels::scalarMod(other, otherV.data(), r.data());
+      return r;
+    }
+
+    /**
+     * @brief
+     * The minus operator.
+     *
+     * @description
+     * Returns a vector in the opposite direction of the original.
+     *
+     * @return
+     * A vector in the opposite direction of the original.
+     */
+    FORCEINLINE Self
+    operator-() const
+    {
+      static_assert(!std::is_unsigned<T>::value,
+                    "Unsigned vectors can't be negated");
+      Self r;
+      Kernels::negate(this->data(), r.data());
+      return r;
+    }
+
+    /**
+     * @brief
+     * Makes the original vector equal to the itself plus the other.
+     *
+     * @description
+     * Makes every component of the original vector equal to the components
+     * of it self plus their counterparts of the other vector.
+     *
+     * @param other
+     * The other vector to whom is gonna be sum.
+     *
+     * @return
+     * The original vector after the operation.
+     */
+    FORCEINLINE Self&
+    operator+=(const Self& other)
+    {
+      Kernels::add(this->data(), other.data(), this->data());
+      return self();
+    }
+    /**
+     * @brief
+     * Makes the original vector equal to the itself minus the other.
+     *
+     * @description
+     * Makes every component of the original vector equal to the components
+     * of it self minus their counterparts of the other vector.
+     *
+     * @param other
+     * The other vector to whom is gonna be subtracted.
+     *
+     * @return
+     * The original vector after the operation.
+     */
+    FORCEINLINE Self&
+    operator-=(const Self& other)
+    {
+      Kernels::sub(this->data(), other.data(), this->data());
+      return self();
+    }
+    /**
+     * @brief
+     * Makes the original vector equal to the itself times the other.
+     *
+     * @description
+     * Makes every component of the original vector equal to the components
+     * of it self times their counterparts of the other vector.
+     *
+     * @param other
+     * The other vector to whom is gonna be multiplied.
+     *
+     * @return
+     * The original vector after the operation.
+     */
+    FORCEINLINE Self&
+    operator*=(const Self& other)
+    {
+      Kernels::mul(this->data(), other.data(), this->data());
+      return self();
+    }
+    /**
+     * @brief
+     * Makes the original vector equal to the itself divided by the other.
+     *
+     * @description
+     * Makes every component of the original vector equal to the components
+     * of it self divided by their counterparts of the other vector.
+     *
+     * @param other
+     * The other vector to whom is gonna be divided by.
+     *
+     * @return
+     * The original vector after the operation.
+     */
+    FORCEINLINE Self&
+    operator/=(const Self& other)
+    {
+      Kernels::div(this->data(), other.data(), this->data());
+      return self();
+    }
+    /**
+     * @brief
+     * Makes the original vector equal to the itself module by the other.
+     *
+     * @description
+     * Makes every component of the original vector equal to the components
+     * of it self module by their counterparts of the other vector.
+     *
+     * @param other
+     * The other vector to whom is gonna be module by.
+     *
+     * @return
+     * The original vector after the operation.
+     */
+    FORCEINLINE Self&
+    operator%=(const Self& other)
+    {
+      Kernels::mod(this->data(), other.data(), this->data());
+      return self();
+    }
+
+    /**
+     * @brief
+     * Makes the original vector equal to the itself plus a number.
+     *
+     * @description
+     * Makes every component of the original vector equal to the components
+     * of it self plus the number.
+     *
+     * @param other
+     * The number to whom is gonna be sum.
+     *
+     * @return
+     * The original vector after the operation.
+     */
+    FORCEINLINE Self&
+    operator+=(T other)
+    {
+      Kernels::addScalar(this->data(), other, this->data());
+      return self();
+    }
+    /**
+     * @brief
+     * Makes the original vector equal to the itself minus a number.
+     *
+     * @description
+     * Makes every component of the original vector equal to the components
+     * of it self minus the number.
+     *
+     * @param other
+     * The number to whom is gonna be subtracted.
+     *
+     * @return
+     * The original vector after the operation.
+     */
+    FORCEINLINE Self&
+    operator-=(T other)
+    {
+      Kernels::subScalar(this->data(), other, this->data());
+      return self();
+    }
+    /**
+     * @brief
+     * Makes the original vector equal to the itself times a number.
+     *
+     * @description
+     * Makes every component of the original vector equal to the components
+     * of it self times the number.
+     *
+     * @param other
+     * The number to whom is gonna be multiplied.
+     *
+     * @return
+     * The original vector after the operation.
+     */
+    FORCEINLINE Self&
+    operator*=(T other)
+    {
+      Kernels::mulScalar(this->data(), other, this->data());
+      return self();
+    }
+    /**
+     * @brief
+     * Makes the original vector equal to the itself divided by a number.
+     *
+     * @description
+     * Makes every component of the original vector equal to the components
+     * of it self divided by the number.
+     *
+     * @param other
+     * The number to whom is gonna be divided by.
+     *
+     * @return
+     * The original vector after the operation.
+     */
+    FORCEINLINE Self&
+    operator/=(T other)
+    {
+      Kernels::divScalar(this->data(), other, this->data());
+      return self();
+    }
+    /**
+     * @brief
+     * Makes the original vector equal to the itself module by a number.
+     *
+     * @description
+     * Makes every component of the original vector equal to the components
+     * of it self module by the number.
+     *
+     * @param other
+     * The number to whom is gonna be module by.
+     *
+     * @return
+     * The original vector after the operation.
+     */
+    FORCEINLINE Self&
+    operator%=(T other)
+    {
+      Kernels::modScalar(this->data(), other, this->data());
+      return self();
+    }
+
+    /**
+     * @brief
+     * Compares the two vectors to see if they are equal.
+     *
+     * @description
+     * Check if every component of the vector are equal to their counterpart
+     * of the other vector. Floating point components are compared with
+     * PlatformMath::checkEqual.
+     *
+     * @param other
+     * The other vector to check.
+     *
+     * @return
+     * True if they are equal.
+     */
+    FORCEINLINE bool
+    operator==(const Self& other) const
+    {
+      return Kernels::equal(this->data(), other.data());
+    }
+    /**
+     * @brief
+     * Compares the two vectors to see if they are not equal.
+     *
+     * @description
+     * Check if every component of the vector are not equal to their counterpart
+     * of the other vector.
+     *
+     * @param other
+     * The other vector to check.
+     *
+     * @return
+     * True if they are not equal.
+     */
+    FORCEINLINE bool
+    operator!=(const Self& other) const
+    {
+      return !(*this == other);
+    }
+
+    /**
+     * @brief
+     * Converts the components to another vector of the same size.
+     *
+     * @description
+     * Returns a vector of the type given with every component casted.
+     *
+     * @return
+     * The vector converted.
+     */
+    template<class V>
+    FORCEINLINE V
+    convertTo() const
+    {
+      static_assert(V::kSIZE == N, "Vectors must have the same size");
+      V r;
+      for (uint32 i = 0; i < N; ++i) {
+        r.data()[i] = static_cast<typename V::ValueType>(this->data()[i]);
+      }
+      return r;
+    }
+
+   protected:
+    /**
+     * @brief
+     * This vector as the type returned by the operations.
+     */
+    FORCEINLINE Self&
+    self() { return static_cast<Self&>(*this); }
+    /**
+     * @brief
+     * This vector as the type returned by the operations.
+     */
+    FORCEINLINE const Self&
+    self() const { return static_cast<const Self&>(*this); }
+  };
+}
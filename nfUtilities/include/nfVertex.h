@@ -0,0 +1,862 @@
+/************************************************************************/
+/**
+ * @file nfVertex.h
+ * @author Mara Castellanos
+ * @date 18/10/26
+ * @brief The vertex formats of the meshes, in full floats and quantized, and
+ *        the functions to convert between them.
+ *
+ * @bug Not bug Known.
+ */
+/************************************************************************/
+
+#pragma once
+
+#include <cstring>
+
+#include "nfPrerequisitesUtilities.h"
+#include "nfPlatformMath.h"
+#include "nfVector2.h"
+#include "nfVector3.h"
+#include "nfVector4.h"
+
+#if NF_SIMD_F16C
+# include <immintrin.h>
+#endif
+
+namespace nfEngineSDK {
+  /**
+   * @brief
+   * The simplest vertex: position, texture coordinates and normal.
+   */
+  struct SimplexVertex
+  {
+    /*
+     * The position of the vertex.
+     */
+    Vector3f position;
+    /*
+     * The texture coordinates.
+     */
+    Vector2f texCoords;
+    /*
+     * The normal of the surface, normalized.
+     */
+    Vector3f normal;
+  };
+
+  /**
+   * @brief
+   * A vertex with the tangent space, for normal mapping.
+   */
+  struct ComplexVertex
+  {
+    /*
+     * The position of the vertex.
+     */
+    Vector3f position;
+    /*
+     * The texture coordinates.
+     */
+    Vector2f texCoords;
+    /*
+     * The normal of the surface, normalized.
+     */
+    Vector3f normal;
+    /*
+     * The tangent of the surface, normalized.
+     */
+    Vector3f tangent;
+    /*
+     * The binormal of the surface, normalized.
+     */
+    Vector3f binormal;
+  };
+
+  /**
+   * @brief
+   * A SimplexVertex moved by up to 4 bones.
+   */
+  struct SimpleAnimVertex
+  {
+    /*
+     * The position of the vertex.
+     */
+    Vector3f position;
+    /*
+     * The texture coordinates.
+     */
+    Vector2f texCoords;
+    /*
+     * The normal of the surface, normalized.
+     */
+    Vector3f normal;
+    /*
+     * The indices of the bones that move the vertex.
+     */
+    Vector4i boneIndices;
+    /*
+     * How much every bone moves the vertex, they add up to 1.
+     */
+    Vector4f boneWeights;
+  };
+
+  /**
+   * @brief
+   * A ComplexVertex moved by up to 4 bones.
+   */
+  struct ComplexAnimVertex
+  {
+    /*
+     * The position of the vertex.
+     */
+    Vector3f position;
+    /*
+     * The texture coordinates.
+     */
+    Vector2f texCoords;
+    /*
+     * The normal of the surface, normalized.
+     */
+    Vector3f normal;
+    /*
+     * The tangent of the surface, normalized.
+     */
+    Vector3f tangent;
+    /*
+     * The binormal of the surface, normalized.
+     */
+    Vector3f binormal;
+    /*
+     * The indices of the bones that move the vertex.
+     */
+    Vector4i boneIndices;
+    /*
+     * How much every bone moves the vertex, they add up to 1.
+     */
+    Vector4f boneWeights;
+  };
+
+  /**
+   * @brief
+   * A SimplexVertex moved by up to 'size' bones.
+   */
+  template<uint32 size>
+  struct SimpleBigAnimVertex
+  {
+    /*
+     * The number of bones that can move the vertex.
+     */
+    static constexpr uint32 kINFLUENCES = size;
+
+    /*
+     * The position of the vertex.
+     */
+    Vector3f position;
+    /*
+     * The texture coordinates.
+     */
+    Vector2f texCoords;
+    /*
+     * The normal of the surface, normalized.
+     */
+    Vector3f normal;
+    /*
+     * The indices of the bones that move the vertex.
+     */
+    int32 boneIndices[size];
+    /*
+     * How much every bone moves the vertex, they add up to 1.
+     */
+    float boneWeights[size];
+  };
+
+  /**
+   * @brief
+   * A ComplexVertex moved by up to 'size' bones.
+   */
+  template<uint32 size>
+  struct ComplexBigAnimVertex
+  {
+    /*
+     * The number of bones that can move the vertex.
+     */
+    static constexpr uint32 kINFLUENCES = size;
+
+    /*
+     * The position of the vertex.
+     */
+    Vector3f position;
+    /*
+     * The texture coordinates.
+     */
+    Vector2f texCoords;
+    /*
+     * The normal of the surface, normalized.
+     */
+    Vector3f normal;
+    /*
+     * The tangent of the surface, normalized.
+     */
+    Vector3f tangent;
+    /*
+     * The binormal of the surface, normalized.
+     */
+    Vector3f binormal;
+    /*
+     * The indices of the bones that move the vertex.
+     */
+    int32 boneIndices[size];
+    /*
+     * How much every bone moves the vertex, they add up to 1.
+     */
+    float boneWeights[size];
+  };
+
+  /***************************************************************************/
+  /*                                                                         */
+  /*                            Quantized vertices                           */
+  /*                                                                         */
+  /***************************************************************************/
+
+  /**
+   * @brief
+   * SimplexVertex in 20 bytes instead of 32: half float texture coordinates
+   * and the normal octahedral encoded in 32 bits. The position stays in full
+   * floats.
+   */
+  struct QuantizedSimplexVertex
+  {
+    /*
+     * The position of the vertex.
+     */
+    Vector3f position;
+    /*
+     * The texture coordinates, as half floats.
+     */
+    uint16 texCoords[2];
+    /*
+     * The normal, octahedral encoded.
+     */
+    uint32 normal;
+  };
+
+  /**
+   * @brief
+   * ComplexVertex in 28 bytes instead of 56.
+   */
+  struct QuantizedComplexVertex
+  {
+    /*
+     * The position of the vertex.
+     */
+    Vector3f position;
+    /*
+     * The texture coordinates, as half floats.
+     */
+    uint16 texCoords[2];
+    /*
+     * The normal, octahedral encoded.
+     */
+    uint32 normal;
+    /*
+     * The tangent, octahedral encoded.
+     */
+    uint32 tangent;
+    /*
+     * The binormal, octahedral encoded.
+     */
+    uint32 binormal;
+  };
+
+  /**
+   * @brief
+   * SimpleAnimVertex in 32 bytes instead of 64: 8 bits bone indices and
+   * unorm16 weights on top of the QuantizedSimplexVertex.
+   */
+  struct QuantizedSimpleAnimVertex
+  {
+    /*
+     * The position of the vertex.
+     */
+    Vector3f position;
+    /*
+     * The texture coordinates, as half floats.
+     */
+    uint16 texCoords[2];
+    /*
+     * The normal, octahedral encoded.
+     */
+    uint32 normal;
+    /*
+     * How much every bone moves the vertex, they add up to 65535.
+     */
+    uint16 boneWeights[4];
+    /*
+     * The indices of the bones that move the vertex.
+     */
+    uint8 boneIndices[4];
+  };
+
+  /**
+   * @brief
+   * ComplexAnimVertex in 40 bytes instead of 88.
+   */
+  struct QuantizedComplexAnimVertex
+  {
+    /*
+     * The position of the vertex.
+     */
+    Vector3f position;
+    /*
+     * The texture coordinates, as half floats.
+     */
+    uint16 texCoords[2];
+    /*
+     * The normal, octahedral encoded.
+     */
+    uint32 normal;
+    /*
+     * The tangent, octahedral encoded.
+     */
+    uint32 tangent;
+    /*
+     * The binormal, octahedral encoded.
+     */
+    uint32 binormal;
+    /*
+     * How much every bone moves the vertex, they add up to 65535.
+     */
+    uint16 boneWeights[4];
+    /*
+     * The indices of the bones that move the vertex.
+     */
+    uint8 boneIndices[4];
+  };
+
+  /**
+   * @brief
+   * SimpleBigAnimVertex with 8 bits bone indices and unorm16 weights.
+   */
+  template<uint32 size = 4>
+  struct QuantizedSimpleBigAnimVertex
+  {
+    /*
+     * The number of bones that can move the vertex.
+     */
+    static constexpr uint32 kINFLUENCES = size;
+
+    /*
+     * The position of the vertex.
+     */
+    Vector3f position;
+    /*
+     * The texture coordinates, as half floats.
+     */
+    uint16 texCoords[2];
+    /*
+     * The normal, octahedral encoded.
+     */
+    uint32 normal;
+    /*
+     * How much every bone moves the vertex, they add up to 65535.
+     */
+    uint16 boneWeights[size];
+    /*
+     * The indices of the bones that move the vertex.
+     */
+    uint8 boneIndices[size];
+  };
+
+  /**
+   * @brief
+   * ComplexBigAnimVertex with 8 bits bone indices and unorm16 weights.
+   */
+  template<uint32 size = 4>
+  struct QuantizedComplexBigAnimVertex
+  {
+    /*
+     * The number of bones that can move the vertex.
+     */
+    static constexpr uint32 kINFLUENCES = size;
+
+    /*
+     * The position of the vertex.
+     */
+    Vector3f position;
+    /*
+     * The texture coordinates, as half floats.
+     */
+    uint16 texCoords[2];
+    /*
+     * The normal, octahedral encoded.
+     */
+    uint32 normal;
+    /*
+     * The tangent, octahedral encoded.
+     */
+    uint32 tangent;
+    /*
+     * The binormal, octahedral encoded.
+     */
+    uint32 binormal;
+    /*
+     * How much every bone moves the vertex, they add up to 65535.
+     */
+    uint16 boneWeights[size];
+    /*
+     * The indices of the bones that move the vertex.
+     */
+    uint8 boneIndices[size];
+  };
+
+  /**
+   * @brief
+   * Encoding and decoding of the quantized vertex formats.
+   *
+   * @description
+   * Every conversion is branch free per vertex so the batch loops can run
+   * without stalls. Half floats use F16C when the build enables it.
+   */
+  class NF_UTILITIES_EXPORT VertexQuantization
+  {
+   public:
+    /**
+     * @brief
+     * Converts a float to a half float, rounding to nearest even.
+     *
+     * @param _value
+     * The float to convert.
+     *
+     * @return
+     * The bits of the half float.
+     */
+    static FORCEINLINE uint16
+    encodeHalf(float _value)
+    {
+#if NF_SIMD_F16C
+      return static_cast<uint16>(_cvtss_sh(_value, 0));
+#else
+      uint32 u = toBits(_value);
+      uint32 sign = u & 0x80000000u;
+      u ^= sign;
+      uint32 o;
+      if (u >= (143u << 23)) {
+        /* Too big for a half, infinity or NaN. */
+        o = u > (255u << 23) ? 0x7E00u : 0x7C00u;
+      }
+      else if (u < (113u << 23)) {
+        /* Denormal half, let the float addition do the rounding. */
+        const uint32 denormMagic = 126u << 23;
+        o = toBits(fromBits(u) + fromBits(denormMagic)) - denormMagic;
+      }
+      else {
+        uint32 mantOdd = (u >> 13) & 1u;
+        u += (static_cast<uint32>(15 - 127) << 23) + 0xFFFu;
+        u += mantOdd;
+        o = u >> 13;
+      }
+      return static_cast<uint16>(o | (sign >> 16));
+#endif
+    }
+    /**
+     * @brief
+     * Converts a half float to a float.
+     *
+     * @param _half
+     * The bits of the half float.
+     *
+     * @return
+     * The float, exact.
+     */
+    static FORCEINLINE float
+    decodeHalf(uint16 _half)
+    {
+#if NF_SIMD_F16C
+      return _cvtsh_ss(_half);
+#else
+      const uint32 shiftedExp = 0x7C00u << 13;
+      uint32 o = (_half & 0x7FFFu) << 13;
+      uint32 exp = shiftedExp & o;
+      o += static_cast<uint32>(127 - 15) << 23;
+      if (exp == shiftedExp) {
+        o += static_cast<uint32>(128 - 16) << 23;
+      }
+      else if (exp == 0) {
+        o += 1u << 23;
+        o = toBits(fromBits(o) - fromBits(113u << 23));
+      }
+      return fromBits(o | (static_cast<uint32>(_half & 0x8000u) << 16));
+#endif
+    }
+
+    /**
+     * @brief
+     * Encodes a unit vector in 32 bits, with the octahedral mapping.
+     *
+     * @description
+     * The sphere is projected to an octahedron and unfolded into a square,
+     * every coordinate is stored in 16 bits signed normalized. The error is
+     * below 0.05 degrees.
+     *
+     * @param _normal
+     * The unit vector. A zero, infinite or NaN vector, from a degenerate
+     * triangle of an imported mesh, is encoded as +Z.
+     *
+     * @return
+     * The encoded vector.
+     */
+    static FORCEINLINE uint32
+    encodeOctahedral(const Vector3f& _normal)
+    {
+      float l1 = absf(_normal.x) + absf(_normal.y) + absf(_normal.z);
+      if (!(l1 > 0.0f && l1 <= PlatformMath::kMAX_FLOAT)) {
+        return 0;
+      }
+      float invL1 = 1.0f / l1;
+      float px = _normal.x * invL1;
+      float py = _normal.y * invL1;
+      if (_normal.z < 0.0f) {
+        float ox = (1.0f - absf(py)) * signNotZero(px);
+        float oy = (1.0f - absf(px)) * signNotZero(py);
+        px = ox;
+        py = oy;
+      }
+      uint32 ex = static_cast<uint16>(encodeSnorm16(px));
+      uint32 ey = static_cast<uint16>(encodeSnorm16(py));
+      return ex | (ey << 16);
+    }
+    /**
+     * @brief
+     * Decodes a unit vector encoded with encodeOctahedral.
+     *
+     * @param _encoded
+     * The encoded vector.
+     *
+     * @return
+     * The unit vector.
+     */
+    static FORCEINLINE Vector3f
+    decodeOctahedral(uint32 _encoded)
+    {
+      float px = decodeSnorm16(static_cast<int16>(_encoded & 0xFFFFu));
+      float py = decodeSnorm16(static_cast<int16>(_encoded >> 16));
+      float pz = 1.0f - absf(px) - absf(py);
+      float t = pz < 0.0f ? -pz : 0.0f;
+      px += px >= 0.0f ? -t : t;
+      py += py >= 0.0f ? -t : t;
+      float invLength = 1.0f / PlatformMath::sqrt(px * px + py * py + pz * pz);
+      return Vector3f(px * invLength, py * invLength, pz * invLength);
+    }
+
+    /**
+     * @brief
+     * Encodes a value between 0 and 1 in 16 bits.
+     */
+    static FORCEINLINE uint16
+    encodeUnorm16(float _value)
+    {
+      /* Written so a NaN gives 0 and never reaches the cast. */
+      float v = _value > 0.0f ? (_value < 1.0f ? _value : 1.0f) : 0.0f;
+      return static_cast<uint16>(v * 65535.0f + 0.5f);
+    }
+    /**
+     * @brief
+     * Decodes a value encoded with encodeUnorm16.
+     */
+    static FORCEINLINE float
+    decodeUnorm16(uint16 _value)
+    {
+      return static_cast<float>(_value) * (1.0f / 65535.0f);
+    }
+    /**
+     * @brief
+     * Encodes a value between -1 and 1 in 16 bits.
+     */
+    static FORCEINLINE int16
+    encodeSnorm16(float _value)
+    {
+      /* Written so a NaN gives -1 and never reaches the cast. */
+      float v = _value > -1.0f ? (_value < 1.0f ? _value : 1.0f) : -1.0f;
+      v *= 32767.0f;
+      return static_cast<int16>(v < 0.0f ? v - 0.5f : v + 0.5f);
+    }
+    /**
+     * @brief
+     * Decodes a value encoded with encodeSnorm16.
+     */
+    static FORCEINLINE float
+    decodeSnorm16(int16 _value)
+    {
+      float v = static_cast<float>(_value) * (1.0f / 32767.0f);
+      return v < -1.0f ? -1.0f : v;
+    }
+
+    /**
+     * @brief
+     * Encodes the bone weights of a vertex in unorm16.
+     *
+     * @description
+     * The weights are normalized first, and the rounding error is given to
+     * the biggest weight, so the encoded weights always add up to exactly
+     * 65535. Negative weights count as 0, and if all are 0 the first bone
+     * takes all the weight.
+     *
+     * @param _weights
+     * The weights, that should add up to 1.
+     * @param _out
+     * Where the encoded weights are written.
+     */
+    template<uint32 N>
+    static FORCEINLINE void
+    encodeWeights(const float* _weights, uint16* _out)
+    {
+      float sum = 0.0f;
+      for (uint32 i = 0; i < N; ++i) {
+        sum += _weights[i] > 0.0f ? _weights[i] : 0.0f;
+      }
+      float scale = sum > 0.0f ? 1.0f / sum : 0.0f;
+
+      int32 total = 0;
+      uint32 biggest = 0;
+      for (uint32 i = 0; i < N; ++i) {
+        _out[i] = encodeUnorm16(_weights[i] * scale);
+        total += _out[i];
+        biggest = _out[i] > _out[biggest] ? i : biggest;
+      }
+      /*
+       * After the normalization the error is at most N / 2 steps, always
+       * smaller than the biggest weight.
+       */
+      _out[biggest] = static_cast<uint16>(_out[biggest] + (65535 - total));
+    }
+    /**
+     * @brief
+     * Encodes the bone indices of a vertex in 8 bits.
+     *
+     * @param _indices
+     * The indices, below 256.
+     * @param _out
+     * Where the encoded indices are written.
+     */
+    template<uint32 N>
+    static FORCEINLINE void
+    encodeIndices(const int32* _indices, uint8* _out)
+    {
+      for (uint32 i = 0; i < N; ++i) {
+        assertm(_indices[i] >= 0 && _indices[i] < 256,
+                "Bone index doesn't fit in 8 bits");
+        _out[i] = static_cast<uint8>(_indices[i]);
+      }
+    }
+
+    /**
+     * @brief
+     * Encodes an array of vertices.
+     *
+     * @param _in
+     * The vertices to encode.
+     * @param _out
+     * Where the encoded vertices are written.
+     * @param _count
+     * The number of vertices.
+     */
+    static void
+    encode(const SimplexVertex* _in, QuantizedSimplexVertex* _out, SIZE_T _count);
+    /**
+     * @brief
+     * Decodes an array of vertices.
+     *
+     * @param _in
+     * The vertices to decode.
+     * @param _out
+     * Where the decoded vertices are written.
+     * @param _count
+     * The number of vertices.
+     */
+    static void
+    decode(const QuantizedSimplexVertex* _in, SimplexVertex* _out, SIZE_T _count);
+    /**
+     * @brief
+     * Encodes an array of vertices.
+     */
+    static void
+    encode(const ComplexVertex* _in, QuantizedComplexVertex* _out, SIZE_T _count);
+    /**
+     * @brief
+     * Decodes an array of vertices.
+     */
+    static void
+    decode(const QuantizedComplexVertex* _in, ComplexVertex* _out, SIZE_T _count);
+    /**
+     * @brief
+     * Encodes an array of vertices.
+     */
+    static void
+    encode(const SimpleAnimVertex* _in,
+           QuantizedSimpleAnimVertex* _out,
+           SIZE_T _count);
+    /**
+     * @brief
+     * Decodes an array of vertices.
+     */
+    static void
+    decode(const QuantizedSimpleAnimVertex* _in,
+           SimpleAnimVertex* _out,
+           SIZE_T _count);
+    /**
+     * @brief
+     * Encodes an array of vertices.
+     */
+    static void
+    encode(const ComplexAnimVertex* _in,
+           QuantizedComplexAnimVertex* _out,
+           SIZE_T _count);
+    /**
+     * @brief
+     * Decodes an array of vertices.
+     */
+    static void
+    decode(const QuantizedComplexAnimVertex* _in,
+           ComplexAnimVertex* _out,
+           SIZE_T _count);
+
+    /**
+     * @brief
+     * Encodes an array of vertices.
+     */
+    template<uint32 size>
+    static void
+    encode(const SimpleBigAnimVertex<size>* _in,
+           QuantizedSimpleBigAnimVertex<size>* _out,
+           SIZE_T _count);
+    /**
+     * @brief
+     * Decodes an array of vertices.
+     */
+    template<uint32 size>
+    static void
+    decode(const QuantizedSimpleBigAnimVertex<size>* _in,
+           SimpleBigAnimVertex<size>* _out,
+           SIZE_T _count);
+    /**
+     * @brief
+     * Encodes an array of vertices.
+     */
+    template<uint32 size>
+    static void
+    encode(const ComplexBigAnimVertex<size>* _in,
+           QuantizedComplexBigAnimVertex<size>* _out,
+           SIZE_T _count);
+    /**
+     * @brief
+     * Decodes an array of vertices.
+     */
+    template<uint32 size>
+    static void
+    decode(const QuantizedComplexBigAnimVertex<size>* _in,
+           ComplexBigAnimVertex<size>* _out,
+           SIZE_T _count);
+
+   private:
+    static FORCEINLINE float
+    absf(float _value)
+    {
+      return _value < 0.0f ? -_value : _value;
+    }
+    static FORCEINLINE float
+    signNotZero(float _value)
+    {
+      return _value >= 0.0f ? 1.0f : -1.0f;
+    }
+    static FORCEINLINE uint32
+    toBits(float _value)
+    {
+      uint32 bits;
+      std::memcpy(&bits, &_value, sizeof(bits));
+      return bits;
+    }
+    static FORCEINLINE float
+    fromBits(uint32 _bits)
+    {
+      float value;
+      std::memcpy(&value, &_bits, sizeof(value));
+      return value;
+    }
+  };
+
+  template<uint32 size>
+  void
+  VertexQuantization::encode(const SimpleBigAnimVertex<size>* _in,
+                             QuantizedSimpleBigAnimVertex<size>* _out,
+                             SIZE_T _count)
+  {
+    for (SIZE_T i = 0; i < _count; ++i) {
+      const SimpleBigAnimVertex<size>& v = _in[i];
+      QuantizedSimpleBigAnimVertex<size>& q = _out[i];
+      q.position = v.position;
+      q.texCoords[0] = encodeHalf(v.texCoords.x);
+      q.texCoords[1] = encodeHalf(v.texCoords.y);
+      q.normal = encodeOctahedral(v.normal);
+      encodeWeights<size>(v.boneWeights, q.boneWeights);
+      encodeIndices<size>(v.boneIndices, q.boneIndices);
+    }
+  }
+  template<uint32 size>
+  void
+  VertexQuantization::decode(const QuantizedSimpleBigAnimVertex<size>* _in,
+                             SimpleBigAnimVertex<size>* _out,
+                             SIZE_T _count)
+  {
+    for (SIZE_T i = 0; i < _count; ++i) {
+      const QuantizedSimpleBigAnimVertex<size>& q = _in[i];
+      SimpleBigAnimVertex<size>& v = _out[i];
+      v.position = q.position;
+      v.texCoords = Vector2f(decodeHalf(q.texCoords[0]), decodeHalf(q.texCoords[1]));
+      v.normal = decodeOctahedral(q.normal);
+      for (uint32 j = 0; j < size; ++j) {
+        v.boneIndices[j] = q.boneIndices[j];
+        v.boneWeights[j] = decodeUnorm16(q.boneWeights[j]);
+      }
+    }
+  }
+  template<uint32 size>
+  void
+  VertexQuantization::encode(const ComplexBigAnimVertex<size>* _in,
+                             QuantizedComplexBigAnimVertex<size>* _out,
+                             SIZE_T _count)
+  {
+    for (SIZE_T i = 0; i < _count; ++i) {
+      const ComplexBigAnimVertex<size>& v = _in[i];
+      QuantizedComplexBigAnimVertex<size>& q = _out[i];
+      q.position = v.position;
+      q.texCoords[0] = encodeHalf(v.texCoords.x);
+      q.texCoords[1] = encodeHalf(v.texCoords.y);
+      q.normal = encodeOctahedral(v.normal);
+      q.tangent = encodeOctahedral(v.tangent);
+      q.binormal = encodeOctahedral(v.binormal);
+      encodeWeights<size>(v.boneWeights, q.boneWeights);
+      encodeIndices<size>(v.boneIndices, q.boneIndices);
+    }
+  }
+  template<uint32 size>
+  void
+  VertexQuantization::decode(const QuantizedComplexBigAnimVertex<size>* _in,
+                             ComplexBigAnimVertex<size>* _out,
+                             SIZE_T _count)
+  {
+    for (SIZE_T i = 0; i < _count; ++i) {
+      const QuantizedComplexBigAnimVertex<size>& q = _in[i];
+      ComplexBigAnimVertex<size>& v = _out[i];
+      v.position = q.position;
+      v.texCoords = Vector2f(decodeHalf(q.texCoords[0]), decodeHalf(q.texCoords[1]));
+      v.normal = decodeOctahedral(q.normal);
+      v.tangent = decodeOctahedral(q.tangent);
+      v.binormal = decodeOctahedral(q.binormal);
+      for (uint32 j = 0; j < size; ++j) {
+        v.boneIndices[j] = q.boneIndices[j];
+        v.boneWeights[j] = decodeUnorm16(q.boneWeights[j]);
+      }
+    }
+  }
+}
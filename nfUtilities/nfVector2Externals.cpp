@@ -1,26 +1,29 @@
 #include "nfVector2.h"
-#include "nfMath.h"
+#include "nfStringConversion.h"
 
 namespace nfEngineSDK
 {
   String
   Vector2f::toString() const
   {
-    return "{ " + nfToString(x) + ", "
-                + nfToString(y) + " }";
+    char buffer[StringConversion::maxChars<Vector2f>()];
+    char* end = StringConversion::toChars(buffer, buffer + sizeof(buffer), *this);
+    return String(buffer, end);
   }
 
   String
   Vector2i::toString() const
   {
-    return "{ " + nfToString(x) + ", "
-                + nfToString(y) + " }";
+    char buffer[StringConversion::maxChars<Vector2i>()];
+    char* end = StringConversion::toChars(buffer, buffer + sizeof(buffer), *this);
+    return String(buffer, end);
   }
 
   String
   Vector2u::toString() const
   {
-    return "{ " + nfToString(x) + ", "
-                + nfToString(y) + " }";
+    char buffer[StringConversion::maxChars<Vector2u>()];
+    char* end = StringConversion::toChars(buffer, buffer + sizeof(buffer), *this);
+    return String(buffer, end);
   }
 }
\ No newline at end of file
@@ -0,0 +1,681 @@
+#include "nfArchive.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace nfEngineSDK
+{
+  namespace {
+    const uint8 kMAGIC[4] = { 'N', 'F', 'P', 'K' };
+
+    /*
+     * The LZ4 block format: the shortest match, the literals that must end
+     * a block and how far from the end the last match can start.
+     */
+    const SIZE_T kMIN_MATCH = 4;
+    const SIZE_T kLAST_LITERALS = 5;
+    const SIZE_T kMATCH_FIND_LIMIT = 12;
+    const SIZE_T kMAX_OFFSET = 65535;
+    const uint32 kHASH_BITS = 16;
+
+    const uint64 kPRIME64_1 = 11400714785074694791ull;
+    const uint64 kPRIME64_2 = 14029467366897019727ull;
+    const uint64 kPRIME64_3 = 1609587929392839161ull;
+    const uint64 kPRIME64_4 = 9650029242287828579ull;
+    const uint64 kPRIME64_5 = 2870177450012600261ull;
+
+    FORCEINLINE uint32
+    read32(const uint8* _data)
+    {
+      uint32 value;
+      std::memcpy(&value, _data, sizeof(value));
+#if NF_ENDIAN != NF_ENDIAN_LITTLE
+      ByteSwap::swap32(&value, 1);
+#endif
+      return value;
+    }
+
+    FORCEINLINE uint64
+    read64(const uint8* _data)
+    {
+      uint64 value;
+      std::memcpy(&value, _data, sizeof(value));
+#if NF_ENDIAN != NF_ENDIAN_LITTLE
+      ByteSwap::swap64(&value, 1);
+#endif
+      return value;
+    }
+
+    FORCEINLINE uint64
+    rotateLeft(uint64 _value, uint32 _bits)
+    {
+      return (_value << _bits) | (_value >> (64 - _bits));
+    }
+
+    FORCEINLINE uint64
+    xxRound(uint64 _accumulator, uint64 _input)
+    {
+      _accumulator += _input * kPRIME64_2;
+      return rotateLeft(_accumulator, 31) * kPRIME64_1;
+    }
+
+    FORCEINLINE uint64
+    xxMerge(uint64 _accumulator, uint64 _value)
+    {
+      _accumulator ^= xxRound(0, _value);
+      return _accumulator * kPRIME64_1 + kPRIME64_4;
+    }
+
+    FORCEINLINE uint32
+    hashSequence(uint32 _sequence)
+    {
+      return (_sequence * 2654435761u) >> (32 - kHASH_BITS);
+    }
+
+    /*
+     * Writes a length past the 15 of the token, as bytes of 255 and the rest.
+     */
+    FORCEINLINE uint8*
+    writeLength(uint8* _out, SIZE_T _length)
+    {
+      while (_length >= 255) {
+        *_out++ = 255;
+        _length -= 255;
+      }
+      *_out++ = static_cast<uint8>(_length);
+      return _out;
+    }
+
+    /*
+     * Writes a sequence: the literals and then a match, no match on the last
+     * sequence of a block (_matchLength 0). Null if it doesn't fit.
+     */
+    uint8*
+    writeSequence(uint8* _out,
+                  const uint8* _outEnd,
+                  const uint8* _literals,
+                  SIZE_T _literalLength,
+                  SIZE_T _offset,
+                  SIZE_T _matchLength)
+    {
+      SIZE_T needed = 1 + _literalLength / 255 + 1 + _literalLength +
+                      2 + _matchLength / 255 + 1;
+      if (static_cast<SIZE_T>(_outEnd - _out) < needed) {
+        return nullptr;
+      }
+
+      uint8* token = _out++;
+      uint8 tokenValue;
+      if (_literalLength >= 15) {
+        tokenValue = 15 << 4;
+        _out = writeLength(_out, _literalLength - 15);
+      }
+      else {
+        tokenValue = static_cast<uint8>(_literalLength << 4);
+      }
+      std::memcpy(_out, _literals, _literalLength);
+      _out += _literalLength;
+
+      if (0 != _matchLength) {
+        *_out++ = static_cast<uint8>(_offset);
+        *_out++ = static_cast<uint8>(_offset >> 8);
+        SIZE_T length = _matchLength - kMIN_MATCH;
+        if (length >= 15) {
+          tokenValue |= 15;
+          _out = writeLength(_out, length - 15);
+        }
+        else {
+          tokenValue |= static_cast<uint8>(length);
+        }
+      }
+      *token = tokenValue;
+      return _out;
+    }
+
+    /*
+     * Greedy LZ4 block compression with a hash table of the last position
+     * of every 4 bytes. Returns the compressed size, 0 if it doesn't fit.
+     */
+    SIZE_T
+    compressLZ4(const uint8* _in,
+                SIZE_T _size,
+                uint8* _out,
+                SIZE_T _capacity,
+                uint32* _table)
+    {
+      uint8* out = _out;
+      const uint8* outEnd = _out + _capacity;
+      SIZE_T anchor = 0;
+
+      if (_size > kMATCH_FIND_LIMIT) {
+        std::fill(_table, _table + (SIZE_T(1) << kHASH_BITS), 0u);
+        SIZE_T matchLimit = _size - kMATCH_FIND_LIMIT;
+        SIZE_T position = 0;
+        while (position < matchLimit) {
+          uint32 sequence = read32(_in + position);
+          uint32& slot = _table[hashSequence(sequence)];
+          SIZE_T reference = slot;
+          slot = static_cast<uint32>(position);
+          if (reference >= position || position - reference > kMAX_OFFSET ||
+              read32(_in + reference) != sequence) {
+            /* Steps faster on data that doesn't compress. */
+            position += 1 + ((position - anchor) >> 6);
+            continue;
+          }
+
+          while (position > anchor && reference > 0 &&
+                 _in[position - 1] == _in[reference - 1]) {
+            --position;
+            --reference;
+          }
+          SIZE_T length = kMIN_MATCH;
+          SIZE_T maxLength = _size - kLAST_LITERALS - position;
+          while (length + 8 <= maxLength) {
+            uint64 difference = read64(_in + reference + length) ^
+                                read64(_in + position + length);
+            if (0 != difference) {
+              while (0 == (difference & 0xFF)) {
+                difference >>= 8;
+                ++length;
+              }
+              break;
+            }
+            length += 8;
+          }
+          if (length + 8 > maxLength) {
+            while (length < maxLength &&
+                   _in[reference + length] == _in[position + length]) {
+              ++length;
+            }
+          }
+
+          out = writeSequence(out, outEnd, _in + anchor, position - anchor,
+                              position - reference, length);
+          if (nullptr == out) {
+            return 0;
+          }
+          position += length;
+          anchor = position;
+          if (position < matchLimit) {
+            _table[hashSequence(read32(_in + position - 2))] =
+              static_cast<uint32>(position - 2);
+          }
+        }
+      }
+
+      out = writeSequence(out, outEnd, _in + anchor, _size - anchor, 0, 0);
+      return nullptr == out ? 0 : static_cast<SIZE_T>(out - _out);
+    }
+
+    /*
+     * Reads a length past the 15 of the token. False if the block ends.
+     */
+    FORCEINLINE bool
+    readLength(const uint8*& _in, const uint8* _inEnd, SIZE_T& _length)
+    {
+      uint8 byte;
+      do {
+        if (_in == _inEnd) {
+          return false;
+        }
+        byte = *_in++;
+        _length += byte;
+      } while (255 == byte);
+      return true;
+    }
+
+    /*
+     * Decompresses an LZ4 block checking every read and write, so corrupt
+     * data fails instead of going out of the buffers. True only if the block
+     * decompresses to exactly _size bytes.
+     */
+    bool
+    decompressLZ4(const uint8* _in, SIZE_T _packedSize, uint8* _out, SIZE_T _size)
+    {
+      const uint8* in = _in;
+      const uint8* inEnd = _in + _packedSize;
+      uint8* out = _out;
+      uint8* outEnd = _out + _size;
+
+      while (in != inEnd) {
+        uint32 token = *in++;
+        SIZE_T length = token >> 4;
+        if (15 == length && !readLength(in, inEnd, length)) {
+          return false;
+        }
+        if (length > static_cast<SIZE_T>(inEnd - in) ||
+            length > static_cast<SIZE_T>(outEnd - out)) {
+          return false;
+        }
+        std::memcpy(out, in, length);
+        in += length;
+        out += length;
+
+        /* The last sequence has only literals. */
+        if (in == inEnd) {
+          break;
+        }
+        if (inEnd - in < 2) {
+          return false;
+        }
+        SIZE_T offset = static_cast<SIZE_T>(in[0]) | (static_cast<SIZE_T>(in[1]) << 8);
+        in += 2;
+        if (0 == offset || offset > static_cast<SIZE_T>(out - _out)) {
+          return false;
+        }
+        length = token & 15;
+        if (15 == length && !readLength(in, inEnd, length)) {
+          return false;
+        }
+        length += kMIN_MATCH;
+        if (length > static_cast<SIZE_T>(outEnd - out)) {
+          return false;
+        }
+
+        const uint8* match = out - offset;
+        if (offset >= length) {
+          std::memcpy(out, match, length);
+        }
+        else if (offset >= 8) {
+          /* Every 8 bytes read are already written. */
+          SIZE_T i = 0;
+          for (; i + 8 <= length; i += 8) {
+            std::memcpy(out + i, match + i, 8);
+          }
+          for (; i < length; ++i) {
+            out[i] = match[i];
+          }
+        }
+        else {
+          for (SIZE_T i = 0; i < length; ++i) {
+            out[i] = match[i];
+          }
+        }
+        out += length;
+      }
+      return out == outEnd;
+    }
+
+    /*
+     * Runs _kernel(begin, end) over _count items split between the threads,
+     * the calling thread takes the first range. False if any range failed.
+     */
+    template<class Kernel>
+    bool
+    runParallel(SIZE_T _count, SIZE_T _minPerThread, uint32 _threads, const Kernel& _kernel)
+    {
+      SIZE_T threads = 0 == _threads ? std::thread::hardware_concurrency() : _threads;
+      SIZE_T maxThreads = (_count + _minPerThread - 1) / _minPerThread;
+      threads = threads < maxThreads ? threads : maxThreads;
+      threads = threads < 1 ? 1 : threads;
+
+      if (1 == threads) {
+        return _kernel(0, _count);
+      }
+
+      SIZE_T chunk = (_count + threads - 1) / threads;
+      Vector<uint8> results(threads, 1);
+      Vector<std::thread> workers;
+      workers.reserve(threads - 1);
+      SIZE_T index = 1;
+      for (SIZE_T begin = chunk; begin < _count; begin += chunk, ++index) {
+        SIZE_T end = begin + chunk < _count ? begin + chunk : _count;
+        uint8* result = &results[index];
+        workers.emplace_back([&_kernel, result, begin, end]() {
+          *result = _kernel(begin, end) ? 1 : 0;
+        });
+      }
+      results[0] = _kernel(0, chunk) ? 1 : 0;
+      for (std::thread& worker : workers) {
+        worker.join();
+      }
+      return std::all_of(results.begin(), results.end(),
+                         [](uint8 _result) { return 0 != _result; });
+    }
+  }
+
+  ArchiveWriter::ArchiveWriter(uint32 _chunkSize, ARCHIVE_COMPRESSION::E _compression)
+    : m_chunkSize(_chunkSize),
+      m_compression(_compression)
+  {
+    assertm(_chunkSize > 0, "The chunks of an archive can't be empty");
+  }
+
+  void
+  ArchiveWriter::add(const String& _name, const void* _data, SIZE_T _size)
+  {
+    const uint8* bytes = static_cast<const uint8*>(_data);
+    m_assets[_name].assign(bytes, bytes + _size);
+  }
+
+  bool
+  ArchiveWriter::addFile(const String& _name, const String& _path)
+  {
+    Vector<uint8> bytes;
+    if (!File::readAll(_path, bytes)) {
+      return false;
+    }
+    m_assets[_name] = std::move(bytes);
+    return true;
+  }
+
+  void
+  ArchiveWriter::clear()
+  {
+    m_assets.clear();
+  }
+
+  bool
+  ArchiveWriter::save(const String& _path, uint32 _threads) const
+  {
+    /* The map is sorted by name, the order find() searches in. */
+    Vector<ArchiveEntry> entries;
+    Vector<const uint8*> chunkData;
+    Vector<uint32> chunkSizes;
+    entries.reserve(m_assets.size());
+    for (const auto& asset : m_assets) {
+      const Vector<uint8>& bytes = asset.second;
+      ArchiveEntry entry;
+      entry.name = asset.first;
+      entry.size = bytes.size();
+      entry.hash = Archive::hash(bytes.data(), bytes.size());
+      entry.firstChunk = static_cast<uint32>(chunkData.size());
+      for (SIZE_T offset = 0; offset < bytes.size(); offset += m_chunkSize) {
+        SIZE_T left = bytes.size() - offset;
+        chunkData.push_back(bytes.data() + offset);
+        chunkSizes.push_back(static_cast<uint32>(left < m_chunkSize ? left : m_chunkSize));
+      }
+      entry.chunkCount = static_cast<uint32>(chunkData.size()) - entry.firstChunk;
+      entries.push_back(std::move(entry));
+    }
+
+    /* The chunks that don't get smaller are written from the assets. */
+    SIZE_T chunkCount = chunkData.size();
+    Vector<Vector<uint8>> packed(chunkCount);
+    Vector<uint8> compression(chunkCount, ARCHIVE_COMPRESSION::kNONE);
+    if (ARCHIVE_COMPRESSION::kLZ4 == m_compression) {
+      runParallel(chunkCount, 1, _threads, [&](SIZE_T _begin, SIZE_T _end) {
+        Vector<uint32> table(SIZE_T(1) << kHASH_BITS);
+        for (SIZE_T i = _begin; i < _end; ++i) {
+          Vector<uint8>& out = packed[i];
+          out.resize(chunkSizes[i]);
+          SIZE_T size = compressLZ4(chunkData[i], chunkSizes[i],
+                                    out.data(), out.size() - 1, table.data());
+          if (0 == size) {
+            out = Vector<uint8>();
+          }
+          else {
+            out.resize(size);
+            compression[i] = ARCHIVE_COMPRESSION::kLZ4;
+          }
+        }
+        return true;
+      });
+    }
+
+    Vector<uint64> chunkOffsets(chunkCount + 1, 0);
+    for (SIZE_T i = 0; i < chunkCount; ++i) {
+      SIZE_T size = ARCHIVE_COMPRESSION::kNONE == compression[i] ?
+                    chunkSizes[i] : packed[i].size();
+      chunkOffsets[i + 1] = chunkOffsets[i] + size;
+    }
+
+    Serializer header;
+    header.writeBytes(kMAGIC, 4);
+    header.beginObject(Archive::kFORMAT_VERSION);
+    header.write(m_chunkSize);
+    header.write(entries);
+    header.write(chunkOffsets);
+    header.write(compression);
+    header.endObject();
+
+    OFStream file(_path, std::ios::binary | std::ios::trunc);
+    if (!file) {
+      return false;
+    }
+    const Vector<uint8>& headerBytes = header.getBuffer();
+    file.write(reinterpret_cast<const char*>(headerBytes.data()),
+               static_cast<std::streamsize>(headerBytes.size()));
+    for (SIZE_T i = 0; i < chunkCount; ++i) {
+      bool stored = ARCHIVE_COMPRESSION::kNONE == compression[i];
+      const uint8* bytes = stored ? chunkData[i] : packed[i].data();
+      SIZE_T size = static_cast<SIZE_T>(chunkOffsets[i + 1] - chunkOffsets[i]);
+      file.write(reinterpret_cast<const char*>(bytes), static_cast<std::streamsize>(size));
+    }
+    return static_cast<bool>(file);
+  }
+
+  bool
+  Archive::open(const String& _path)
+  {
+    close();
+    if (!m_file.open(_path, FILE_ACCESS_HINT::kRANDOM)) {
+      return false;
+    }
+
+    FileView view = m_file.getView();
+    Deserializer header(view);
+    uint8 magic[4];
+    if (!header.readBytes(magic, 4) || 0 != std::memcmp(magic, kMAGIC, 4) ||
+        kFORMAT_VERSION != header.beginObject()) {
+      close();
+      return false;
+    }
+    header.read(m_chunkSize);
+    header.read(m_entries);
+    header.read(m_chunkOffsets);
+    header.read(m_chunkCompression);
+    header.endObject();
+    m_chunks = view.subview(view.size() - header.getRemaining(), header.getRemaining());
+
+    /* Checked once here, so the reads only check the compressed data. */
+    bool valid = header.isValid() && 0 != m_chunkSize &&
+                 m_chunkOffsets.size() == m_chunkCompression.size() + 1 &&
+                 0 == m_chunkOffsets.front() &&
+                 m_chunkOffsets.back() <= m_chunks.size() &&
+                 std::is_sorted(m_chunkOffsets.begin(), m_chunkOffsets.end());
+    SIZE_T chunkCount = m_chunkCompression.size();
+    for (SIZE_T i = 0; valid && i < m_entries.size(); ++i) {
+      const ArchiveEntry& entry = m_entries[i];
+      /*
+       * Rounded up without adding, so a size near 2^64 can't wrap. Both
+       * counts are 32 bits, the product can't overflow 64 bits.
+       */
+      uint64 chunks = entry.size / m_chunkSize + (0 != entry.size % m_chunkSize ? 1 : 0);
+      valid = chunks == entry.chunkCount &&
+              entry.size <= static_cast<uint64>(entry.chunkCount) * m_chunkSize &&
+              entry.firstChunk <= chunkCount &&
+              entry.chunkCount <= chunkCount - entry.firstChunk &&
+              (0 == i || m_entries[i - 1].name < entry.name);
+    }
+    if (!valid) {
+      close();
+      return false;
+    }
+    return true;
+  }
+
+  void
+  Archive::close()
+  {
+    m_file.close();
+    m_entries.clear();
+    m_chunkOffsets.clear();
+    m_chunkCompression.clear();
+    m_chunks = FileView();
+    m_chunkSize = 0;
+  }
+
+  SIZE_T
+  Archive::find(const String& _name) const
+  {
+    auto found = std::lower_bound(m_entries.begin(), m_entries.end(), _name,
+                                  [](const ArchiveEntry& _entry, const String& _value) {
+                                    return _entry.name < _value;
+                                  });
+    if (m_entries.end() == found || found->name != _name) {
+      return kNOT_FOUND;
+    }
+    return static_cast<SIZE_T>(found - m_entries.begin());
+  }
+
+  SIZE_T
+  Archive::read(SIZE_T _index,
+                SIZE_T _offset,
+                void* _out,
+                SIZE_T _size,
+                uint32 _threads) const
+  {
+    const ArchiveEntry& entry = m_entries[_index];
+    if (_offset >= entry.size) {
+      return 0;
+    }
+    SIZE_T left = static_cast<SIZE_T>(entry.size) - _offset;
+    SIZE_T size = _size < left ? _size : left;
+    if (0 == size) {
+      return 0;
+    }
+
+    SIZE_T first = _offset / m_chunkSize;
+    SIZE_T last = (_offset + size - 1) / m_chunkSize + 1;
+    if (last - first > 1) {
+      SIZE_T begin = entry.firstChunk + first;
+      SIZE_T end = entry.firstChunk + last;
+      m_file.advise(FILE_ACCESS_HINT::kWILL_NEED,
+                    static_cast<SIZE_T>(m_chunks.data() - m_file.getView().data() +
+                                        m_chunkOffsets[begin]),
+                    static_cast<SIZE_T>(m_chunkOffsets[end] - m_chunkOffsets[begin]));
+    }
+
+    uint8* out = static_cast<uint8*>(_out);
+    bool done = runParallel(last - first, kMIN_CHUNKS_PER_THREAD, _threads,
+                            [&](SIZE_T _begin, SIZE_T _end) {
+                              return readChunks(entry, _offset, out, size,
+                                                first + _begin, first + _end);
+                            });
+    return done ? size : 0;
+  }
+
+  bool
+  Archive::read(SIZE_T _index, Vector<uint8>& _out, uint32 _threads) const
+  {
+    SIZE_T size = static_cast<SIZE_T>(m_entries[_index].size);
+    _out.resize(size);
+    return 0 == size || size == read(_index, 0, _out.data(), size, _threads);
+  }
+
+  bool
+  Archive::verify(SIZE_T _index) const
+  {
+    Vector<uint8> bytes;
+    return read(_index, bytes) && hash(bytes.data(), bytes.size()) == m_entries[_index].hash;
+  }
+
+  bool
+  Archive::readChunks(const ArchiveEntry& _entry,
+                      SIZE_T _offset,
+                      uint8* _out,
+                      SIZE_T _size,
+                      SIZE_T _begin,
+                      SIZE_T _end) const
+  {
+    Vector<uint8> scratch;
+    for (SIZE_T chunk = _begin; chunk < _end; ++chunk) {
+      SIZE_T chunkStart = chunk * m_chunkSize;
+      SIZE_T chunkLeft = static_cast<SIZE_T>(_entry.size) - chunkStart;
+      SIZE_T chunkSize = chunkLeft < m_chunkSize ? chunkLeft : m_chunkSize;
+      SIZE_T from = (_offset > chunkStart ? _offset : chunkStart) - chunkStart;
+      SIZE_T to = (_offset + _size < chunkStart + chunkSize ?
+                   _offset + _size : chunkStart + chunkSize) - chunkStart;
+      uint8* target = _out + (chunkStart + from - _offset);
+
+      SIZE_T index = _entry.firstChunk + chunk;
+      const uint8* packed = m_chunks.data() + m_chunkOffsets[index];
+      SIZE_T packedSize = static_cast<SIZE_T>(m_chunkOffsets[index + 1] -
+                                              m_chunkOffsets[index]);
+
+      switch (m_chunkCompression[index]) {
+        case ARCHIVE_COMPRESSION::kNONE:
+          if (packedSize != chunkSize) {
+            return false;
+          }
+          std::memcpy(target, packed + from, to - from);
+          break;
+
+        case ARCHIVE_COMPRESSION::kLZ4:
+          if (0 == from && chunkSize == to) {
+            if (!decompressLZ4(packed, packedSize, target, chunkSize)) {
+              return false;
+            }
+          }
+          else {
+            /* Cut by the range, it goes through the scratch chunk. */
+            scratch.resize(m_chunkSize);
+            if (!decompressLZ4(packed, packedSize, scratch.data(), chunkSize)) {
+              return false;
+            }
+            std::memcpy(target, scratch.data() + from, to - from);
+          }
+          break;
+
+        default:
+          return false;
+      }
+    }
+    return true;
+  }
+
+  uint64
+  Archive::hash(const void* _data, SIZE_T _size, uint64 _seed)
+  {
+    const uint8* data = static_cast<const uint8*>(_data);
+    const uint8* end = data + _size;
+    uint64 result;
+
+    if (_size >= 32) {
+      uint64 v1 = _seed + kPRIME64_1 + kPRIME64_2;
+      uint64 v2 = _seed + kPRIME64_2;
+      uint64 v3 = _seed;
+      uint64 v4 = _seed - kPRIME64_1;
+      const uint8* limit = end - 32;
+      do {
+        v1 = xxRound(v1, read64(data));
+        v2 = xxRound(v2, read64(data + 8));
+        v3 = xxRound(v3, read64(data + 16));
+        v4 = xxRound(v4, read64(data + 24));
+        data += 32;
+      } while (data <= limit);
+      result = rotateLeft(v1, 1) + rotateLeft(v2, 7) +
+               rotateLeft(v3, 12) + rotateLeft(v4, 18);
+      result = xxMerge(result, v1);
+      result = xxMerge(result, v2);
+      result = xxMerge(result, v3);
+      result = xxMerge(result, v4);
+    }
+    else {
+      result = _seed + kPRIME64_5;
+    }
+
+    result += static_cast<uint64>(_size);
+    for (; data + 8 <= end; data += 8) {
+      result ^= xxRound(0, read64(data));
+      result = rotateLeft(result, 27) * kPRIME64_1 + kPRIME64_4;
+    }
+    if (data + 4 <= end) {
+      result ^= static_cast<uint64>(read32(data)) * kPRIME64_1;
+      result = rotateLeft(result, 23) * kPRIME64_2 + kPRIME64_3;
+      data += 4;
+    }
+    for (; data < end; ++data) {
+      result ^= static_cast<uint64>(*data) * kPRIME64_5;
+      result = rotateLeft(result, 11) * kPRIME64_1;
+    }
+
+    result ^= result >> 33;
+    result *= kPRIME64_2;
+    result ^= result >> 29;
+    result *= kPRIME64_3;
+    result ^= result >> 32;
+    return result;
+  }
+}
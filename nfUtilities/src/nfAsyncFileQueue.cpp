@@ -0,0 +1,524 @@
+#include "nfAsyncFileQueue.h"
+
+#include <algorithm>
+#include <cstring>
+
+/*
+ * io_uring is used where the kernel headers have it, define NF_IO_URING as
+ * 0 to build without it.
+ */
+#if !defined(NF_IO_URING) && NF_PLATFORM == NF_PLATFORM_LINUX && defined(__has_include)
+# if __has_include(<linux/io_uring.h>)
+#   define NF_IO_URING 1
+# endif
+#endif
+#ifndef NF_IO_URING
+# define NF_IO_URING 0
+#endif
+
+#if NF_PLATFORM != NF_PLATFORM_WIN32
+# include <cerrno>
+# include <sys/uio.h>
+# include <unistd.h>
+#endif
+#if NF_IO_URING
+# include <linux/io_uring.h>
+# include <poll.h>
+# include <sys/eventfd.h>
+# include <sys/mman.h>
+# include <sys/syscall.h>
+#endif
+
+namespace nfEngineSDK
+{
+  struct AsyncFileQueue::Operation
+  {
+    /*
+     * A request and the callback of its batch.
+     */
+    struct Part
+    {
+      AsyncReadRequest request;
+      SPtr<Callback> callback;
+    };
+
+    intptr_t handle;
+    SIZE_T offset;
+    SIZE_T size;
+    /*
+     * The bytes read so far, the read continues from here when it comes
+     * short.
+     */
+    SIZE_T done;
+    Vector<Part> parts;
+#if NF_PLATFORM != NF_PLATFORM_WIN32
+    /*
+     * The destinations of the parts, for the scattered read.
+     */
+    Vector<iovec> vectors;
+    /*
+     * The first vector not read completely.
+     */
+    SIZE_T firstVector;
+#endif
+
+#if NF_PLATFORM != NF_PLATFORM_WIN32
+    void
+    prepareVectors()
+    {
+      vectors.resize(parts.size());
+      for (SIZE_T i = 0; i < parts.size(); ++i) {
+        vectors[i].iov_base = parts[i].request.destination;
+        vectors[i].iov_len = parts[i].request.size;
+      }
+      firstVector = 0;
+    }
+
+    /*
+     * Moves the vectors past the bytes just read.
+     */
+    void
+    advanceVectors(SIZE_T _bytes)
+    {
+      done += _bytes;
+      while (_bytes > 0) {
+        iovec& vector = vectors[firstVector];
+        if (_bytes < vector.iov_len) {
+          vector.iov_base = static_cast<uint8*>(vector.iov_base) + _bytes;
+          vector.iov_len -= _bytes;
+          return;
+        }
+        _bytes -= vector.iov_len;
+        ++firstVector;
+      }
+    }
+#endif
+
+    /*
+     * A blocking read of the whole operation.
+     */
+    SIZE_T
+    read()
+    {
+#if NF_PLATFORM == NF_PLATFORM_WIN32
+      if (1 == parts.size()) {
+        return File::readAt(handle, offset,
+                            static_cast<uint8*>(parts[0].request.destination), size);
+      }
+      /* Windows only scatters unbuffered page aligned reads, so it copies. */
+      Vector<uint8> buffer(size);
+      done = File::readAt(handle, offset, buffer.data(), size);
+      SIZE_T position = 0;
+      for (const Part& part : parts) {
+        if (position < done) {
+          SIZE_T partSize = part.request.size < done - position ?
+                            part.request.size : done - position;
+          std::memcpy(part.request.destination, buffer.data() + position, partSize);
+        }
+        position += part.request.size;
+      }
+      return done;
+#else
+      prepareVectors();
+      while (done < size) {
+        ssize_t readBytes = preadv(static_cast<int>(handle), &vectors[firstVector],
+                                   static_cast<int>(vectors.size() - firstVector),
+                                   static_cast<off_t>(offset + done));
+        if (readBytes < 0 && EINTR == errno) {
+          continue;
+        }
+        if (readBytes <= 0) {
+          break;
+        }
+        advanceVectors(static_cast<SIZE_T>(readBytes));
+      }
+      return done;
+#endif
+    }
+  };
+
+#if NF_IO_URING
+  struct AsyncFileQueue::Ring
+  {
+    /*
+     * Creates the ring, the result is not usable if ringFd is negative.
+     */
+    explicit
+    Ring(uint32 _entries)
+    {
+      io_uring_params params;
+      std::memset(&params, 0, sizeof(params));
+      ringFd = static_cast<int>(syscall(__NR_io_uring_setup, _entries, &params));
+      if (ringFd < 0) {
+        return;
+      }
+
+      sqRingSize = params.sq_off.array + params.sq_entries * sizeof(uint32);
+      cqRingSize = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+      bool single = 0 != (params.features & IORING_FEAT_SINGLE_MMAP);
+      if (single) {
+        sqRingSize = cqRingSize = std::max(sqRingSize, cqRingSize);
+      }
+      sqRing = mmap(nullptr, sqRingSize, PROT_READ | PROT_WRITE,
+                    MAP_SHARED | MAP_POPULATE, ringFd, IORING_OFF_SQ_RING);
+      cqRing = single ? sqRing :
+               mmap(nullptr, cqRingSize, PROT_READ | PROT_WRITE,
+                    MAP_SHARED | MAP_POPULATE, ringFd, IORING_OFF_CQ_RING);
+      sqesSize = params.sq_entries * sizeof(io_uring_sqe);
+      sqes = static_cast<io_uring_sqe*>(mmap(nullptr, sqesSize, PROT_READ | PROT_WRITE,
+                                             MAP_SHARED | MAP_POPULATE, ringFd,
+                                             IORING_OFF_SQES));
+      doorbell = eventfd(0, EFD_CLOEXEC);
+      if (MAP_FAILED == sqRing || MAP_FAILED == cqRing ||
+          MAP_FAILED == static_cast<void*>(sqes) || doorbell < 0) {
+        release();
+        return;
+      }
+
+      uint8* sq = static_cast<uint8*>(sqRing);
+      sqTail = reinterpret_cast<uint32*>(sq + params.sq_off.tail);
+      sqMask = *reinterpret_cast<uint32*>(sq + params.sq_off.ring_mask);
+      sqArray = reinterpret_cast<uint32*>(sq + params.sq_off.array);
+      uint8* cq = static_cast<uint8*>(cqRing);
+      cqHead = reinterpret_cast<uint32*>(cq + params.cq_off.head);
+      cqTail = reinterpret_cast<uint32*>(cq + params.cq_off.tail);
+      cqMask = *reinterpret_cast<uint32*>(cq + params.cq_off.ring_mask);
+      cqes = reinterpret_cast<io_uring_cqe*>(cq + params.cq_off.cqes);
+    }
+    ~Ring()
+    {
+      release();
+    }
+
+    void
+    release()
+    {
+      if (nullptr != sqes && MAP_FAILED != static_cast<void*>(sqes)) {
+        munmap(sqes, sqesSize);
+      }
+      if (nullptr != cqRing && MAP_FAILED != cqRing && cqRing != sqRing) {
+        munmap(cqRing, cqRingSize);
+      }
+      if (nullptr != sqRing && MAP_FAILED != sqRing) {
+        munmap(sqRing, sqRingSize);
+      }
+      if (doorbell >= 0) {
+        ::close(doorbell);
+      }
+      if (ringFd >= 0) {
+        ::close(ringFd);
+      }
+      sqes = nullptr;
+      cqRing = sqRing = nullptr;
+      doorbell = ringFd = -1;
+    }
+
+    /*
+     * The next free submission entry, cleared. Only the thread of the ring
+     * writes on the submission queue, so the tail is read plainly.
+     */
+    io_uring_sqe*
+    nextEntry()
+    {
+      uint32 tail = *sqTail + unsubmitted;
+      uint32 index = tail & sqMask;
+      io_uring_sqe* entry = &sqes[index];
+      std::memset(entry, 0, sizeof(*entry));
+      sqArray[index] = index;
+      ++unsubmitted;
+      return entry;
+    }
+
+    void
+    prepareRead(Operation* _operation)
+    {
+      io_uring_sqe* entry = nextEntry();
+      entry->opcode = IORING_OP_READV;
+      entry->fd = static_cast<int32>(_operation->handle);
+      entry->addr = reinterpret_cast<uint64>(&_operation->vectors[_operation->firstVector]);
+      entry->len = static_cast<uint32>(_operation->vectors.size() - _operation->firstVector);
+      entry->off = static_cast<uint64>(_operation->offset + _operation->done);
+      entry->user_data = reinterpret_cast<uint64>(_operation);
+    }
+
+    /*
+     * Waits for the doorbell, so a submit wakes the thread blocked on the
+     * completions.
+     */
+    void
+    prepareDoorbell()
+    {
+      io_uring_sqe* entry = nextEntry();
+      entry->opcode = IORING_OP_POLL_ADD;
+      entry->fd = doorbell;
+      entry->poll_events = POLLIN;
+      entry->user_data = 0;
+    }
+
+    /*
+     * Publishes the new entries and waits for one completion at least.
+     */
+    void
+    submitAndWait()
+    {
+      __atomic_store_n(sqTail, *sqTail + unsubmitted, __ATOMIC_RELEASE);
+      uint32 toSubmit = unsubmitted;
+      unsubmitted = 0;
+      for (;;) {
+        long result = syscall(__NR_io_uring_enter, ringFd, toSubmit, 1,
+                              IORING_ENTER_GETEVENTS, nullptr, 0);
+        if (result >= 0 || EINTR != errno) {
+          return;
+        }
+        /* The entries were taken before the signal, don't send them twice. */
+        toSubmit = 0;
+      }
+    }
+
+    void
+    ringDoorbell()
+    {
+      uint64 one = 1;
+      ssize_t written = write(doorbell, &one, sizeof(one));
+      (void)written;
+    }
+
+    int ringFd = -1;
+    int doorbell = -1;
+    void* sqRing = nullptr;
+    void* cqRing = nullptr;
+    io_uring_sqe* sqes = nullptr;
+    SIZE_T sqRingSize = 0;
+    SIZE_T cqRingSize = 0;
+    SIZE_T sqesSize = 0;
+    uint32* sqTail = nullptr;
+    uint32* sqArray = nullptr;
+    uint32 sqMask = 0;
+    uint32* cqHead = nullptr;
+    uint32* cqTail = nullptr;
+    uint32 cqMask = 0;
+    io_uring_cqe* cqes = nullptr;
+    /*
+     * The entries written and not published yet.
+     */
+    uint32 unsubmitted = 0;
+  };
+#else
+  struct AsyncFileQueue::Ring
+  {};
+#endif
+
+  AsyncFileQueue::AsyncFileQueue(uint32 _queueDepth, uint32 _threads)
+    : m_queueDepth(_queueDepth > 0 ? _queueDepth : 1)
+  {
+#if NF_IO_URING
+    /* One more entry for the doorbell. */
+    m_ring = new Ring(m_queueDepth + 1);
+    if (m_ring->ringFd >= 0) {
+      m_threads.emplace_back(&AsyncFileQueue::ringLoop, this);
+      return;
+    }
+    delete m_ring;
+    m_ring = nullptr;
+#endif
+    uint32 threads = 0 == _threads ? std::thread::hardware_concurrency() : _threads;
+    threads = std::min(std::max(threads, 1u), m_queueDepth);
+    for (uint32 i = 0; i < threads; ++i) {
+      m_threads.emplace_back(&AsyncFileQueue::workerLoop, this);
+    }
+  }
+
+  AsyncFileQueue::~AsyncFileQueue()
+  {
+    wait();
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_stop = true;
+    }
+    m_wake.notify_all();
+#if NF_IO_URING
+    if (nullptr != m_ring) {
+      m_ring->ringDoorbell();
+    }
+#endif
+    for (std::thread& thread : m_threads) {
+      thread.join();
+    }
+    delete m_ring;
+  }
+
+  void
+  AsyncFileQueue::submit(const AsyncReadRequest* _requests,
+                         SIZE_T _count,
+                         const Callback& _callback)
+  {
+    if (0 == _count) {
+      return;
+    }
+    SPtr<Callback> callback = std::make_shared<Callback>(_callback);
+
+    /* Sorted by file and offset, so the contiguous ones are together. */
+    Vector<const AsyncReadRequest*> sorted(_count);
+    for (SIZE_T i = 0; i < _count; ++i) {
+      sorted[i] = &_requests[i];
+    }
+    std::sort(sorted.begin(), sorted.end(),
+              [](const AsyncReadRequest* _a, const AsyncReadRequest* _b) {
+      intptr_t a = _a->file->getNativeHandle();
+      intptr_t b = _b->file->getNativeHandle();
+      return a != b ? a < b : _a->offset < _b->offset;
+    });
+
+    Vector<Operation*> operations;
+    Operation* current = nullptr;
+    for (const AsyncReadRequest* request : sorted) {
+      intptr_t handle = request->file->getNativeHandle();
+      if (nullptr != current &&
+          current->handle == handle &&
+          current->offset + current->size == request->offset &&
+          current->size + request->size <= kMAX_COALESCED_SIZE &&
+          current->parts.size() < kMAX_COALESCED_REQUESTS) {
+        current->size += request->size;
+        current->parts.push_back(Operation::Part{ *request, callback });
+        continue;
+      }
+      current = new Operation();
+      current->handle = handle;
+      current->offset = request->offset;
+      current->size = request->size;
+      current->done = 0;
+      current->parts.push_back(Operation::Part{ *request, callback });
+      operations.push_back(current);
+    }
+
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_pending.insert(m_pending.end(), operations.begin(), operations.end());
+      m_outstanding += operations.size();
+    }
+#if NF_IO_URING
+    if (nullptr != m_ring) {
+      m_ring->ringDoorbell();
+      return;
+    }
+#endif
+    m_wake.notify_all();
+  }
+
+  std::future<SIZE_T>
+  AsyncFileQueue::submit(const AsyncReadRequest& _request)
+  {
+    SPtr<std::promise<SIZE_T>> promise = std::make_shared<std::promise<SIZE_T>>();
+    std::future<SIZE_T> future = promise->get_future();
+    submit(&_request, 1, [promise](const AsyncReadRequest&, SIZE_T _bytesRead) {
+      promise->set_value(_bytesRead);
+    });
+    return future;
+  }
+
+  void
+  AsyncFileQueue::wait()
+  {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_idle.wait(lock, [this]() { return 0 == m_outstanding; });
+  }
+
+  void
+  AsyncFileQueue::complete(Operation* _operation, SIZE_T _bytesRead)
+  {
+    SIZE_T position = 0;
+    for (const Operation::Part& part : _operation->parts) {
+      SIZE_T bytes = 0;
+      if (position < _bytesRead) {
+        bytes = std::min(part.request.size, _bytesRead - position);
+      }
+      (*part.callback)(part.request, bytes);
+      position += part.request.size;
+    }
+    delete _operation;
+
+    bool idle;
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      idle = 0 == --m_outstanding;
+    }
+    if (idle) {
+      m_idle.notify_all();
+    }
+  }
+
+  void
+  AsyncFileQueue::workerLoop()
+  {
+    for (;;) {
+      Operation* operation;
+      {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_wake.wait(lock, [this]() { return m_stop || !m_pending.empty(); });
+        if (m_pending.empty()) {
+          return;
+        }
+        operation = m_pending.front();
+        m_pending.pop_front();
+      }
+      complete(operation, operation->read());
+    }
+  }
+
+  void
+  AsyncFileQueue::ringLoop()
+  {
+#if NF_IO_URING
+    Ring& ring = *m_ring;
+    uint32 inFlight = 0;
+    ring.prepareDoorbell();
+    for (;;) {
+      {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        while (inFlight < m_queueDepth && !m_pending.empty()) {
+          Operation* operation = m_pending.front();
+          m_pending.pop_front();
+          operation->prepareVectors();
+          ring.prepareRead(operation);
+          ++inFlight;
+        }
+        if (m_stop && m_pending.empty() && 0 == inFlight) {
+          return;
+        }
+      }
+      ring.submitAndWait();
+
+      uint32 head = *ring.cqHead;
+      uint32 tail = __atomic_load_n(ring.cqTail, __ATOMIC_ACQUIRE);
+      for (; head != tail; ++head) {
+        const io_uring_cqe& entry = ring.cqes[head & ring.cqMask];
+        Operation* operation = reinterpret_cast<Operation*>(entry.user_data);
+        int32 result = entry.res;
+        __atomic_store_n(ring.cqHead, head + 1, __ATOMIC_RELEASE);
+
+        if (nullptr == operation) {
+          uint64 count;
+          ssize_t readBytes = read(ring.doorbell, &count, sizeof(count));
+          (void)readBytes;
+          ring.prepareDoorbell();
+          continue;
+        }
+        if (result > 0) {
+          operation->advanceVectors(static_cast<SIZE_T>(result));
+          if (operation->done < operation->size) {
+            /* A short read before the end, the rest goes again. */
+            ring.prepareRead(operation);
+            continue;
+          }
+        }
+        else if (-EINTR == result || -EAGAIN == result) {
+          ring.prepareRead(operation);
+          continue;
+        }
+        --inFlight;
+        complete(operation, operation->done);
+      }
+    }
+#endif
+  }
+}
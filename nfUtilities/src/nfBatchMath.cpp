@@ -0,0 +1,88 @@
+#include "nfBatchMath.h"
+
+#include <atomic>
+
+#include "nfBatchKernels.h"
+
+namespace nfEngineSDK
+{
+  namespace {
+    /*
+     * The table in use, null until the first call picks the one of
+     * CPUFeatures.
+     */
+    std::atomic<const BatchKernels*> s_current{ nullptr };
+  }
+
+  const BatchKernels&
+  BatchMath::getKernels()
+  {
+    const BatchKernels* kernels = s_current.load(std::memory_order_acquire);
+    if (nullptr == kernels) {
+      const BatchKernels* expected = nullptr;
+      kernels = &getTable(CPUFeatures::getTier());
+      if (!s_current.compare_exchange_strong(expected, kernels, std::memory_order_acq_rel)) {
+        kernels = expected;
+      }
+    }
+    return *kernels;
+  }
+
+  CPU_TIER::E
+  BatchMath::getTier()
+  {
+    const BatchKernels* current = &getKernels();
+    for (uint32 tier = 0; tier < CPU_TIER::kCOUNT; ++tier) {
+      if (&getTable(static_cast<CPU_TIER::E>(tier)) == current) {
+        return static_cast<CPU_TIER::E>(tier);
+      }
+    }
+    return CPU_TIER::kSCALAR;
+  }
+
+  CPU_TIER::E
+  BatchMath::setTier(CPU_TIER::E _tier)
+  {
+    CPU_TIER::E supported = CPUFeatures::getSupportedTier();
+    CPU_TIER::E tier = _tier < supported ? _tier : supported;
+    s_current.store(&getTable(tier), std::memory_order_release);
+    return tier;
+  }
+
+  const BatchKernels&
+  BatchMath::getTable(CPU_TIER::E _tier)
+  {
+    struct Tables
+    {
+      Tables()
+      {
+        fillScalarKernels(kernels[CPU_TIER::kSCALAR]);
+#if NF_ARCH_X86
+        kernels[CPU_TIER::kSSE2] = kernels[CPU_TIER::kSCALAR];
+        fillSSE2Kernels(kernels[CPU_TIER::kSSE2]);
+        kernels[CPU_TIER::kSSE4_1] = kernels[CPU_TIER::kSSE2];
+        fillSSE4_1Kernels(kernels[CPU_TIER::kSSE4_1]);
+        kernels[CPU_TIER::kAVX2] = kernels[CPU_TIER::kSSE4_1];
+        fillAVX2Kernels(kernels[CPU_TIER::kAVX2]);
+        kernels[CPU_TIER::kAVX512] = kernels[CPU_TIER::kAVX2];
+        fillAVX512Kernels(kernels[CPU_TIER::kAVX512]);
+#else
+        for (uint32 tier = 1; tier < CPU_TIER::kCOUNT; ++tier) {
+          kernels[tier] = kernels[CPU_TIER::kSCALAR];
+        }
+#endif
+      }
+
+      BatchKernels kernels[CPU_TIER::kCOUNT];
+    };
+    static const Tables tables;
+    return tables.kernels[_tier];
+  }
+
+  void
+  BatchMath::fillScalarKernels(BatchKernels& _kernels)
+  {
+    fillMathKernels<ScalarPack>(_kernels);
+    fillSkinningKernels<ScalarSkinner>(_kernels);
+  }
+}
@@ -0,0 +1,266 @@
+#include "nfBatchMath.h"
+
+#if NF_ARCH_X86
+# include <cstring>
+# include <immintrin.h>
+
+NF_TARGET_BEGIN("avx2,fma")
+# include "nfBatchKernels.h"
+
+namespace nfEngineSDK
+{
+  namespace {
+    FORCEINLINE __m256
+    multiplyAdd(__m256 _a, __m256 _b, __m256 _c)
+    {
+# if NF_MATH_DETERMINISTIC
+      return _mm256_add_ps(_mm256_mul_ps(_a, _b), _c);
+# else
+      return _mm256_fmadd_ps(_a, _b, _c);
+# endif
+    }
+
+    /*
+     * Eight floats on AVX2, the 128 bits lanes are groups of four.
+     */
+    struct AVX2Pack
+    {
+      using Reg = __m256;
+      using IntReg = __m256i;
+      using Mask = __m256;
+      static const SIZE_T kLANES = 8;
+
+      static FORCEINLINE Reg load(const float* p) { return _mm256_loadu_ps(p); }
+      static FORCEINLINE void store(float* p, Reg v) { _mm256_storeu_ps(p, v); }
+      static FORCEINLINE Reg
+      loadQuads(const float* p, SIZE_T stride)
+      {
+        return _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(p)),
+                                    _mm_loadu_ps(p + stride), 1);
+      }
+      static FORCEINLINE void
+      storeQuads(float* p, SIZE_T stride, Reg v)
+      {
+        _mm_storeu_ps(p, _mm256_castps256_ps128(v));
+        _mm_storeu_ps(p + stride, _mm256_extractf128_ps(v, 1));
+      }
+      template<int i0, int i1, int i2, int i3>
+      static FORCEINLINE Reg shuffle(Reg a, Reg b)
+      {
+        return _mm256_shuffle_ps(a, b, _MM_SHUFFLE(i3, i2, i1, i0));
+      }
+      static FORCEINLINE Reg set(float v) { return _mm256_set1_ps(v); }
+      static FORCEINLINE Reg add(Reg a, Reg b) { return _mm256_add_ps(a, b); }
+      static FORCEINLINE Reg sub(Reg a, Reg b) { return _mm256_sub_ps(a, b); }
+      static FORCEINLINE Reg mul(Reg a, Reg b) { return _mm256_mul_ps(a, b); }
+      static FORCEINLINE Reg div(Reg a, Reg b) { return _mm256_div_ps(a, b); }
+      static FORCEINLINE Reg sqrt(Reg a) { return _mm256_sqrt_ps(a); }
+      static FORCEINLINE Reg madd(Reg a, Reg b, Reg c) { return multiplyAdd(a, b, c); }
+      static FORCEINLINE IntReg roundToInt(Reg a) { return _mm256_cvtps_epi32(a); }
+      static FORCEINLINE Reg toFloat(IntReg a) { return _mm256_cvtepi32_ps(a); }
+      static FORCEINLINE IntReg setInt(int32 v) { return _mm256_set1_epi32(v); }
+      static FORCEINLINE IntReg addInt(IntReg a, IntReg b) { return _mm256_add_epi32(a, b); }
+      static FORCEINLINE IntReg andInt(IntReg a, IntReg b) { return _mm256_and_si256(a, b); }
+      template<int bits>
+      static FORCEINLINE IntReg shiftLeft(IntReg a) { return _mm256_slli_epi32(a, bits); }
+      static FORCEINLINE Reg
+      xorBits(Reg a, IntReg b)
+      {
+        return _mm256_xor_ps(a, _mm256_castsi256_ps(b));
+      }
+      static FORCEINLINE Mask greater(Reg a, Reg b) { return _mm256_cmp_ps(a, b, _CMP_GT_OQ); }
+      static FORCEINLINE Mask greaterEqual(Reg a, Reg b) { return _mm256_cmp_ps(a, b, _CMP_GE_OQ); }
+      static FORCEINLINE Mask
+      equalInt(IntReg a, IntReg b)
+      {
+        return _mm256_castsi256_ps(_mm256_cmpeq_epi32(a, b));
+      }
+      static FORCEINLINE Mask andMask(Mask a, Mask b) { return _mm256_and_ps(a, b); }
+      static FORCEINLINE Reg select(Mask m, Reg a, Reg b) { return _mm256_blendv_ps(b, a, m); }
+      static FORCEINLINE uint32
+      maskBits(Mask m)
+      {
+        return static_cast<uint32>(_mm256_movemask_ps(m));
+      }
+    };
+
+    struct AVX2Skinner
+    {
+      /*
+       * A 3x4 matrix with columns 0 and 1 in one register and columns 2 and
+       * 3 in the other.
+       */
+      struct Columns
+      {
+        FORCEINLINE void
+        load(const float* _m)
+        {
+          c01 = _mm256_load_ps(_m);
+          c23 = _mm256_load_ps(_m + 8);
+        }
+        FORCEINLINE void
+        scale(const float* _m, float _w)
+        {
+          __m256 w = _mm256_set1_ps(_w);
+          c01 = _mm256_mul_ps(w, _mm256_load_ps(_m));
+          c23 = _mm256_mul_ps(w, _mm256_load_ps(_m + 8));
+        }
+        FORCEINLINE void
+        addScaled(const float* _m, float _w)
+        {
+          __m256 w = _mm256_set1_ps(_w);
+          c01 = multiplyAdd(w, _mm256_load_ps(_m), c01);
+          c23 = multiplyAdd(w, _mm256_load_ps(_m + 8), c23);
+        }
+
+        /*
+         * Columns times (x, y, z, _w), _w being 1 for points and 0 for
+         * directions. The 16 bytes read from _xyz must be inside the vertex.
+         */
+        FORCEINLINE __m128
+        transform(const float* _xyz, float _w) const
+        {
+          __m128 v = _mm_loadu_ps(_xyz);
+          __m256 vv = _mm256_insertf128_ps(_mm256_castps128_ps256(v), v, 1);
+          __m256 xy = _mm256_permutevar_ps(vv, _mm256_setr_epi32(0, 0, 0, 0, 1, 1, 1, 1));
+          __m256 zw = _mm256_permutevar_ps(vv, _mm256_set1_epi32(2));
+          zw = _mm256_blend_ps(zw, _mm256_set1_ps(_w), 0xF0);
+          __m256 r = multiplyAdd(c23, zw, _mm256_mul_ps(c01, xy));
+          return _mm_add_ps(_mm256_castps256_ps128(r), _mm256_extractf128_ps(r, 1));
+        }
+        FORCEINLINE void
+        point(const float* _xyz, Vector3f& _out) const
+        {
+          SSESkinner<true>::storeVector3(_out, transform(_xyz, 1.0f));
+        }
+        FORCEINLINE void
+        direction(const float* _xyz, Vector3f& _out) const
+        {
+          SSESkinner<true>::storeVector3(_out, transform(_xyz, 0.0f));
+        }
+        FORCEINLINE void
+        unitDirection(const float* _xyz, Vector3f& _out) const
+        {
+          SSESkinner<true>::storeVector3(
+            _out, SSESkinner<true>::normalize3(transform(_xyz, 0.0f)));
+        }
+
+        __m256 c01;
+        __m256 c23;
+      };
+
+      /*
+       * A blended dual quaternion, real part in the low half and dual part
+       * in the high half.
+       */
+      using DualQuaternionSum = __m256;
+
+      /*
+       * Sum of the weighted dual quaternions. The bones on the opposite
+       * hemisphere of the first one are subtracted instead of added.
+       */
+      template<uint32 size>
+      static FORCEINLINE DualQuaternionSum
+      sumDualQuaternions(const SkinningDualQuaternion* _palette,
+                         const int32* _indices,
+                         const float* _weights)
+      {
+        const __m256 signBit = _mm256_set1_ps(-0.0f);
+        __m256 q0 = _mm256_load_ps(&_palette[_indices[0]].real.x);
+        __m128 real0 = _mm256_castps256_ps128(q0);
+        __m256 sum = _mm256_mul_ps(_mm256_set1_ps(_weights[0]), q0);
+        for (uint32 i = 1; i < size; ++i) {
+          __m256 q = _mm256_load_ps(&_palette[_indices[i]].real.x);
+          __m128 d = _mm_dp_ps(real0, _mm256_castps256_ps128(q), 0xFF);
+          __m256 dd = _mm256_insertf128_ps(_mm256_castps128_ps256(d), d, 1);
+          __m256 w = _mm256_xor_ps(_mm256_set1_ps(_weights[i]),
+                                   _mm256_and_ps(dd, signBit));
+          sum = multiplyAdd(w, q, sum);
+        }
+        return sum;
+      }
+
+      /*
+       * Writes in _c the matrix of a blended dual quaternion, normalizing it
+       * on the way. Every column is a sum of products of permuted
+       * components, so it is built without leaving the registers.
+       */
+      static FORCEINLINE void
+      toColumns(DualQuaternionSum _dq, Columns& _c)
+      {
+        __m128 r = _mm256_castps256_ps128(_dq);
+        __m128 d = _mm256_extractf128_ps(_dq, 1);
+        /* Dividing by the squared length is the same as normalizing. */
+        __m128 s = _mm_div_ps(_mm_set1_ps(2.0f), _mm_dp_ps(r, r, 0xFF));
+        __m128 rs = _mm_mul_ps(r, s);
+        __m128 ds = _mm_mul_ps(d, s);
+        __m256 rr = _mm256_insertf128_ps(_mm256_castps128_ps256(r), r, 1);
+        __m256 rsrs = _mm256_insertf128_ps(_mm256_castps128_ps256(rs), rs, 1);
+        __m256 rsds = _mm256_insertf128_ps(_mm256_castps128_ps256(rs), ds, 1);
+
+        /*
+         * col0 = e0 + (y, x, x)(-ys, ys, zs) + (z, w, w)(-zs, zs, -ys)
+         * col1 = e1 + (x, x, y)(ys, -xs, zs) + (w, z, w)(-zs, -zs, xs)
+         */
+        __m256 c01 = _mm256_setr_ps(1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f);
+        c01 = multiplyAdd(
+          _mm256_permutevar_ps(rr, _mm256_setr_epi32(1, 0, 0, 0, 0, 0, 1, 0)),
+          _mm256_mul_ps(
+            _mm256_permutevar_ps(rsrs, _mm256_setr_epi32(1, 1, 2, 0, 1, 0, 2, 0)),
+            _mm256_setr_ps(-1.0f, 1.0f, 1.0f, 0.0f, 1.0f, -1.0f, 1.0f, 0.0f)),
+          c01);
+        c01 = multiplyAdd(
+          _mm256_permutevar_ps(rr, _mm256_setr_epi32(2, 3, 3, 0, 3, 2, 3, 0)),
+          _mm256_mul_ps(
+            _mm256_permutevar_ps(rsrs, _mm256_setr_epi32(2, 2, 1, 0, 2, 2, 0, 0)),
+            _mm256_setr_ps(-1.0f, 1.0f, -1.0f, 0.0f, -1.0f, -1.0f, 1.0f, 0.0f)),
+          c01);
+
+        /*
+         * col2 = e2 + (x, y, x)(zs, zs, -xs) + (w, w, y)(ys, -xs, -ys)
+         * translation = w ds - dws r + r x ds
+         */
+        __m256 c23 = _mm256_setr_ps(0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f);
+        c23 = multiplyAdd(
+          _mm256_permutevar_ps(rr, _mm256_setr_epi32(0, 1, 0, 0, 3, 3, 3, 0)),
+          _mm256_mul_ps(
+            _mm256_permutevar_ps(rsds, _mm256_setr_epi32(2, 2, 0, 0, 0, 1, 2, 0)),
+            _mm256_setr_ps(1.0f, 1.0f, -1.0f, 0.0f, 1.0f, 1.0f, 1.0f, 0.0f)),
+          c23);
+        c23 = multiplyAdd(
+          _mm256_permutevar_ps(rr, _mm256_setr_epi32(3, 3, 1, 0, 0, 1, 2, 0)),
+          _mm256_mul_ps(
+            _mm256_permutevar_ps(rsds, _mm256_setr_epi32(1, 0, 1, 0, 3, 3, 3, 0)),
+            _mm256_setr_ps(1.0f, -1.0f, -1.0f, 0.0f, -1.0f, -1.0f, -1.0f, 0.0f)),
+          c23);
+        c23 = multiplyAdd(
+          _mm256_permutevar_ps(rr, _mm256_setr_epi32(0, 0, 0, 0, 1, 2, 0, 0)),
+          _mm256_mul_ps(
+            _mm256_permutevar_ps(rsds, _mm256_setr_epi32(0, 0, 0, 0, 2, 0, 1, 0)),
+            _mm256_setr_ps(0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 1.0f, 1.0f, 0.0f)),
+          c23);
+        c23 = multiplyAdd(
+          _mm256_permutevar_ps(rr, _mm256_setr_epi32(0, 0, 0, 0, 2, 0, 1, 0)),
+          _mm256_mul_ps(
+            _mm256_permutevar_ps(rsds, _mm256_setr_epi32(0, 0, 0, 0, 1, 2, 0, 0)),
+            _mm256_setr_ps(0.0f, 0.0f, 0.0f, 0.0f, -1.0f, -1.0f, -1.0f, 0.0f)),
+          c23);
+
+        _c.c01 = c01;
+        _c.c23 = c23;
+      }
+    };
+  }
+}
+NF_TARGET_END
+
+namespace nfEngineSDK
+{
+  void
+  BatchMath::fillAVX2Kernels(BatchKernels& _kernels)
+  {
+    fillMathKernels<AVX2Pack>(_kernels);
+    fillSkinningKernels<AVX2Skinner>(_kernels);
+  }
+}
+#endif
@@ -0,0 +1,100 @@
+#include "nfBatchMath.h"
+
+#if NF_ARCH_X86
+# include <cstring>
+# include <immintrin.h>
+
+NF_TARGET_BEGIN("avx512f,avx512dq,avx512bw,avx512vl,avx2,fma")
+# include "nfBatchKernels.h"
+
+namespace nfEngineSDK
+{
+  namespace {
+    /*
+     * Sixteen floats on AVX-512, the comparisons give bit masks.
+     */
+    struct AVX512Pack
+    {
+      using Reg = __m512;
+      using IntReg = __m512i;
+      using Mask = __mmask16;
+      static const SIZE_T kLANES = 16;
+
+      static FORCEINLINE Reg load(const float* p) { return _mm512_loadu_ps(p); }
+      static FORCEINLINE void store(float* p, Reg v) { _mm512_storeu_ps(p, v); }
+      static FORCEINLINE Reg
+      loadQuads(const float* p, SIZE_T stride)
+      {
+        Reg v = _mm512_castps128_ps512(_mm_loadu_ps(p));
+        v = _mm512_insertf32x4(v, _mm_loadu_ps(p + stride), 1);
+        v = _mm512_insertf32x4(v, _mm_loadu_ps(p + stride * 2), 2);
+        return _mm512_insertf32x4(v, _mm_loadu_ps(p + stride * 3), 3);
+      }
+      static FORCEINLINE void
+      storeQuads(float* p, SIZE_T stride, Reg v)
+      {
+        _mm_storeu_ps(p, _mm512_castps512_ps128(v));
+        _mm_storeu_ps(p + stride, _mm512_extractf32x4_ps(v, 1));
+        _mm_storeu_ps(p + stride * 2, _mm512_extractf32x4_ps(v, 2));
+        _mm_storeu_ps(p + stride * 3, _mm512_extractf32x4_ps(v, 3));
+      }
+      template<int i0, int i1, int i2, int i3>
+      static FORCEINLINE Reg shuffle(Reg a, Reg b)
+      {
+        return _mm512_shuffle_ps(a, b, _MM_SHUFFLE(i3, i2, i1, i0));
+      }
+      static FORCEINLINE Reg set(float v) { return _mm512_set1_ps(v); }
+      static FORCEINLINE Reg add(Reg a, Reg b) { return _mm512_add_ps(a, b); }
+      static FORCEINLINE Reg sub(Reg a, Reg b) { return _mm512_sub_ps(a, b); }
+      static FORCEINLINE Reg mul(Reg a, Reg b) { return _mm512_mul_ps(a, b); }
+      static FORCEINLINE Reg div(Reg a, Reg b) { return _mm512_div_ps(a, b); }
+      static FORCEINLINE Reg sqrt(Reg a) { return _mm512_sqrt_ps(a); }
+      static FORCEINLINE Reg
+      madd(Reg a, Reg b, Reg c)
+      {
+# if NF_MATH_DETERMINISTIC
+        return _mm512_add_ps(_mm512_mul_ps(a, b), c);
+# else
+        return _mm512_fmadd_ps(a, b, c);
+# endif
+      }
+      static FORCEINLINE IntReg roundToInt(Reg a) { return _mm512_cvtps_epi32(a); }
+      static FORCEINLINE Reg toFloat(IntReg a) { return _mm512_cvtepi32_ps(a); }
+      static FORCEINLINE IntReg setInt(int32 v) { return _mm512_set1_epi32(v); }
+      static FORCEINLINE IntReg addInt(IntReg a, IntReg b) { return _mm512_add_epi32(a, b); }
+      static FORCEINLINE IntReg andInt(IntReg a, IntReg b) { return _mm512_and_si512(a, b); }
+      template<int bits>
+      static FORCEINLINE IntReg shiftLeft(IntReg a) { return _mm512_slli_epi32(a, bits); }
+      static FORCEINLINE Reg
+      xorBits(Reg a, IntReg b)
+      {
+        return _mm512_xor_ps(a, _mm512_castsi512_ps(b));
+      }
+      static FORCEINLINE Mask greater(Reg a, Reg b) { return _mm512_cmp_ps_mask(a, b, _CMP_GT_OQ); }
+      static FORCEINLINE Mask
+      greaterEqual(Reg a, Reg b)
+      {
+        return _mm512_cmp_ps_mask(a, b, _CMP_GE_OQ);
+      }
+      static FORCEINLINE Mask equalInt(IntReg a, IntReg b) { return _mm512_cmpeq_epi32_mask(a, b); }
+      static FORCEINLINE Mask andMask(Mask a, Mask b) { return static_cast<Mask>(a & b); }
+      static FORCEINLINE Reg select(Mask m, Reg a, Reg b) { return _mm512_mask_blend_ps(m, b, a); }
+      static FORCEINLINE uint32 maskBits(Mask m) { return static_cast<uint32>(m); }
+    };
+  }
+}
+NF_TARGET_END
+
+namespace nfEngineSDK
+{
+  /*
+   * The skinning keeps the AVX2 kernels, a 3x4 matrix already fills two
+   * 256 bits registers.
+   */
+  void
+  BatchMath::fillAVX512Kernels(BatchKernels& _kernels)
+  {
+    fillMathKernels<AVX512Pack>(_kernels);
+  }
+}
+#endif
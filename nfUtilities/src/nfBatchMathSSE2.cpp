@@ -0,0 +1,20 @@
+#include "nfBatchMath.h"
+
+#if NF_ARCH_X86
+# include <cstring>
+# include <immintrin.h>
+
+NF_TARGET_BEGIN("sse2")
+# include "nfBatchKernels.h"
+NF_TARGET_END
+
+namespace nfEngineSDK
+{
+  void
+  BatchMath::fillSSE2Kernels(BatchKernels& _kernels)
+  {
+    fillMathKernels<SSEPack<false>>(_kernels);
+    fillSkinningKernels<SSESkinner<false>>(_kernels);
+  }
+}
+#endif
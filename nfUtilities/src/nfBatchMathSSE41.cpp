@@ -0,0 +1,20 @@
+#include "nfBatchMath.h"
+
+#if NF_ARCH_X86
+# include <cstring>
+# include <immintrin.h>
+
+NF_TARGET_BEGIN("sse4.1")
+# include "nfBatchKernels.h"
+NF_TARGET_END
+
+namespace nfEngineSDK
+{
+  void
+  BatchMath::fillSSE4_1Kernels(BatchKernels& _kernels)
+  {
+    fillMathKernels<SSEPack<true>>(_kernels);
+    fillSkinningKernels<SSESkinner<true>>(_kernels);
+  }
+}
+#endif
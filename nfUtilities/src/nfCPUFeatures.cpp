@@ -0,0 +1,215 @@
+#include "nfCPUFeatures.h"
+
+#include <cctype>
+#include <cstdlib>
+
+#if NF_ARCH_X86
+# if NF_COMPILER == NF_COMPILER_MSVC
+#   include <intrin.h>
+# else
+#   include <cpuid.h>
+# endif
+#endif
+
+namespace nfEngineSDK
+{
+  namespace {
+    struct Features
+    {
+      CPU_TIER::E supported;
+      CPU_TIER::E tier;
+      bool invariantTSC;
+      bool f16c;
+    };
+
+    const char* const kTIER_NAMES[CPU_TIER::kCOUNT] = {
+      "scalar", "sse2", "sse4.1", "avx2", "avx512"
+    };
+
+#if NF_ARCH_X86
+    /*
+     * The registers of a cpuid leaf, all 0 if the leaf doesn't exist.
+     */
+    struct Registers
+    {
+      uint32 eax = 0;
+      uint32 ebx = 0;
+      uint32 ecx = 0;
+      uint32 edx = 0;
+    };
+
+    Registers
+    cpuid(uint32 _leaf, uint32 _subleaf = 0)
+    {
+      Registers out;
+# if NF_COMPILER == NF_COMPILER_MSVC
+      int registers[4];
+      __cpuid(registers, static_cast<int>(_leaf & 0x80000000u));
+      if (static_cast<uint32>(registers[0]) < _leaf) {
+        return out;
+      }
+      __cpuidex(registers, static_cast<int>(_leaf), static_cast<int>(_subleaf));
+      out.eax = static_cast<uint32>(registers[0]);
+      out.ebx = static_cast<uint32>(registers[1]);
+      out.ecx = static_cast<uint32>(registers[2]);
+      out.edx = static_cast<uint32>(registers[3]);
+# else
+      if (__get_cpuid_max(_leaf & 0x80000000u, nullptr) < _leaf) {
+        return out;
+      }
+      __cpuid_count(_leaf, _subleaf, out.eax, out.ebx, out.ecx, out.edx);
+# endif
+      return out;
+    }
+
+    /*
+     * The register states the operating system saves on a context switch.
+     */
+    uint64
+    xgetbv0()
+    {
+# if NF_COMPILER == NF_COMPILER_MSVC
+      return _xgetbv(0);
+# else
+      uint32 eax, edx;
+      __asm__ volatile("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+      return (static_cast<uint64>(edx) << 32) | eax;
+# endif
+    }
+
+    FORCEINLINE bool
+    hasBit(uint32 _register, uint32 _bit)
+    {
+      return 0 != (_register & (1u << _bit));
+    }
+#endif
+
+#if !NF_CPU_DISPATCH
+    /*
+     * The tier the build enables with the NF_SIMD_* defines.
+     */
+    CPU_TIER::E
+    getBuildTier()
+    {
+#if defined(__AVX512F__) && defined(__AVX512DQ__) && \
+    defined(__AVX512BW__) && defined(__AVX512VL__)
+      return CPU_TIER::kAVX512;
+#elif NF_SIMD_AVX2 && NF_SIMD_FMA
+      return CPU_TIER::kAVX2;
+#elif NF_SIMD_SSE4_1
+      return CPU_TIER::kSSE4_1;
+#elif NF_SIMD_SSE2
+      return CPU_TIER::kSSE2;
+#else
+      return CPU_TIER::kSCALAR;
+#endif
+    }
+#endif
+
+    Features
+    detect()
+    {
+      Features features{ CPU_TIER::kSCALAR, CPU_TIER::kSCALAR, false, false };
+#if NF_ARCH_X86
+      Registers leaf1 = cpuid(1);
+      Registers leaf7 = cpuid(7);
+      bool osxsave = hasBit(leaf1.ecx, 27);
+      uint64 xcr0 = osxsave ? xgetbv0() : 0;
+      /* SSE and AVX state, plus the opmask and the upper ZMM registers. */
+      bool avxState = 0x6 == (xcr0 & 0x6);
+      bool avx512State = 0xE6 == (xcr0 & 0xE6);
+
+      bool sse2 = hasBit(leaf1.edx, 26);
+      bool sse41 = sse2 && hasBit(leaf1.ecx, 19);
+      bool avx2 = sse41 && avxState &&
+                  hasBit(leaf1.ecx, 28) &&
+                  hasBit(leaf1.ecx, 12) &&
+                  hasBit(leaf7.ebx, 5);
+      bool avx512 = avx2 && avx512State &&
+                    hasBit(leaf7.ebx, 16) &&
+                    hasBit(leaf7.ebx, 17) &&
+                    hasBit(leaf7.ebx, 30) &&
+                    hasBit(leaf7.ebx, 31);
+
+      features.supported = avx512 ? CPU_TIER::kAVX512 :
+                           avx2 ? CPU_TIER::kAVX2 :
+                           sse41 ? CPU_TIER::kSSE4_1 :
+                           sse2 ? CPU_TIER::kSSE2 : CPU_TIER::kSCALAR;
+      features.f16c = avxState && hasBit(leaf1.ecx, 29);
+      features.invariantTSC = hasBit(cpuid(0x80000007u).edx, 8);
+#endif
+#if !NF_CPU_DISPATCH
+      CPU_TIER::E build = getBuildTier();
+      features.supported = build < features.supported ? build : features.supported;
+#endif
+
+      features.tier = features.supported;
+      CPU_TIER::E requested;
+      const char* variable = std::getenv(CPUFeatures::kTIER_VARIABLE);
+      if (nullptr != variable && CPUFeatures::parseTier(variable, requested)) {
+        features.tier = requested < features.supported ? requested : features.supported;
+      }
+      return features;
+    }
+
+    /*
+     * Read on the first use, the static is thread safe.
+     */
+    const Features&
+    getFeatures()
+    {
+      static const Features features = detect();
+      return features;
+    }
+  }
+
+  const char* const CPUFeatures::kTIER_VARIABLE = "NF_CPU_TIER";
+
+  CPU_TIER::E
+  CPUFeatures::getSupportedTier()
+  {
+    return getFeatures().supported;
+  }
+
+  CPU_TIER::E
+  CPUFeatures::getTier()
+  {
+    return getFeatures().tier;
+  }
+
+  const char*
+  CPUFeatures::getTierName(CPU_TIER::E _tier)
+  {
+    return _tier < CPU_TIER::kCOUNT ? kTIER_NAMES[_tier] : "unknown";
+  }
+
+  bool
+  CPUFeatures::parseTier(const char* _name, CPU_TIER::E& _tier)
+  {
+    for (uint32 tier = 0; tier < CPU_TIER::kCOUNT; ++tier) {
+      const char* name = kTIER_NAMES[tier];
+      SIZE_T i = 0;
+      while ('\0' != name[i] &&
+             std::tolower(static_cast<unsigned char>(_name[i])) == name[i]) {
+        ++i;
+      }
+      if ('\0' == name[i] && '\0' == _name[i]) {
+        _tier = static_cast<CPU_TIER::E>(tier);
+        return true;
+      }
+    }
+    return false;
+  }
+
+  bool
+  CPUFeatures::hasInvariantTSC()
+  {
+    return getFeatures().invariantTSC;
+  }
+
+  bool
+  CPUFeatures::hasF16C()
+  {
+    return getFeatures().f16c;
+  }
+}
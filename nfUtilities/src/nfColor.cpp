@@ -0,0 +1,459 @@
+#include "nfColor.h"
+
+#include <cmath>
+#include <cstring>
+
+#include "nfFastMathPack.h"
+
+namespace nfEngineSDK
+{
+  namespace {
+    static_assert(sizeof(Color) == sizeof(float) * 4, "Color must be 4 floats");
+    static_assert(sizeof(ColorI) == sizeof(uint32), "ColorI must be 4 bytes");
+
+    /*
+     * Where the sRGB curve changes from the line to the power, on both sides.
+     */
+    const float kSRGB_LIMIT = 0.04045f;
+    const float kLINEAR_LIMIT = 0.0031308f;
+    /*
+     * The number of floats the array versions convert on the stack at once.
+     */
+    const SIZE_T kCHUNK = 256;
+
+    /*
+     * Clamps to [0, 1], NaN gives 0.
+     */
+    FORCEINLINE float
+    saturate(float _value)
+    {
+      return _value > 0.0f ? (_value < 1.0f ? _value : 1.0f) : 0.0f;
+    }
+
+    FORCEINLINE uint32
+    quantize(float _value, float _max)
+    {
+      return static_cast<uint32>(saturate(_value) * _max + 0.5f);
+    }
+
+    FORCEINLINE uint32
+    toBits(float _value)
+    {
+      uint32 bits;
+      std::memcpy(&bits, &_value, sizeof(bits));
+      return bits;
+    }
+
+    FORCEINLINE float
+    fromBits(uint32 _bits)
+    {
+      float value;
+      std::memcpy(&value, &_bits, sizeof(value));
+      return value;
+    }
+
+    /*
+     * The linear value of every 8 bits sRGB value, in double precision so
+     * the table is exact to the last bit.
+     */
+    const float*
+    getSrgbTable()
+    {
+      struct Table
+      {
+        Table()
+        {
+          for (uint32 i = 0; i < 256; ++i) {
+            double s = i / 255.0;
+            values[i] = static_cast<float>(s <= kSRGB_LIMIT ?
+                                           s / 12.92 :
+                                           std::pow((s + 0.055) / 1.055, 2.4));
+          }
+        }
+
+        float values[256];
+      };
+      static const Table table;
+      return table.values;
+    }
+
+    /*
+     * An unsigned float with 5 bits of exponent, the same bias as a half
+     * float, and _mantissaBits of mantissa. Rounds to nearest even and
+     * saturates to the biggest finite value.
+     */
+    FORCEINLINE uint32
+    packUnsignedFloat(float _value, uint32 _mantissaBits)
+    {
+      const float kMIN_NORMAL = 1.0f / 16384.0f;
+      float maxValue = (2.0f - fromBits((127u - _mantissaBits) << 23)) * 32768.0f;
+      float x = _value > 0.0f ? (_value < maxValue ? _value : maxValue) : 0.0f;
+      if (x < kMIN_NORMAL) {
+        /* Denormal, 1 << _mantissaBits is already the smallest normal. */
+        float scale = fromBits((127u + 14u + _mantissaBits) << 23);
+        return static_cast<uint32>(x * scale + 0.5f);
+      }
+      uint32 drop = 23u - _mantissaBits;
+      uint32 bits = toBits(x);
+      bits += (1u << (drop - 1)) - 1u + ((bits >> drop) & 1u);
+      return (bits >> drop) - ((127u - 15u) << _mantissaBits);
+    }
+
+    FORCEINLINE float
+    unpackUnsignedFloat(uint32 _packed, uint32 _mantissaBits)
+    {
+      uint32 exponent = _packed >> _mantissaBits;
+      uint32 mantissa = _packed & ((1u << _mantissaBits) - 1u);
+      if (0 == exponent) {
+        return mantissa * fromBits((127u - 14u - _mantissaBits) << 23);
+      }
+      if (31 == exponent) {
+        return fromBits(0 == mantissa ? 0x7F800000u : 0x7FC00000u);
+      }
+      return fromBits(((exponent + 127u - 15u) << 23) | (mantissa << (23u - _mantissaBits)));
+    }
+
+    FORCEINLINE uint32
+    packRGBA8(const Color& _color)
+    {
+      return quantize(_color.r, 255.0f) |
+             (quantize(_color.g, 255.0f) << 8) |
+             (quantize(_color.b, 255.0f) << 16) |
+             (quantize(_color.a, 255.0f) << 24);
+    }
+
+    FORCEINLINE Color
+    unpackRGBA8(uint32 _packed)
+    {
+      return ColorI::fromRGBA8(_packed).toColor();
+    }
+
+    FORCEINLINE uint32
+    packRGB10A2(const Color& _color)
+    {
+      return quantize(_color.r, 1023.0f) |
+             (quantize(_color.g, 1023.0f) << 10) |
+             (quantize(_color.b, 1023.0f) << 20) |
+             (quantize(_color.a, 3.0f) << 30);
+    }
+
+    FORCEINLINE Color
+    unpackRGB10A2(uint32 _packed)
+    {
+      const float kINV_1023 = 1.0f / 1023.0f;
+      return Color((_packed & 0x3FFu) * kINV_1023,
+                   ((_packed >> 10) & 0x3FFu) * kINV_1023,
+                   ((_packed >> 20) & 0x3FFu) * kINV_1023,
+                   (_packed >> 30) * (1.0f / 3.0f));
+    }
+
+    FORCEINLINE uint32
+    packRGBE(const Color& _color)
+    {
+      float r = _color.r > 0.0f ? _color.r : 0.0f;
+      float g = _color.g > 0.0f ? _color.g : 0.0f;
+      float b = _color.b > 0.0f ? _color.b : 0.0f;
+      float maxChannel = r > g ? (r > b ? r : b) : (g > b ? g : b);
+      if (!(maxChannel > 1e-32f)) {
+        return 0;
+      }
+      /* frexp(inf) would make the scale NaN, saturated like a big exponent. */
+      if (!std::isfinite(maxChannel)) {
+        return 0xFFFFFFFFu;
+      }
+      int exponent;
+      float scale = std::frexp(maxChannel, &exponent) * 256.0f / maxChannel;
+      if (exponent > 127) {
+        return 0xFFFFFFFFu;
+      }
+      uint32 mr = static_cast<uint32>(r * scale + 0.5f);
+      uint32 mg = static_cast<uint32>(g * scale + 0.5f);
+      uint32 mb = static_cast<uint32>(b * scale + 0.5f);
+      mr = mr < 255u ? mr : 255u;
+      mg = mg < 255u ? mg : 255u;
+      mb = mb < 255u ? mb : 255u;
+      return mr | (mg << 8) | (mb << 16) | (static_cast<uint32>(exponent + 128) << 24);
+    }
+
+    FORCEINLINE Color
+    unpackRGBE(uint32 _packed)
+    {
+      uint32 exponent = _packed >> 24;
+      if (0 == exponent) {
+        return Color(0.0f, 0.0f, 0.0f, 1.0f);
+      }
+      float scale = std::ldexp(1.0f, static_cast<int>(exponent) - (128 + 8));
+      return Color((_packed & 0xFFu) * scale,
+                   ((_packed >> 8) & 0xFFu) * scale,
+                   ((_packed >> 16) & 0xFFu) * scale,
+                   1.0f);
+    }
+
+    FORCEINLINE uint32
+    packR11G11B10(const Color& _color)
+    {
+      return packUnsignedFloat(_color.r, 6) |
+             (packUnsignedFloat(_color.g, 6) << 11) |
+             (packUnsignedFloat(_color.b, 5) << 22);
+    }
+
+    FORCEINLINE Color
+    unpackR11G11B10(uint32 _packed)
+    {
+      return Color(unpackUnsignedFloat(_packed & 0x7FFu, 6),
+                   unpackUnsignedFloat((_packed >> 11) & 0x7FFu, 6),
+                   unpackUnsignedFloat(_packed >> 22, 5),
+                   1.0f);
+    }
+
+#if NF_FASTMATH_SIMD
+    /*
+     * The sRGB curves lane by lane. The input of the power is kept over the
+     * limit of the line to stay in the range of log2, the select takes the
+     * line for those lanes.
+     */
+    FORCEINLINE P::Reg
+    srgbToLinearPack(P::Reg _value, P::Reg _zero, P::Reg _one, P::Reg _limit)
+    {
+      P::Reg x = P::min(P::max(_value, _zero), _one);
+      P::Reg base = P::mul(P::add(P::max(x, _limit), P::set(0.055f)),
+                           P::set(1.0f / 1.055f));
+      P::Reg power = exp2Pack(P::mul(P::set(2.4f), log2Pack(base)));
+      return P::select(P::lessEqual(x, _limit),
+                       P::mul(x, P::set(1.0f / 12.92f)),
+                       power);
+    }
+
+    FORCEINLINE P::Reg
+    linearToSrgbPack(P::Reg _value, P::Reg _zero, P::Reg _one, P::Reg _limit)
+    {
+      P::Reg x = P::min(P::max(_value, _zero), _one);
+      P::Reg power = exp2Pack(P::mul(P::set(1.0f / 2.4f), log2Pack(P::max(x, _limit))));
+      return P::select(P::lessEqual(x, _limit),
+                       P::mul(x, P::set(12.92f)),
+                       P::sub(P::mul(P::set(1.055f), power), P::set(0.055f)));
+    }
+#endif
+
+    /*
+     * The loops of the array versions, with the format out of the loop.
+     */
+    template<uint32 (*packer)(const Color&)>
+    void
+    packArray(const Color* _in, uint32* _out, SIZE_T _count)
+    {
+      for (SIZE_T i = 0; i < _count; ++i) {
+        _out[i] = packer(_in[i]);
+      }
+    }
+
+    template<Color (*unpacker)(uint32)>
+    void
+    unpackArray(const uint32* _in, Color* _out, SIZE_T _count)
+    {
+      for (SIZE_T i = 0; i < _count; ++i) {
+        _out[i] = unpacker(_in[i]);
+      }
+    }
+  }
+
+  const Color Color::kBLACK = Color(0.0f, 0.0f, 0.0f, 1.0f);
+  const Color Color::kWHITE = Color(1.0f, 1.0f, 1.0f, 1.0f);
+  const Color Color::kTRANSPARENT = Color(0.0f, 0.0f, 0.0f, 0.0f);
+
+  const ColorI ColorI::kBLACK = ColorI(0, 0, 0, 255);
+  const ColorI ColorI::kWHITE = ColorI(255, 255, 255, 255);
+  const ColorI ColorI::kTRANSPARENT = ColorI(0, 0, 0, 0);
+
+  float
+  Color::srgbToLinear(float _value)
+  {
+    float x = saturate(_value);
+    if (x <= kSRGB_LIMIT) {
+      return x * (1.0f / 12.92f);
+    }
+    return FastMath::pow((x + 0.055f) * (1.0f / 1.055f), 2.4f);
+  }
+
+  float
+  Color::linearToSrgb(float _value)
+  {
+    float x = saturate(_value);
+    if (x <= kLINEAR_LIMIT) {
+      return x * 12.92f;
+    }
+    return 1.055f * FastMath::pow(x, 1.0f / 2.4f) - 0.055f;
+  }
+
+  uint32
+  Color::pack(COLOR_FORMAT::E _format) const
+  {
+    switch (_format) {
+    case COLOR_FORMAT::kRGBA8:
+      return packRGBA8(*this);
+    case COLOR_FORMAT::kRGB10A2:
+      return packRGB10A2(*this);
+    case COLOR_FORMAT::kRGBE:
+      return packRGBE(*this);
+    case COLOR_FORMAT::kR11G11B10:
+      return packR11G11B10(*this);
+    default:
+      return 0;
+    }
+  }
+
+  Color
+  Color::unpack(uint32 _packed, COLOR_FORMAT::E _format)
+  {
+    switch (_format) {
+    case COLOR_FORMAT::kRGBA8:
+      return unpackRGBA8(_packed);
+    case COLOR_FORMAT::kRGB10A2:
+      return unpackRGB10A2(_packed);
+    case COLOR_FORMAT::kRGBE:
+      return unpackRGBE(_packed);
+    case COLOR_FORMAT::kR11G11B10:
+      return unpackR11G11B10(_packed);
+    default:
+      return kTRANSPARENT;
+    }
+  }
+
+  void
+  Color::srgbToLinear(const float* _in, float* _out, SIZE_T _count)
+  {
+    SIZE_T i = 0;
+#if NF_FASTMATH_SIMD
+    P::Reg zero = P::set(0.0f);
+    P::Reg one = P::set(1.0f);
+    P::Reg limit = P::set(kSRGB_LIMIT);
+    for (; i + P::kLANES <= _count; i += P::kLANES) {
+      P::store(_out + i, srgbToLinearPack(P::load(_in + i), zero, one, limit));
+    }
+#endif
+    for (; i < _count; ++i) {
+      _out[i] = srgbToLinear(_in[i]);
+    }
+  }
+
+  void
+  Color::linearToSrgb(const float* _in, float* _out, SIZE_T _count)
+  {
+    SIZE_T i = 0;
+#if NF_FASTMATH_SIMD
+    P::Reg zero = P::set(0.0f);
+    P::Reg one = P::set(1.0f);
+    P::Reg limit = P::set(kLINEAR_LIMIT);
+    for (; i + P::kLANES <= _count; i += P::kLANES) {
+      P::store(_out + i, linearToSrgbPack(P::load(_in + i), zero, one, limit));
+    }
+#endif
+    for (; i < _count; ++i) {
+      _out[i] = linearToSrgb(_in[i]);
+    }
+  }
+
+  void
+  Color::srgbToLinear(const ColorI* _in, Color* _out, SIZE_T _count)
+  {
+    const float* table = getSrgbTable();
+    for (SIZE_T i = 0; i < _count; ++i) {
+      ColorI c = _in[i];
+      _out[i] = Color(table[c.r], table[c.g], table[c.b], c.a * (1.0f / 255.0f));
+    }
+  }
+
+  /*
+   * The colors are converted as floats by chunks, alpha goes through the
+   * curve too and is taken from the input afterwards, it costs less than
+   * splitting the channels.
+   */
+  void
+  Color::linearToSrgb(const Color* _in, ColorI* _out, SIZE_T _count)
+  {
+    const SIZE_T kCOLORS = kCHUNK / 4;
+    float channels[kCHUNK];
+    for (SIZE_T start = 0; start < _count; start += kCOLORS) {
+      SIZE_T size = _count - start < kCOLORS ? _count - start : kCOLORS;
+      std::memcpy(channels, _in + start, size * sizeof(Color));
+      linearToSrgb(channels, channels, size * 4);
+      for (SIZE_T i = 0; i < size; ++i) {
+        const float* c = channels + i * 4;
+        _out[start + i] = ColorI(static_cast<uint8>(quantize(c[0], 255.0f)),
+                                 static_cast<uint8>(quantize(c[1], 255.0f)),
+                                 static_cast<uint8>(quantize(c[2], 255.0f)),
+                                 static_cast<uint8>(quantize(_in[start + i].a, 255.0f)));
+      }
+    }
+  }
+
+  void
+  Color::premultiply(Color* _colors, SIZE_T _count)
+  {
+    for (SIZE_T i = 0; i < _count; ++i) {
+      float alpha = _colors[i].a;
+      _colors[i].r *= alpha;
+      _colors[i].g *= alpha;
+      _colors[i].b *= alpha;
+    }
+  }
+
+  void
+  Color::pack(const Color* _in, uint32* _out, SIZE_T _count, COLOR_FORMAT::E _format)
+  {
+    switch (_format) {
+    case COLOR_FORMAT::kRGBA8:
+      packArray<packRGBA8>(_in, _out, _count);
+      break;
+    case COLOR_FORMAT::kRGB10A2:
+      packArray<packRGB10A2>(_in, _out, _count);
+      break;
+    case COLOR_FORMAT::kRGBE:
+      packArray<packRGBE>(_in, _out, _count);
+      break;
+    case COLOR_FORMAT::kR11G11B10:
+      packArray<packR11G11B10>(_in, _out, _count);
+      break;
+    default:
+      break;
+    }
+  }
+
+  void
+  Color::unpack(const uint32* _in, Color* _out, SIZE_T _count, COLOR_FORMAT::E _format)
+  {
+    switch (_format) {
+    case COLOR_FORMAT::kRGBA8:
+      unpackArray<unpackRGBA8>(_in, _out, _count);
+      break;
+    case COLOR_FORMAT::kRGB10A2:
+      unpackArray<unpackRGB10A2>(_in, _out, _count);
+      break;
+    case COLOR_FORMAT::kRGBE:
+      unpackArray<unpackRGBE>(_in, _out, _count);
+      break;
+    case COLOR_FORMAT::kR11G11B10:
+      unpackArray<unpackR11G11B10>(_in, _out, _count);
+      break;
+    default:
+      break;
+    }
+  }
+
+  Color
+  ColorI::toLinear() const
+  {
+    const float* table = getSrgbTable();
+    return Color(table[r], table[g], table[b], a * (1.0f / 255.0f));
+  }
+
+  ColorI
+  ColorI::fromLinear(const Color& _color)
+  {
+    Color srgb = _color.toSrgb();
+    return ColorI(static_cast<uint8>(quantize(srgb.r, 255.0f)),
+                  static_cast<uint8>(quantize(srgb.g, 255.0f)),
+                  static_cast<uint8>(quantize(srgb.b, 255.0f)),
+                  static_cast<uint8>(quantize(_color.a, 255.0f)));
+  }
+}
@@ -0,0 +1,270 @@
+#include "nfDLLDynamics.h"
+
+#include "nfLogger.h"
+
+#if NF_PLATFORM == NF_PLATFORM_WIN32
+# ifndef WIN32_LEAN_AND_MEAN
+#   define WIN32_LEAN_AND_MEAN
+# endif
+# ifndef NOMINMAX
+#   define NOMINMAX
+# endif
+# include <windows.h>
+#else
+# include <dlfcn.h>
+#endif
+
+namespace nfEngineSDK
+{
+  namespace {
+    namespace fs = std::filesystem;
+
+    /*
+     * The write time of a file, 0 if it can't be read.
+     */
+    int64
+    getWriteTime(const String& _path)
+    {
+      std::error_code error;
+      fs::file_time_type time = fs::last_write_time(fs::u8path(_path), error);
+      return error ? 0 : static_cast<int64>(time.time_since_epoch().count());
+    }
+
+#if NF_PLATFORM == NF_PLATFORM_WIN32
+    String
+    getSystemError()
+    {
+      DWORD code = GetLastError();
+      char* text = nullptr;
+      DWORD size = FormatMessageA(FORMAT_MESSAGE_ALLOCATE_BUFFER |
+                                  FORMAT_MESSAGE_FROM_SYSTEM |
+                                  FORMAT_MESSAGE_IGNORE_INSERTS,
+                                  nullptr, code, 0, reinterpret_cast<LPSTR>(&text),
+                                  0, nullptr);
+      String message = 0 != size ? String(text, size) : "Error " + std::to_string(code);
+      LocalFree(text);
+      return message;
+    }
+#endif
+  }
+
+  const char* const DLLDynamics::kSAVE_STATE_SYMBOL = "nfPluginSaveState";
+  const char* const DLLDynamics::kLOAD_STATE_SYMBOL = "nfPluginLoadState";
+
+  DLLDynamics::DLLDynamics(const String& _path, bool _shadowCopy)
+    : m_path(_path),
+      m_shadowCopy(_shadowCopy) {}
+
+  DLLDynamics::~DLLDynamics()
+  {
+    unload();
+  }
+
+  void
+  DLLDynamics::setPath(const String& _path, bool _shadowCopy)
+  {
+    unload();
+    m_path = _path;
+    m_shadowCopy = _shadowCopy;
+  }
+
+  bool
+  DLLDynamics::load()
+  {
+    if (isLoaded()) {
+      return true;
+    }
+    if (m_path.empty()) {
+      m_error = "No plugin path set";
+      return false;
+    }
+    return loadLibrary(m_path);
+  }
+
+  void
+  DLLDynamics::unload()
+  {
+    freeLibrary();
+    std::fill(m_symbols.begin(), m_symbols.end(), nullptr);
+  }
+
+  uint32
+  DLLDynamics::getSlot(const String& _name)
+  {
+    load();
+    auto found = m_slots.find(_name);
+    if (m_slots.end() != found) {
+      return found->second;
+    }
+    uint32 slot = static_cast<uint32>(m_symbols.size());
+    m_slots.emplace(_name, slot);
+    m_names.push_back(_name);
+    m_symbols.push_back(findSymbol(_name));
+    return slot;
+  }
+
+  bool
+  DLLDynamics::hasChanged() const
+  {
+    int64 writeTime = getWriteTime(m_path);
+    return 0 != writeTime && writeTime != m_writeTime;
+  }
+
+  bool
+  DLLDynamics::reload()
+  {
+    if (!isLoaded()) {
+      return load();
+    }
+
+    Serializer state;
+    auto saveState = reinterpret_cast<SaveStateFunction>(findSymbol(kSAVE_STATE_SYMBOL));
+    if (nullptr != saveState) {
+      saveState(state);
+    }
+
+    /* The copy of the old build is kept until the new one is loaded. */
+    String oldShadow = m_shadowPath;
+    void* oldHandle = m_handle;
+    m_handle = nullptr;
+    m_shadowPath.clear();
+    /* The messages queued keep pointers to the formats of the library. */
+    Logger::flush();
+#if NF_PLATFORM == NF_PLATFORM_WIN32
+    FreeLibrary(static_cast<HMODULE>(oldHandle));
+#else
+    dlclose(oldHandle);
+#endif
+
+    int64 newWriteTime = getWriteTime(m_path);
+    bool loaded = loadLibrary(m_path);
+    if (!loaded) {
+      String error = m_error;
+      if (!loadLibrary(oldShadow.empty() ? m_path : oldShadow)) {
+        m_error = error + "; the old build couldn't be loaded back: " + m_error;
+        std::fill(m_symbols.begin(), m_symbols.end(), nullptr);
+        if (!oldShadow.empty()) {
+          std::error_code ignored;
+          fs::remove(fs::u8path(oldShadow), ignored);
+        }
+        return false;
+      }
+      m_error = error;
+      /* It is the old copy now, freeLibrary() deletes it. */
+      m_shadowPath = oldShadow;
+      oldShadow.clear();
+      /*
+       * The build that failed is not retried until it is written again,
+       * the write time of the old copy would always differ from it.
+       */
+      m_writeTime = newWriteTime;
+    }
+    if (!oldShadow.empty()) {
+      std::error_code ignored;
+      fs::remove(fs::u8path(oldShadow), ignored);
+    }
+
+    auto loadState = reinterpret_cast<LoadStateFunction>(findSymbol(kLOAD_STATE_SYMBOL));
+    if (nullptr != saveState && nullptr != loadState) {
+      Deserializer restore(state.getBuffer().data(), state.getBuffer().size());
+      loadState(restore);
+    }
+    return loaded;
+  }
+
+  bool
+  DLLDynamics::reloadIfChanged()
+  {
+    return isLoaded() && hasChanged() && reload();
+  }
+
+  bool
+  DLLDynamics::loadLibrary(const String& _file)
+  {
+    String file = _file;
+    int64 writeTime = getWriteTime(_file);
+    if (m_shadowCopy && _file == m_path) {
+      fs::path source = fs::u8path(_file);
+      std::error_code error;
+      fs::path copy = fs::temp_directory_path(error) /
+                      (source.stem().u8string() + "_" +
+                       std::to_string(reinterpret_cast<uintptr_t>(this)) + "_" +
+                       std::to_string(m_copies++) + source.extension().u8string());
+      if (!error) {
+        fs::copy_file(source, copy, fs::copy_options::overwrite_existing, error);
+      }
+      if (error) {
+        m_error = "Couldn't copy " + _file + ": " + error.message();
+        return false;
+      }
+      file = copy.u8string();
+      m_shadowPath = file;
+    }
+
+#if NF_PLATFORM == NF_PLATFORM_WIN32
+    int32 length = MultiByteToWideChar(CP_UTF8, 0, file.c_str(), -1, nullptr, 0);
+    WString wide(length > 0 ? length - 1 : 0, L'\0');
+    if (length > 1) {
+      MultiByteToWideChar(CP_UTF8, 0, file.c_str(), -1, &wide[0], length);
+    }
+    m_handle = LoadLibraryW(wide.c_str());
+    if (nullptr == m_handle) {
+      m_error = getSystemError();
+    }
+#else
+    m_handle = dlopen(file.c_str(), RTLD_NOW | RTLD_LOCAL);
+    if (nullptr == m_handle) {
+      const char* error = dlerror();
+      m_error = nullptr != error ? error : "dlopen failed";
+    }
+#endif
+    if (nullptr == m_handle) {
+      if (!m_shadowPath.empty() && file == m_shadowPath) {
+        std::error_code ignored;
+        fs::remove(fs::u8path(m_shadowPath), ignored);
+        m_shadowPath.clear();
+      }
+      return false;
+    }
+
+    m_writeTime = writeTime;
+    for (SIZE_T i = 0; i < m_names.size(); ++i) {
+      m_symbols[i] = findSymbol(m_names[i]);
+    }
+    m_error.clear();
+    return true;
+  }
+
+  void
+  DLLDynamics::freeLibrary()
+  {
+    if (nullptr != m_handle) {
+      Logger::flush();
+#if NF_PLATFORM == NF_PLATFORM_WIN32
+      FreeLibrary(static_cast<HMODULE>(m_handle));
+#else
+      dlclose(m_handle);
+#endif
+      m_handle = nullptr;
+    }
+    if (!m_shadowPath.empty()) {
+      std::error_code ignored;
+      fs::remove(fs::u8path(m_shadowPath), ignored);
+      m_shadowPath.clear();
+    }
+  }
+
+  void*
+  DLLDynamics::findSymbol(const String& _name) const
+  {
+    if (nullptr == m_handle) {
+      return nullptr;
+    }
+#if NF_PLATFORM == NF_PLATFORM_WIN32
+    return reinterpret_cast<void*>(GetProcAddress(static_cast<HMODULE>(m_handle),
+                                                  _name.c_str()));
+#else
+    return dlsym(m_handle, _name.c_str());
+#endif
+  }
+}
@@ -0,0 +1,716 @@
+#include "nfDeterministicMath.h"
+
+/*
+ * The class can be used directly without NF_MATH_DETERMINISTIC, so this file
+ * never lets the compiler fuse multiplies and adds.
+ */
+#if NF_COMPILER == NF_COMPILER_MSVC
+# pragma fp_contract(off)
+#elif NF_COMPILER == NF_COMPILER_CLANG
+# pragma clang fp contract(off)
+#elif NF_COMPILER == NF_COMPILER_GNUC
+# pragma GCC optimize("fp-contract=off")
+#endif
+
+namespace nfEngineSDK
+{
+  namespace {
+    /*
+     * Pi over 2 split on three parts of 33 bits, so n times every part is
+     * exact while n has 20 bits, and the rest (Cody-Waite reduction). The
+     * rest is needed for the angles close to a multiple of pi/2.
+     */
+    const double kINV_PIO2 = 6.36619772367581382433e-01;
+    const double kPIO2_1 = 1.57079632673412561417e+00;
+    const double kPIO2_2 = 6.07710050630396597660e-11;
+    const double kPIO2_3 = 2.02226624871116645580e-21;
+    const double kPIO2_3T = 8.47842766036889956997e-32;
+
+    const double kPI = 3.14159265358979311600e+00;
+    const double kPI_LO = 1.22464679914735317720e-16;
+    const double kPI_OVER_2 = 1.57079632679489655800e+00;
+    const double kPI_OVER_2_LO = 6.12323399573676603587e-17;
+    const double kPI_OVER_4 = 7.85398163397448278999e-01;
+
+    /*
+     * ln(2) split in two, the high part has its low bits in 0 so k * hi is
+     * exact.
+     */
+    const double kLN2_HI = 6.93147180369123816490e-01;
+    const double kLN2_LO = 1.90821492927058770002e-10;
+    const double kINV_LN2 = 1.44269504088896338700e+00;
+    const double kSQRT_HALF = 7.07106781186547524401e-01;
+
+    /*
+     * Sine on [-pi/4, pi/4].
+     */
+    FORCEINLINE double
+    kernelSin(double x)
+    {
+      const double S1 = -1.66666666666666324348e-01;
+      const double S2 = 8.33333333332248946124e-03;
+      const double S3 = -1.98412698298579493134e-04;
+      const double S4 = 2.75573137070700676789e-06;
+      const double S5 = -2.50507602534068634195e-08;
+      const double S6 = 1.58969099521155010221e-10;
+
+      double z = x * x;
+      double v = z * x;
+      double r = S2 + z * (S3 + z * (S4 + z * (S5 + z * S6)));
+      return x + v * (S1 + z * r);
+    }
+
+    /*
+     * Cosine on [-pi/4, pi/4].
+     */
+    FORCEINLINE double
+    kernelCos(double x)
+    {
+      const double C1 = 4.16666666666666019037e-02;
+      const double C2 = -1.38888888888741095749e-03;
+      const double C3 = 2.48015872894767294178e-05;
+      const double C4 = -2.75573143513906633035e-07;
+      const double C5 = 2.08757232129817482790e-09;
+      const double C6 = -1.13596475577881948265e-11;
+
+      double z = x * x;
+      double r = z * (C1 + z * (C2 + z * (C3 + z * (C4 + z * (C5 + z * C6)))));
+      double hz = 0.5 * z;
+      double w = 1.0 - hz;
+      return w + (((1.0 - w) - hz) + z * r);
+    }
+
+    /*
+     * The exact sum of two doubles: s + e == a + b (Knuth).
+     */
+    FORCEINLINE void
+    twoSum(double a, double b, double& s, double& e)
+    {
+      s = a + b;
+      double bb = s - a;
+      e = (a - (s - bb)) + (b - bb);
+    }
+
+    /*
+     * The exact product of two doubles: p + e == a * b (Dekker). It doesn't
+     * need a fused multiply and add, so it is the same on every CPU; a and b
+     * must be smaller than 2^995.
+     */
+    FORCEINLINE void
+    twoProduct(double a, double b, double& p, double& e)
+    {
+      const double kSPLIT = 134217729.0; /* 2^27 + 1 */
+      double ta = kSPLIT * a;
+      double aHi = ta - (ta - a);
+      double aLo = a - aHi;
+      double tb = kSPLIT * b;
+      double bHi = tb - (tb - b);
+      double bLo = b - bHi;
+      p = a * b;
+      e = (((aHi * bHi - p) + aHi * bLo) + aLo * bHi) + aLo * bLo;
+    }
+
+    /*
+     * Up to this angle the Cody-Waite reduction is used, n < 2^20.
+     */
+    const double kMEDIUM_ANGLE = 1.0e6;
+
+    /*
+     * The bits of 2/pi after the point, after a word of zeros so the angles
+     * smaller than 2^62 can read bits before the point. 1280 bits are enough
+     * for the biggest double.
+     */
+    const uint64 kTWO_OVER_PI[] = {
+      0x0000000000000000ull,
+      0xA2F9836E4E441529ull, 0xFC2757D1F534DDC0ull, 0xDB6295993C439041ull,
+      0xFE5163ABDEBBC561ull, 0xB7246E3A424DD2E0ull, 0x06492EEA09D1921Cull,
+      0xFE1DEB1CB129A73Eull, 0xE88235F52EBB4484ull, 0xE99C7026B45F7E41ull,
+      0x3991D639835339F4ull, 0x9C845F8BBDF9283Bull, 0x1FF897FFDE05980Full,
+      0xEF2F118B5A0A6D1Full, 0x6D367ECF27CB09B7ull, 0x4F463F669E5FEA2Dull,
+      0x7527BAC7EBE5F17Bull, 0x3D0739F78A5292EAull, 0x6BFB5FB11F8D5D08ull,
+      0x56033046FC7B6BABull, 0xF0CFBC209AF4361Dull
+    };
+
+    /*
+     * The 128 bits product of two 64 bits integers.
+     */
+    FORCEINLINE void
+    multiply64(uint64 a, uint64 b, uint64& hi, uint64& lo)
+    {
+      uint64 aLo = a & 0xFFFFFFFFull;
+      uint64 aHi = a >> 32;
+      uint64 bLo = b & 0xFFFFFFFFull;
+      uint64 bHi = b >> 32;
+      uint64 ll = aLo * bLo;
+      uint64 lh = aLo * bHi;
+      uint64 hl = aHi * bLo;
+      uint64 mid = (ll >> 32) + (lh & 0xFFFFFFFFull) + (hl & 0xFFFFFFFFull);
+      lo = (mid << 32) | (ll & 0xFFFFFFFFull);
+      hi = aHi * bHi + (lh >> 32) + (hl >> 32) + (mid >> 32);
+    }
+
+    /*
+     * Payne-Hanek reduction of a positive angle of any size: the angle is a
+     * 53 bits integer m times 2^e, and m times the 192 bits of 2/pi that
+     * start at bit e - 2 gives, exactly with integers, the quadrant on its
+     * 2 high bits and 128 bits of the fraction. The earlier bits of 2/pi
+     * only add multiples of 4 quadrants.
+     */
+    double
+    reduceBigAngle(double x, int32& quadrant)
+    {
+      int32 exponent;
+      double mantissa = std::frexp(x, &exponent);
+      uint64 m = static_cast<uint64>(std::ldexp(mantissa, 53));
+      uint32 position = static_cast<uint32>(exponent - 53 - 2 + 64);
+
+      uint32 word = position / 64;
+      uint32 shift = position % 64;
+      uint64 bits[3];
+      for (uint32 i = 0; i < 3; ++i) {
+        bits[i] = kTWO_OVER_PI[word + i] << shift;
+        if (0 != shift) {
+          bits[i] |= kTWO_OVER_PI[word + i + 1] >> (64 - shift);
+        }
+      }
+
+      uint64 hi0, lo0, hi1, lo1, hi2, lo2;
+      multiply64(m, bits[0], hi0, lo0);
+      multiply64(m, bits[1], hi1, lo1);
+      multiply64(m, bits[2], hi2, lo2);
+      uint64 limb0 = lo2;
+      uint64 limb1 = hi2 + lo1;
+      uint64 limb2 = hi1 + lo0 + (limb1 < lo1 ? 1 : 0);
+
+      uint32 q = static_cast<uint32>(limb2 >> 62);
+      uint64 fractionHi = (limb2 << 2) | (limb1 >> 62);
+      uint64 fractionLo = (limb1 << 2) | (limb0 >> 62);
+      /*
+       * A fraction over 1/2 is the next quadrant minus the rest.
+       */
+      bool negative = 0 != (fractionHi >> 63);
+      if (negative) {
+        ++q;
+        fractionLo = ~fractionLo + 1;
+        fractionHi = ~fractionHi + (0 == fractionLo ? 1 : 0);
+      }
+      quadrant = static_cast<int32>(q & 3);
+      if (0 == fractionHi && 0 == fractionLo) {
+        return 0.0;
+      }
+
+      int32 leadingZeros = 0;
+      while (0 == (fractionHi >> 63)) {
+        fractionHi = (fractionHi << 1) | (fractionLo >> 63);
+        fractionLo <<= 1;
+        ++leadingZeros;
+      }
+      double a = std::ldexp(static_cast<double>(fractionHi >> 11), -53 - leadingZeros);
+      double b = std::ldexp(static_cast<double>(((fractionHi & 0x7FFull) << 42) |
+                                                (fractionLo >> 22)),
+                            -106 - leadingZeros);
+      /*
+       * The fraction times pi/2, with pi/2 and the product in two parts.
+       */
+      double p, e;
+      twoProduct(a, kPI_OVER_2, p, e);
+      double r = p + (e + (a * kPI_OVER_2_LO + b * kPI_OVER_2));
+      return negative ? -r : r;
+    }
+
+    /*
+     * Reduces the angle to [-pi/4, pi/4], and gives in which quarter of the
+     * circle it was.
+     */
+    FORCEINLINE double
+    reduceAngle(double x, int32& quadrant)
+    {
+      if (std::fabs(x) < kMEDIUM_ANGLE) {
+        double n = std::floor(x * kINV_PIO2 + 0.5);
+        quadrant = static_cast<int32>(static_cast<int64>(n) & 3);
+        return (((x - n * kPIO2_1) - n * kPIO2_2) - n * kPIO2_3) - n * kPIO2_3T;
+      }
+      double r = reduceBigAngle(std::fabs(x), quadrant);
+      if (x < 0.0) {
+        quadrant = (4 - quadrant) & 3;
+        r = -r;
+      }
+      return r;
+    }
+
+    /*
+     * True if the angle can't be reduced, infinite or NaN.
+     */
+    FORCEINLINE bool
+    isAngleInvalid(double x)
+    {
+      return !(std::fabs(x) <= std::numeric_limits<double>::max());
+    }
+
+    /*
+     * log(x) for a finite positive x as hi + lo, with about 15 bits more
+     * than a double, for pow:
+     *   log(1 + f) = 2s + 2/3 s^3 + s^5 * T(s^2), s = f / (2 + f)
+     * The first two terms are kept in two parts, T is the Taylor series
+     * 2/5 + 2/7 s^2 + 2/9 s^4 ..., that for |s| < 0.172 converges enough
+     * with 12 terms.
+     */
+    void
+    logExtended(double x, double& hi, double& lo)
+    {
+      const double kTWO_THIRDS = 6.66666666666666629659e-01;
+      const double kTWO_THIRDS_LO = 3.70074341541718826e-17;
+
+      int32 k;
+      double m = std::frexp(x, &k);
+      if (m < kSQRT_HALF) {
+        m *= 2.0;
+        --k;
+      }
+      double f = m - 1.0;
+      double d = 2.0 + f;
+      double dLo = f - (d - 2.0);
+      double s = f / d;
+      double p, e;
+      twoProduct(s, d, p, e);
+      double sLo = (((f - p) - e) - s * dLo) / d;
+
+      double z, zLo;
+      twoProduct(s, s, z, zLo);
+      double cube, cubeLo;
+      twoProduct(z, s, cube, cubeLo);
+      cubeLo += zLo * s + 3.0 * z * sLo;
+      double third, thirdLo;
+      twoProduct(cube, kTWO_THIRDS, third, thirdLo);
+      thirdLo += cubeLo * kTWO_THIRDS + cube * kTWO_THIRDS_LO;
+
+      double T = 2.0 / 27.0;
+      for (int32 n = 25; n >= 5; n -= 2) {
+        T = 2.0 / static_cast<double>(n) + z * T;
+      }
+      double rest = cube * z * T;
+
+      double sum, error;
+      twoSum(2.0 * s, third, sum, error);
+      error += (2.0 * sLo + thirdLo) + rest;
+
+      double dk = static_cast<double>(k);
+      double total, totalError;
+      twoSum(dk * kLN2_HI, sum, total, totalError);
+      totalError += error + dk * kLN2_LO;
+      hi = total + totalError;
+      lo = totalError - (hi - total);
+    }
+  }
+
+  double
+  DeterministicMath::sin(double _radian)
+  {
+    if (isAngleInvalid(_radian)) {
+      return _radian - _radian;
+    }
+    int32 quadrant;
+    double r = reduceAngle(_radian, quadrant);
+    switch (quadrant) {
+     case 0: return kernelSin(r);
+     case 1: return kernelCos(r);
+     case 2: return -kernelSin(r);
+     default: return -kernelCos(r);
+    }
+  }
+  float
+  DeterministicMath::sin(float _radian)
+  {
+    return static_cast<float>(sin(static_cast<double>(_radian)));
+  }
+
+  double
+  DeterministicMath::cos(double _radian)
+  {
+    if (isAngleInvalid(_radian)) {
+      return _radian - _radian;
+    }
+    int32 quadrant;
+    double r = reduceAngle(_radian, quadrant);
+    switch (quadrant) {
+     case 0: return kernelCos(r);
+     case 1: return -kernelSin(r);
+     case 2: return -kernelCos(r);
+     default: return kernelSin(r);
+    }
+  }
+  float
+  DeterministicMath::cos(float _radian)
+  {
+    return static_cast<float>(cos(static_cast<double>(_radian)));
+  }
+
+  double
+  DeterministicMath::tan(double _radian)
+  {
+    if (isAngleInvalid(_radian)) {
+      return _radian - _radian;
+    }
+    int32 quadrant;
+    double r = reduceAngle(_radian, quadrant);
+    double s = kernelSin(r);
+    double c = kernelCos(r);
+    return (quadrant & 1) ? -c / s : s / c;
+  }
+  float
+  DeterministicMath::tan(float _radian)
+  {
+    return static_cast<float>(tan(static_cast<double>(_radian)));
+  }
+
+  double
+  DeterministicMath::atan(double _value)
+  {
+    static const double atanHi[] = {
+      4.63647609000806093515e-01, /* atan(0.5) */
+      7.85398163397448278999e-01, /* atan(1.0) */
+      9.82793723247329054082e-01, /* atan(1.5) */
+      1.57079632679489655800e+00  /* atan(inf) */
+    };
+    static const double atanLo[] = {
+      2.26987774529616870924e-17,
+      3.06161699786838301793e-17,
+      1.39033110312309984516e-17,
+      6.12323399573676603587e-17
+    };
+    static const double aT[] = {
+      3.33333333333329318027e-01,
+      -1.99999999998764832476e-01,
+      1.42857142725034663711e-01,
+      -1.11111104054623557880e-01,
+      9.09088713343650656196e-02,
+      -7.69187620504482999495e-02,
+      6.66107313738753120669e-02,
+      -5.83357013379057348645e-02,
+      4.97687799461593236017e-02,
+      -3.65315727442169155270e-02,
+      1.62858201153657823623e-02
+    };
+
+    if (_value != _value) {
+      return _value;
+    }
+    double x = std::fabs(_value);
+    if (x >= 7.378697629483821e19) { /* 2^66 */
+      return std::copysign(atanHi[3] + atanLo[3], _value);
+    }
+    if (x < 3.725290298461914e-09) { /* 2^-28 */
+      return _value;
+    }
+
+    int32 id;
+    if (x < 0.4375) {
+      id = -1;
+    }
+    else if (x < 0.6875) {
+      id = 0;
+      x = (2.0 * x - 1.0) / (2.0 + x);
+    }
+    else if (x < 1.1875) {
+      id = 1;
+      x = (x - 1.0) / (x + 1.0);
+    }
+    else if (x < 2.4375) {
+      id = 2;
+      x = (x - 1.5) / (1.0 + 1.5 * x);
+    }
+    else {
+      id = 3;
+      x = -1.0 / x;
+    }
+
+    double z = x * x;
+    double w = z * z;
+    double s1 = z * (aT[0] + w * (aT[2] + w * (aT[4] + w * (aT[6] + w *
+                    (aT[8] + w * aT[10])))));
+    double s2 = w * (aT[1] + w * (aT[3] + w * (aT[5] + w * (aT[7] + w * aT[9]))));
+    if (id < 0) {
+      return std::copysign(x - x * (s1 + s2), _value);
+    }
+    z = atanHi[id] - ((x * (s1 + s2) - atanLo[id]) - x);
+    return std::copysign(z, _value);
+  }
+  float
+  DeterministicMath::atan(float _value)
+  {
+    return static_cast<float>(atan(static_cast<double>(_value)));
+  }
+
+  double
+  DeterministicMath::atan2(double Y, double X)
+  {
+    if (X != X || Y != Y) {
+      return X + Y;
+    }
+    if (std::isinf(X)) {
+      if (std::isinf(Y)) {
+        return std::copysign(X > 0.0 ? kPI_OVER_4 : 3.0 * kPI_OVER_4, Y);
+      }
+      return std::copysign(X > 0.0 ? 0.0 : kPI, Y);
+    }
+    if (std::isinf(Y) || X == 0.0) {
+      if (Y == 0.0) {
+        return std::copysign(std::signbit(X) ? kPI : 0.0, Y);
+      }
+      return std::copysign(kPI_OVER_2, Y);
+    }
+    if (Y == 0.0) {
+      return std::copysign(X > 0.0 ? 0.0 : kPI, Y);
+    }
+
+    double z = atan(std::fabs(Y / X));
+    if (X < 0.0) {
+      z = kPI - (z - kPI_LO);
+    }
+    return std::copysign(z, Y);
+  }
+  float
+  DeterministicMath::atan2(float Y, float X)
+  {
+    return static_cast<float>(atan2(static_cast<double>(Y),
+                                    static_cast<double>(X)));
+  }
+
+  double
+  DeterministicMath::asin(double _value)
+  {
+    if (!(std::fabs(_value) <= 1.0)) {
+      return (_value - _value) / (_value - _value);
+    }
+    return atan2(_value, std::sqrt((1.0 - _value) * (1.0 + _value)));
+  }
+  float
+  DeterministicMath::asin(float _value)
+  {
+    return static_cast<float>(asin(static_cast<double>(_value)));
+  }
+
+  double
+  DeterministicMath::acos(double _value)
+  {
+    if (!(std::fabs(_value) <= 1.0)) {
+      return (_value - _value) / (_value - _value);
+    }
+    return atan2(std::sqrt((1.0 - _value) * (1.0 + _value)), _value);
+  }
+  float
+  DeterministicMath::acos(float _value)
+  {
+    return static_cast<float>(acos(static_cast<double>(_value)));
+  }
+
+  double
+  DeterministicMath::exp(double _value)
+  {
+    const double P1 = 1.66666666666666019037e-01;
+    const double P2 = -2.77777777770155933842e-03;
+    const double P3 = 6.61375632143793436117e-05;
+    const double P4 = -1.65339022054652515390e-06;
+    const double P5 = 4.13813679705723846039e-08;
+
+    if (_value != _value) {
+      return _value;
+    }
+    if (_value > 7.09782712893383973096e+02) {
+      return std::numeric_limits<double>::infinity();
+    }
+    if (_value < -7.45133219101941108420e+02) {
+      return 0.0;
+    }
+
+    /*
+     * value = k * ln(2) + r, |r| <= ln(2) / 2, and exp(value) = 2^k * exp(r).
+     */
+    double k = std::floor(_value * kINV_LN2 + 0.5);
+    double hi = _value - k * kLN2_HI;
+    double lo = k * kLN2_LO;
+    double r = hi - lo;
+    double t = r * r;
+    double c = r - t * (P1 + t * (P2 + t * (P3 + t * (P4 + t * P5))));
+    double y = 1.0 - ((lo - (r * c) / (2.0 - c)) - hi);
+    return std::ldexp(y, static_cast<int32>(k));
+  }
+  float
+  DeterministicMath::exp(float _value)
+  {
+    return static_cast<float>(exp(static_cast<double>(_value)));
+  }
+
+  double
+  DeterministicMath::exp2(double _value)
+  {
+    if (_value != _value) {
+      return _value;
+    }
+    if (_value >= 1024.0) {
+      return std::numeric_limits<double>::infinity();
+    }
+    if (_value < -1075.0) {
+      return 0.0;
+    }
+    /*
+     * The integer part goes to the exponent, only the fraction goes to exp.
+     */
+    double k = std::floor(_value + 0.5);
+    double f = _value - k;
+    return std::ldexp(exp(f * kLN2_HI + f * kLN2_LO), static_cast<int32>(k));
+  }
+  float
+  DeterministicMath::exp2(float _value)
+  {
+    return static_cast<float>(exp2(static_cast<double>(_value)));
+  }
+
+  double
+  DeterministicMath::log(double _value)
+  {
+    const double Lg1 = 6.666666666666735130e-01;
+    const double Lg2 = 3.999999999940941908e-01;
+    const double Lg3 = 2.857142874366239149e-01;
+    const double Lg4 = 2.222219843214978396e-01;
+    const double Lg5 = 1.818357216161805012e-01;
+    const double Lg6 = 1.531383769920937332e-01;
+    const double Lg7 = 1.479819860511658591e-01;
+
+    if (_value != _value) {
+      return _value;
+    }
+    if (_value < 0.0) {
+      return std::numeric_limits<double>::quiet_NaN();
+    }
+    if (_value == 0.0) {
+      return -std::numeric_limits<double>::infinity();
+    }
+    if (std::isinf(_value)) {
+      return _value;
+    }
+
+    /*
+     * value = 2^k * (1 + f), sqrt(2)/2 <= 1 + f < sqrt(2).
+     */
+    int32 k;
+    double m = std::frexp(_value, &k);
+    if (m < kSQRT_HALF) {
+      m *= 2.0;
+      --k;
+    }
+    double f = m - 1.0;
+    double dk = static_cast<double>(k);
+
+    double s = f / (2.0 + f);
+    double z = s * s;
+    double w = z * z;
+    double t1 = w * (Lg2 + w * (Lg4 + w * Lg6));
+    double t2 = z * (Lg1 + w * (Lg3 + w * (Lg5 + w * Lg7)));
+    double R = t2 + t1;
+    double hfsq = 0.5 * f * f;
+    return dk * kLN2_HI - ((hfsq - (s * (hfsq + R) + dk * kLN2_LO)) - f);
+  }
+  float
+  DeterministicMath::log(float _value)
+  {
+    return static_cast<float>(log(static_cast<double>(_value)));
+  }
+
+  double
+  DeterministicMath::log2(double _value)
+  {
+    if (_value != _value || _value <= 0.0 || std::isinf(_value)) {
+      return log(_value);
+    }
+    /*
+     * The exponent is added exact, only the mantissa goes to log.
+     */
+    int32 k;
+    double m = std::frexp(_value, &k);
+    if (m < kSQRT_HALF) {
+      m *= 2.0;
+      --k;
+    }
+    return static_cast<double>(k) + log(m) * kINV_LN2;
+  }
+  float
+  DeterministicMath::log2(float _value)
+  {
+    return static_cast<float>(log2(static_cast<double>(_value)));
+  }
+
+  /*
+   * The special cases are the ones of C99 Annex F. The rest is
+   * exp(power * log(base)) with the logarithm and the product in two
+   * parts, so the error of the product doesn't grow with the power.
+   */
+  double
+  DeterministicMath::pow(double _base, double _power)
+  {
+    const double kINFINITY = std::numeric_limits<double>::infinity();
+
+    if (_power == 0.0 || _base == 1.0) {
+      return 1.0;
+    }
+    if (_base != _base || _power != _power) {
+      return _base + _power;
+    }
+
+    double absBase = std::fabs(_base);
+    if (std::isinf(_power)) {
+      if (absBase == 1.0) {
+        return 1.0;
+      }
+      return (absBase < 1.0) == (_power < 0.0) ? kINFINITY : 0.0;
+    }
+
+    bool isInteger = std::floor(_power) == _power;
+    bool isOdd = isInteger && std::floor(_power * 0.5) * 2.0 != _power;
+    if (_base == 0.0 || std::isinf(_base)) {
+      double r = (_base == 0.0) == (_power < 0.0) ? kINFINITY : 0.0;
+      return isOdd && std::signbit(_base) ? -r : r;
+    }
+    if (_base < 0.0 && !isInteger) {
+      return std::numeric_limits<double>::quiet_NaN();
+    }
+    if (_base == -1.0) {
+      return isOdd ? -1.0 : 1.0;
+    }
+    if (_power == 1.0) {
+      return _base;
+    }
+    if (_power == 2.0) {
+      return _base * _base;
+    }
+
+    double logHi, logLo;
+    logExtended(absBase, logHi, logLo);
+    double result;
+    double zHi = _power * logHi;
+    if (zHi > 710.0) {
+      result = kINFINITY;
+    }
+    else if (zHi < -746.0) {
+      result = 0.0;
+    }
+    else {
+      /*
+       * |zHi| <= 746 with |logHi| >= 2^-53 keeps the power under 2^63, the
+       * product can be split.
+       */
+      double zLo;
+      twoProduct(_power, logHi, zHi, zLo);
+      zLo += _power * logLo;
+      result = exp(zHi);
+      result += result * zLo;
+    }
+    return _base < 0.0 && isOdd ? -result : result;
+  }
+  float
+  DeterministicMath::pow(float _base, float _power)
+  {
+    return static_cast<float>(pow(static_cast<double>(_base),
+                                  static_cast<double>(_power)));
+  }
+}
@@ -0,0 +1,79 @@
+#include "nfFastMath.h"
+
+#include "nfFastMathPack.h"
+
+namespace nfEngineSDK
+{
+  void
+  FastMath::exp2(const float* _in, float* _out, SIZE_T _count)
+  {
+    SIZE_T i = 0;
+#if NF_FASTMATH_SIMD
+    for (; i + P::kLANES <= _count; i += P::kLANES) {
+      P::store(_out + i, exp2Pack(P::load(_in + i)));
+    }
+#endif
+    for (; i < _count; ++i) {
+      _out[i] = exp2(_in[i]);
+    }
+  }
+
+  void
+  FastMath::log2(const float* _in, float* _out, SIZE_T _count)
+  {
+    SIZE_T i = 0;
+#if NF_FASTMATH_SIMD
+    for (; i + P::kLANES <= _count; i += P::kLANES) {
+      P::store(_out + i, log2Pack(P::load(_in + i)));
+    }
+#endif
+    for (; i < _count; ++i) {
+      _out[i] = log2(_in[i]);
+    }
+  }
+
+  void
+  FastMath::exp(const float* _in, float* _out, SIZE_T _count)
+  {
+    SIZE_T i = 0;
+#if NF_FASTMATH_SIMD
+    P::Reg log2e = P::set(kLOG2_E);
+    for (; i + P::kLANES <= _count; i += P::kLANES) {
+      P::store(_out + i, exp2Pack(P::mul(P::load(_in + i), log2e)));
+    }
+#endif
+    for (; i < _count; ++i) {
+      _out[i] = exp(_in[i]);
+    }
+  }
+
+  void
+  FastMath::log(const float* _in, float* _out, SIZE_T _count)
+  {
+    SIZE_T i = 0;
+#if NF_FASTMATH_SIMD
+    P::Reg ln2 = P::set(kLN_2);
+    for (; i + P::kLANES <= _count; i += P::kLANES) {
+      P::store(_out + i, P::mul(log2Pack(P::load(_in + i)), ln2));
+    }
+#endif
+    for (; i < _count; ++i) {
+      _out[i] = log(_in[i]);
+    }
+  }
+
+  void
+  FastMath::pow(const float* _bases, float _power, float* _out, SIZE_T _count)
+  {
+    SIZE_T i = 0;
+#if NF_FASTMATH_SIMD
+    P::Reg power = P::set(_power);
+    for (; i + P::kLANES <= _count; i += P::kLANES) {
+      P::store(_out + i, exp2Pack(P::mul(power, log2Pack(P::load(_bases + i)))));
+    }
+#endif
+    for (; i < _count; ++i) {
+      _out[i] = pow(_bases[i], _power);
+    }
+  }
+}
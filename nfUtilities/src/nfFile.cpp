@@ -0,0 +1,366 @@
+#include "nfFile.h"
+
+#include <cerrno>
+#include <cstring>
+
+#if NF_PLATFORM == NF_PLATFORM_WIN32
+# ifndef WIN32_LEAN_AND_MEAN
+#   define WIN32_LEAN_AND_MEAN
+# endif
+# ifndef NOMINMAX
+#   define NOMINMAX
+# endif
+# include <windows.h>
+#else
+# include <fcntl.h>
+# include <sys/mman.h>
+# include <sys/stat.h>
+# include <unistd.h>
+#endif
+
+namespace nfEngineSDK
+{
+  namespace {
+#if NF_PLATFORM == NF_PLATFORM_WIN32
+    const intptr_t kNO_HANDLE = reinterpret_cast<intptr_t>(INVALID_HANDLE_VALUE);
+
+    FORCEINLINE HANDLE
+    toHandle(intptr_t _handle)
+    {
+      return reinterpret_cast<HANDLE>(_handle);
+    }
+
+    WString
+    toWide(const String& _path)
+    {
+      int32 length = MultiByteToWideChar(CP_UTF8, 0, _path.c_str(), -1, nullptr, 0);
+      WString wide(length > 0 ? length - 1 : 0, L'\0');
+      if (length > 1) {
+        MultiByteToWideChar(CP_UTF8, 0, _path.c_str(), -1, &wide[0], length);
+      }
+      return wide;
+    }
+#else
+    const intptr_t kNO_HANDLE = -1;
+
+    int
+    toAdvice(FILE_ACCESS_HINT::E _hint)
+    {
+      switch (_hint) {
+        case FILE_ACCESS_HINT::kSEQUENTIAL: return MADV_SEQUENTIAL;
+        case FILE_ACCESS_HINT::kRANDOM: return MADV_RANDOM;
+        case FILE_ACCESS_HINT::kWILL_NEED: return MADV_WILLNEED;
+        default: return MADV_NORMAL;
+      }
+    }
+#endif
+  }
+
+  File::File(File&& _other) noexcept
+  {
+    *this = std::move(_other);
+  }
+
+  File::~File()
+  {
+    close();
+  }
+
+  File&
+  File::operator=(File&& _other) noexcept
+  {
+    if (this != &_other) {
+      close();
+      m_handle = _other.m_handle;
+      m_mapping = _other.m_mapping;
+      m_data = _other.m_data;
+      m_size = _other.m_size;
+      m_buffer = std::move(_other.m_buffer);
+      m_open = _other.m_open;
+      m_mapped = _other.m_mapped;
+      /* The moved vector keeps its memory, so a buffered view is still good. */
+      _other.m_handle = kNO_HANDLE;
+      _other.m_mapping = nullptr;
+      _other.m_data = nullptr;
+      _other.m_size = 0;
+      _other.m_open = false;
+      _other.m_mapped = false;
+    }
+    return *this;
+  }
+
+  bool
+  File::open(const String& _path, FILE_ACCESS_HINT::E _hint, bool _memoryMap)
+  {
+    if (!openHandle(_path, _hint)) {
+      return false;
+    }
+
+    if (_memoryMap && m_size > 0) {
+#if NF_PLATFORM == NF_PLATFORM_WIN32
+      m_mapping = CreateFileMappingW(toHandle(m_handle), nullptr, PAGE_READONLY,
+                                     0, 0, nullptr);
+      if (nullptr != m_mapping) {
+        m_data = static_cast<const uint8*>(MapViewOfFile(m_mapping, FILE_MAP_READ,
+                                                         0, 0, 0));
+        if (nullptr == m_data) {
+          CloseHandle(m_mapping);
+          m_mapping = nullptr;
+        }
+      }
+#else
+      void* map = mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE,
+                       static_cast<int>(m_handle), 0);
+      if (MAP_FAILED != map) {
+        m_data = static_cast<const uint8*>(map);
+      }
+#endif
+    }
+
+    m_mapped = nullptr != m_data;
+    if (m_mapped) {
+      if (FILE_ACCESS_HINT::kNORMAL != _hint) {
+        advise(_hint);
+      }
+      return true;
+    }
+
+    SIZE_T done = 0;
+    m_buffer.resize(m_size);
+    if (m_size > 0 && !readFully(m_handle, m_buffer.data(), m_size, done)) {
+      close();
+      return false;
+    }
+    m_buffer.resize(done);
+    m_size = done;
+    m_data = m_buffer.data();
+    return true;
+  }
+
+  bool
+  File::openStream(const String& _path, FILE_ACCESS_HINT::E _hint)
+  {
+    return openHandle(_path, _hint);
+  }
+
+  bool
+  File::openHandle(const String& _path, FILE_ACCESS_HINT::E _hint)
+  {
+    close();
+
+#if NF_PLATFORM == NF_PLATFORM_WIN32
+    DWORD flags = FILE_ATTRIBUTE_NORMAL;
+    if (FILE_ACCESS_HINT::kSEQUENTIAL == _hint) {
+      flags |= FILE_FLAG_SEQUENTIAL_SCAN;
+    }
+    else if (FILE_ACCESS_HINT::kRANDOM == _hint) {
+      flags |= FILE_FLAG_RANDOM_ACCESS;
+    }
+    HANDLE file = CreateFileW(toWide(_path).c_str(), GENERIC_READ, FILE_SHARE_READ,
+                              nullptr, OPEN_EXISTING, flags, nullptr);
+    if (INVALID_HANDLE_VALUE == file) {
+      return false;
+    }
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(file, &size)) {
+      CloseHandle(file);
+      return false;
+    }
+    m_handle = reinterpret_cast<intptr_t>(file);
+    m_size = static_cast<SIZE_T>(size.QuadPart);
+#else
+    int descriptor = ::open(_path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (descriptor < 0) {
+      return false;
+    }
+    struct stat info;
+    if (0 != fstat(descriptor, &info)) {
+      ::close(descriptor);
+      return false;
+    }
+    m_handle = descriptor;
+    /* Pipes and devices have no size, they are not supported. */
+    m_size = S_ISREG(info.st_mode) ? static_cast<SIZE_T>(info.st_size) : 0;
+# if defined(POSIX_FADV_SEQUENTIAL)
+    /* The hint for the reads that don't go through a map. */
+    if (FILE_ACCESS_HINT::kSEQUENTIAL == _hint) {
+      posix_fadvise(descriptor, 0, 0, POSIX_FADV_SEQUENTIAL);
+    }
+    else if (FILE_ACCESS_HINT::kRANDOM == _hint) {
+      posix_fadvise(descriptor, 0, 0, POSIX_FADV_RANDOM);
+    }
+# endif
+#endif
+    m_open = true;
+    return true;
+  }
+
+  void
+  File::close()
+  {
+#if NF_PLATFORM == NF_PLATFORM_WIN32
+    if (m_mapped) {
+      UnmapViewOfFile(m_data);
+    }
+    if (nullptr != m_mapping) {
+      CloseHandle(m_mapping);
+    }
+    if (kNO_HANDLE != m_handle) {
+      CloseHandle(toHandle(m_handle));
+    }
+#else
+    if (m_mapped) {
+      munmap(const_cast<uint8*>(m_data), m_size);
+    }
+    if (kNO_HANDLE != m_handle) {
+      ::close(static_cast<int>(m_handle));
+    }
+#endif
+    m_handle = kNO_HANDLE;
+    m_mapping = nullptr;
+    m_data = nullptr;
+    m_size = 0;
+    m_buffer = Vector<uint8>();
+    m_open = false;
+    m_mapped = false;
+  }
+
+  void
+  File::advise(FILE_ACCESS_HINT::E _hint, SIZE_T _offset, SIZE_T _size) const
+  {
+    if (!m_mapped || _offset >= m_size) {
+      return;
+    }
+    SIZE_T size = 0 == _size || _size > m_size - _offset ? m_size - _offset : _size;
+
+#if NF_PLATFORM == NF_PLATFORM_WIN32
+    /*
+     * Sequential and random are only flags of CreateFile, open() takes them.
+     * Windows 8 and newer can prefetch a range of a map.
+     */
+    if (FILE_ACCESS_HINT::kWILL_NEED == _hint) {
+      WIN32_MEMORY_RANGE_ENTRY range;
+      range.VirtualAddress = const_cast<uint8*>(m_data + _offset);
+      range.NumberOfBytes = size;
+      PrefetchVirtualMemory(GetCurrentProcess(), 1, &range, 0);
+    }
+#else
+    /* madvise wants the start aligned to the page. */
+    static const SIZE_T pageSize = static_cast<SIZE_T>(sysconf(_SC_PAGESIZE));
+    SIZE_T start = _offset & ~(pageSize - 1);
+    madvise(const_cast<uint8*>(m_data + start), size + (_offset - start),
+            toAdvice(_hint));
+#endif
+  }
+
+  SIZE_T
+  File::read(SIZE_T _offset, void* _out, SIZE_T _size) const
+  {
+    if (!m_open || _offset >= m_size) {
+      return 0;
+    }
+    SIZE_T size = _size < m_size - _offset ? _size : m_size - _offset;
+    if (nullptr != m_data) {
+      std::memcpy(_out, m_data + _offset, size);
+      return size;
+    }
+    return readAt(m_handle, _offset, static_cast<uint8*>(_out), size);
+  }
+
+  SIZE_T
+  File::readAt(intptr_t _handle, SIZE_T _offset, uint8* _out, SIZE_T _size)
+  {
+    SIZE_T done = 0;
+    while (done < _size) {
+#if NF_PLATFORM == NF_PLATFORM_WIN32
+      /* An offset on the OVERLAPPED makes it a positioned read. */
+      OVERLAPPED overlapped{};
+      uint64 offset = static_cast<uint64>(_offset + done);
+      overlapped.Offset = static_cast<DWORD>(offset);
+      overlapped.OffsetHigh = static_cast<DWORD>(offset >> 32);
+      DWORD chunk = static_cast<DWORD>(_size - done < 0x40000000u ?
+                                       _size - done : 0x40000000u);
+      DWORD readBytes = 0;
+      if (!ReadFile(toHandle(_handle), _out + done, chunk, &readBytes, &overlapped)) {
+        break;
+      }
+#else
+      ssize_t readBytes = pread(static_cast<int>(_handle), _out + done, _size - done,
+                                static_cast<off_t>(_offset + done));
+      if (readBytes < 0) {
+        if (EINTR == errno) {
+          continue;
+        }
+        break;
+      }
+#endif
+      if (0 == readBytes) {
+        break;
+      }
+      done += static_cast<SIZE_T>(readBytes);
+    }
+    return done;
+  }
+
+  bool
+  File::readFully(intptr_t _handle, uint8* _out, SIZE_T _size, SIZE_T& _done)
+  {
+    _done = 0;
+    while (_done < _size) {
+#if NF_PLATFORM == NF_PLATFORM_WIN32
+      /* ReadFile takes 32 bits sizes. */
+      DWORD chunk = static_cast<DWORD>(_size - _done < 0x40000000u ?
+                                       _size - _done : 0x40000000u);
+      DWORD readBytes = 0;
+      if (!ReadFile(toHandle(_handle), _out + _done, chunk, &readBytes, nullptr)) {
+        return false;
+      }
+#else
+      ssize_t readBytes = ::read(static_cast<int>(_handle), _out + _done, _size - _done);
+      if (readBytes < 0) {
+        if (EINTR == errno) {
+          continue;
+        }
+        return false;
+      }
+#endif
+      /* The file got shorter since it was opened. */
+      if (0 == readBytes) {
+        break;
+      }
+      _done += static_cast<SIZE_T>(readBytes);
+    }
+    return true;
+  }
+
+  template<class _Buffer>
+  bool
+  File::readWhole(const String& _path, _Buffer& _out)
+  {
+    File file;
+    if (!file.openHandle(_path, FILE_ACCESS_HINT::kSEQUENTIAL)) {
+      return false;
+    }
+    _out.resize(file.m_size);
+    SIZE_T done = 0;
+    if (file.m_size > 0 &&
+        !readFully(file.m_handle, reinterpret_cast<uint8*>(&_out[0]), file.m_size, done)) {
+      _out.clear();
+      return false;
+    }
+    _out.resize(done);
+    return true;
+  }
+
+  bool
+  File::readAll(const String& _path, String& _out)
+  {
+    return readWhole(_path, _out);
+  }
+
+  bool
+  File::readAll(const String& _path, Vector<uint8>& _out)
+  {
+    return readWhole(_path, _out);
+  }
+}
@@ -0,0 +1,57 @@
+#include "nfFrustum.h"
+
+#include "nfMath.h"
+
+namespace nfEngineSDK
+{
+  namespace {
+    /*
+     * A column of the matrix, the coefficients of a clip coordinate.
+     */
+    FORCEINLINE Vector4f
+    column(const Matrix4f& _matrix, uint32 _column)
+    {
+      return Vector4f(_matrix.m[_column], _matrix.m[4 + _column],
+                      _matrix.m[8 + _column], _matrix.m[12 + _column]);
+    }
+
+    /*
+     * Scales the plane so its normal is unitary and the distance is in
+     * world units. A degenerated plane, the far one when it is infinite,
+     * stays as it is.
+     */
+    FORCEINLINE Vector4f
+    normalizePlane(const Vector4f& _plane)
+    {
+      float length = Math::sqrt(_plane.x * _plane.x + _plane.y * _plane.y + _plane.z * _plane.z);
+      if (length <= 0.0f) {
+        return _plane;
+      }
+      float invLength = 1.0f / length;
+      return Vector4f(_plane.x * invLength, _plane.y * invLength,
+                      _plane.z * invLength, _plane.w * invLength);
+    }
+  }
+
+  /*
+   * Gribb and Hartmann: a clip coordinate is inside when -w <= x <= w,
+   * -w <= y <= w and 0 <= z <= w, every inequality is a plane made by
+   * adding or subtracting columns.
+   */
+  Frustum::Frustum(const Matrix4f& _viewProjection, bool _reverseZ)
+  {
+    Vector4f x = column(_viewProjection, 0);
+    Vector4f y = column(_viewProjection, 1);
+    Vector4f z = column(_viewProjection, 2);
+    Vector4f w = column(_viewProjection, 3);
+
+    m_planes[FRUSTUM_PLANE::kLEFT] = normalizePlane(w + x);
+    m_planes[FRUSTUM_PLANE::kRIGHT] = normalizePlane(w - x);
+    m_planes[FRUSTUM_PLANE::kBOTTOM] = normalizePlane(w + y);
+    m_planes[FRUSTUM_PLANE::kTOP] = normalizePlane(w - y);
+    Vector4f zeroDepth = normalizePlane(z);
+    Vector4f fullDepth = normalizePlane(w - z);
+    m_planes[FRUSTUM_PLANE::kNEAR] = _reverseZ ? fullDepth : zeroDepth;
+    m_planes[FRUSTUM_PLANE::kFAR] = _reverseZ ? zeroDepth : fullDepth;
+  }
+}
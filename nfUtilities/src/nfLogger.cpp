@@ -0,0 +1,551 @@
+#include "nfLogger.h"
+
+#include <charconv>
+#include <cstdio>
+
+#include "nfMatrix3.h"
+#include "nfMatrix4.h"
+#include "nfStringConversion.h"
+#include "nfTime.h"
+#include "nfVector2.h"
+#include "nfVector3.h"
+#include "nfVector4.h"
+
+namespace nfEngineSDK
+{
+  namespace {
+    /*
+     * The head of every message on a queue, followed by its arguments. A
+     * null site is the padding to the end of the queue.
+     */
+    struct RecordHeader
+    {
+      /* The bytes to the next message and the bytes of the arguments. */
+      uint32 size;
+      uint32 arguments;
+      LogSite* site;
+      const char* format;
+      uint64 time;
+      uint32 suppressed;
+    };
+
+    const SIZE_T kALIGNMENT = 8;
+    const SIZE_T kQUEUE_MASK = Logger::kQUEUE_SIZE - 1;
+
+    /*
+     * How long the background thread sleeps when the queues are empty.
+     */
+    const std::chrono::milliseconds kIDLE_WAIT(2);
+
+    const char* const kLEVEL_NAMES[] = {
+      "TRACE", "DEBUG", "INFO", "WARNING", "ERROR", "FATAL"
+    };
+
+    /*
+     * The queue of a thread. Only its thread moves the head, only the
+     * background thread moves the tail.
+     */
+    struct LogQueue
+    {
+      Vector<uint8> buffer = Vector<uint8>(Logger::kQUEUE_SIZE);
+      std::atomic<uint64> head{ 0 };
+      std::atomic<uint64> tail{ 0 };
+      std::atomic<uint64> dropped{ 0 };
+      /* Set when the thread ends, the queue is given to the next thread. */
+      std::atomic<bool> retired{ false };
+      /* The size of the message reserved by beginRecord(). */
+      SIZE_T pending = 0;
+      uint32 index = 0;
+    };
+
+    struct State
+    {
+      std::mutex mutex;
+      Vector<SPtr<LogQueue>> queues;
+      std::thread worker;
+      std::condition_variable wake;
+      std::condition_variable flushed;
+      uint64 flushRequests = 0;
+      uint64 flushesDone = 0;
+      OFStream file;
+      bool console = false;
+      uint64 start = 0;
+      std::atomic<uint32> rateLimit{ 0 };
+    };
+
+    /*
+     * Never destroyed, the threads can still log while the statics are
+     * destroyed.
+     */
+    State&
+    getState()
+    {
+      static State* state = new State();
+      return *state;
+    }
+
+    NF_THREADLOCAL LogQueue* t_queue = nullptr;
+
+    /*
+     * Retires the queue of a thread when it ends. The messages use the plain
+     * pointer, this only exists for its destructor.
+     */
+    struct QueueRetire
+    {
+      ~QueueRetire()
+      {
+        if (nullptr != t_queue) {
+          t_queue->retired.store(true, std::memory_order_release);
+          t_queue = nullptr;
+        }
+      }
+    };
+
+    LogQueue*
+    getQueue()
+    {
+      LogQueue* queue = t_queue;
+      if (nullptr != queue) {
+        return queue;
+      }
+
+      static thread_local QueueRetire retire;
+      (void)retire;
+
+      State& state = getState();
+      std::lock_guard<std::mutex> lock(state.mutex);
+      /* A retired queue is taken once the background thread emptied it. */
+      for (const SPtr<LogQueue>& candidate : state.queues) {
+        if (candidate->retired.load(std::memory_order_acquire) &&
+            candidate->head.load(std::memory_order_relaxed) ==
+            candidate->tail.load(std::memory_order_acquire)) {
+          queue = candidate.get();
+          queue->retired.store(false, std::memory_order_relaxed);
+          break;
+        }
+      }
+      if (nullptr == queue) {
+        SPtr<LogQueue> created = std::make_shared<LogQueue>();
+        created->index = static_cast<uint32>(state.queues.size());
+        state.queues.push_back(created);
+        queue = created.get();
+      }
+      t_queue = queue;
+      return queue;
+    }
+
+    template<class T>
+    FORCEINLINE T
+    readValue(const uint8*& _in)
+    {
+      T value;
+      std::memcpy(&value, _in, sizeof(T));
+      _in += sizeof(T);
+      return value;
+    }
+
+    template<class VectorType>
+    void
+    writeVector(TextWriter& _writer, const uint8*& _in)
+    {
+      VectorType value;
+      std::memcpy(value.data(), _in, sizeof(typename VectorType::ValueType) * VectorType::kSIZE);
+      _in += sizeof(typename VectorType::ValueType) * VectorType::kSIZE;
+      _writer.write(value);
+    }
+
+    /*
+     * Writes the argument at _in and moves past it.
+     */
+    void
+    writeArgument(TextWriter& _writer, const uint8*& _in)
+    {
+      uint8 tag = *_in++;
+      switch (tag) {
+        case LogArgument::kINT: {
+          int64 value = readValue<int64>(_in);
+          char text[24];
+          std::to_chars_result result = std::to_chars(text, text + sizeof(text), value);
+          _writer.write(text, static_cast<SIZE_T>(result.ptr - text));
+          break;
+        }
+        case LogArgument::kUINT: {
+          uint64 value = readValue<uint64>(_in);
+          char text[24];
+          std::to_chars_result result = std::to_chars(text, text + sizeof(text), value);
+          _writer.write(text, static_cast<SIZE_T>(result.ptr - text));
+          break;
+        }
+        case LogArgument::kFLOAT:
+          _writer.write(readValue<float>(_in));
+          break;
+        case LogArgument::kDOUBLE: {
+          double value = readValue<double>(_in);
+          char text[32];
+          std::to_chars_result result = std::to_chars(text, text + sizeof(text), value);
+          _writer.write(text, static_cast<SIZE_T>(result.ptr - text));
+          break;
+        }
+        case LogArgument::kBOOL:
+          _writer.write(0 != *_in++ ? "true" : "false");
+          break;
+        case LogArgument::kCHAR:
+          _writer.write(reinterpret_cast<const char*>(_in++), 1);
+          break;
+        case LogArgument::kSTRING: {
+          uint32 size = readValue<uint32>(_in);
+          _writer.write(reinterpret_cast<const char*>(_in), size);
+          _in += size;
+          break;
+        }
+        case LogArgument::kVECTOR_FLOAT: {
+          uint8 count = *_in++;
+          if (2 == count) {
+            writeVector<Vector2f>(_writer, _in);
+          }
+          else if (3 == count) {
+            writeVector<Vector3f>(_writer, _in);
+          }
+          else {
+            writeVector<Vector4f>(_writer, _in);
+          }
+          break;
+        }
+        case LogArgument::kVECTOR_INT: {
+          uint8 count = *_in++;
+          if (2 == count) {
+            writeVector<Vector2i>(_writer, _in);
+          }
+          else if (3 == count) {
+            writeVector<Vector3i>(_writer, _in);
+          }
+          else {
+            writeVector<Vector4i>(_writer, _in);
+          }
+          break;
+        }
+        case LogArgument::kVECTOR_UINT: {
+          uint8 count = *_in++;
+          if (2 == count) {
+            writeVector<Vector2u>(_writer, _in);
+          }
+          else if (3 == count) {
+            writeVector<Vector3u>(_writer, _in);
+          }
+          else {
+            writeVector<Point4D>(_writer, _in);
+          }
+          break;
+        }
+        case LogArgument::kMATRIX: {
+          uint8 size = *_in++;
+          if (3 == size) {
+            Matrix3f value;
+            std::memcpy(value.m, _in, sizeof(value.m));
+            _writer.write(value);
+          }
+          else {
+            Matrix4f value;
+            std::memcpy(value.m, _in, sizeof(value.m));
+            _writer.write(value);
+          }
+          _in += size * size * sizeof(float);
+          break;
+        }
+        default:
+          break;
+      }
+    }
+
+    /*
+     * Writes "[seconds] [LEVEL] [Category] [T0] message\n".
+     */
+    void
+    writeMessage(TextWriter& _writer,
+                 const RecordHeader& _header,
+                 uint32 _thread,
+                 uint64 _start)
+    {
+      const LogSite& site = *_header.site;
+      uint64 microseconds = static_cast<uint64>(
+        Time::toSeconds(_header.time > _start ? _header.time - _start : 0) * 1e6);
+      _writer.write("[", 1);
+      _writer.write(static_cast<uint32>(microseconds / 1000000));
+      uint32 fraction = static_cast<uint32>(microseconds % 1000000);
+      char digits[7] = { '.' };
+      for (int32 i = 6; i > 0; --i, fraction /= 10) {
+        digits[i] = static_cast<char>('0' + fraction % 10);
+      }
+      _writer.write(digits, 7);
+      _writer.write("] [");
+      _writer.write(kLEVEL_NAMES[site.level]);
+      _writer.write("] [");
+      _writer.write(site.category);
+      _writer.write("] [T");
+      _writer.write(_thread);
+      _writer.write("] ");
+
+      const uint8* in = reinterpret_cast<const uint8*>(&_header) + sizeof(RecordHeader);
+      const uint8* end = in + _header.arguments;
+      const char* text = _header.format;
+      while (0 != *text) {
+        const char* mark = std::strstr(text, "{}");
+        if (nullptr == mark || in >= end) {
+          _writer.write(text);
+          break;
+        }
+        _writer.write(text, static_cast<SIZE_T>(mark - text));
+        writeArgument(_writer, in);
+        text = mark + 2;
+      }
+      if (0 != _header.suppressed) {
+        _writer.write(" (");
+        _writer.write(_header.suppressed);
+        _writer.write(" suppressed)");
+      }
+      _writer.write("\n", 1);
+    }
+
+    /*
+     * Writes the messages of a queue, returns true if there were any.
+     */
+    bool
+    drain(LogQueue& _queue, TextWriter& _writer, uint64 _start)
+    {
+      uint64 tail = _queue.tail.load(std::memory_order_relaxed);
+      uint64 head = _queue.head.load(std::memory_order_acquire);
+      if (tail == head) {
+        return false;
+      }
+      while (tail != head) {
+        SIZE_T offset = static_cast<SIZE_T>(tail & kQUEUE_MASK);
+        SIZE_T toEnd = Logger::kQUEUE_SIZE - offset;
+        if (toEnd < sizeof(RecordHeader)) {
+          tail += toEnd;
+          continue;
+        }
+        const RecordHeader& header =
+          *reinterpret_cast<const RecordHeader*>(_queue.buffer.data() + offset);
+        if (nullptr != header.site) {
+          writeMessage(_writer, header, _queue.index, _start);
+        }
+        tail += header.size;
+      }
+      _queue.tail.store(tail, std::memory_order_release);
+      return true;
+    }
+
+    void
+    writeOutput(const char* _text, SIZE_T _size)
+    {
+      State& state = getState();
+      if (state.file.is_open()) {
+        state.file.write(_text, static_cast<std::streamsize>(_size));
+      }
+      if (state.console) {
+        std::fwrite(_text, 1, _size, stdout);
+      }
+    }
+
+    void
+    runWorker()
+    {
+      State& state = getState();
+      TextWriter writer(&writeOutput);
+      std::unique_lock<std::mutex> lock(state.mutex);
+      while (true) {
+        uint64 requests = state.flushRequests;
+        bool running = Logger::isRunning();
+        /* New threads register under the lock, the queues are copied. */
+        Vector<SPtr<LogQueue>> queues = state.queues;
+        lock.unlock();
+
+        bool wrote = false;
+        for (const SPtr<LogQueue>& queue : queues) {
+          wrote = drain(*queue, writer, state.start) || wrote;
+        }
+        writer.flush();
+        if (wrote) {
+          state.file.flush();
+          if (state.console) {
+            std::fflush(stdout);
+          }
+        }
+
+        lock.lock();
+        state.flushesDone = requests;
+        state.flushed.notify_all();
+        if (!running) {
+          break;
+        }
+        if (!wrote && requests == state.flushRequests) {
+          state.wake.wait_for(lock, kIDLE_WAIT);
+        }
+      }
+    }
+  }
+
+  std::atomic<bool> Logger::s_running{ false };
+
+  void
+  LogArgument::write(uint8*& _out, const Matrix3f& _value)
+  {
+    _out[0] = kMATRIX;
+    _out[1] = 3;
+    std::memcpy(_out + 2, _value.m, sizeof(_value.m));
+    _out += 2 + sizeof(_value.m);
+  }
+
+  void
+  LogArgument::write(uint8*& _out, const Matrix4f& _value)
+  {
+    _out[0] = kMATRIX;
+    _out[1] = 4;
+    std::memcpy(_out + 2, _value.m, sizeof(_value.m));
+    _out += 2 + sizeof(_value.m);
+  }
+
+  bool
+  Logger::start(const String& _path, bool _console)
+  {
+    stop();
+    State& state = getState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    if (!_path.empty()) {
+      state.file.open(_path, std::ios::binary | std::ios::trunc);
+      if (!state.file) {
+        return false;
+      }
+    }
+    state.console = _console;
+    state.start = Time::now();
+    s_running.store(true, std::memory_order_relaxed);
+    state.worker = std::thread(&runWorker);
+    return true;
+  }
+
+  void
+  Logger::stop()
+  {
+    State& state = getState();
+    {
+      std::lock_guard<std::mutex> lock(state.mutex);
+      if (!state.worker.joinable()) {
+        return;
+      }
+      s_running.store(false, std::memory_order_relaxed);
+      state.wake.notify_all();
+    }
+    /* The worker does a last pass before it ends. */
+    state.worker.join();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    if (state.file.is_open()) {
+      state.file.close();
+    }
+  }
+
+  void
+  Logger::flush()
+  {
+    State& state = getState();
+    std::unique_lock<std::mutex> lock(state.mutex);
+    if (!state.worker.joinable()) {
+      return;
+    }
+    uint64 request = ++state.flushRequests;
+    state.wake.notify_all();
+    state.flushed.wait(lock, [&state, request]() {
+      return state.flushesDone >= request || !isRunning();
+    });
+  }
+
+  void
+  Logger::setRateLimit(uint32 _messagesPerSecond)
+  {
+    getState().rateLimit.store(_messagesPerSecond, std::memory_order_relaxed);
+  }
+
+  uint64
+  Logger::getDroppedMessages()
+  {
+    State& state = getState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    uint64 dropped = 0;
+    for (const SPtr<LogQueue>& queue : state.queues) {
+      dropped += queue->dropped.load(std::memory_order_relaxed);
+    }
+    return dropped;
+  }
+
+  bool
+  Logger::allow(LogSite& _site)
+  {
+    uint32 limit = getState().rateLimit.load(std::memory_order_relaxed);
+    if (0 == limit) {
+      return true;
+    }
+    static const uint64 second = Time::fromSeconds(1.0);
+    uint64 now = Time::now();
+    uint64 windowStart = _site.windowStart.load(std::memory_order_relaxed);
+    if (now - windowStart >= second &&
+        _site.windowStart.compare_exchange_strong(windowStart, now,
+                                                  std::memory_order_relaxed)) {
+      _site.windowCount.store(0, std::memory_order_relaxed);
+    }
+    if (_site.windowCount.fetch_add(1, std::memory_order_relaxed) < limit) {
+      return true;
+    }
+    _site.suppressed.fetch_add(1, std::memory_order_relaxed);
+    return false;
+  }
+
+  uint8*
+  Logger::beginRecord(LogSite& _site, const char* _format, SIZE_T _size)
+  {
+    LogQueue* queue = getQueue();
+    SIZE_T size = (sizeof(RecordHeader) + _size + kALIGNMENT - 1) & ~(kALIGNMENT - 1);
+    if (size > kQUEUE_SIZE / 2) {
+      queue->dropped.fetch_add(1, std::memory_order_relaxed);
+      return nullptr;
+    }
+
+    uint64 head = queue->head.load(std::memory_order_relaxed);
+    uint64 tail = queue->tail.load(std::memory_order_acquire);
+    SIZE_T offset = static_cast<SIZE_T>(head & kQUEUE_MASK);
+    SIZE_T toEnd = kQUEUE_SIZE - offset;
+    /* A message doesn't wrap, the end of the queue is skipped instead. */
+    SIZE_T padding = toEnd < size ? toEnd : 0;
+    if (kQUEUE_SIZE - static_cast<SIZE_T>(head - tail) < padding + size) {
+      queue->dropped.fetch_add(1, std::memory_order_relaxed);
+      return nullptr;
+    }
+    if (0 != padding) {
+      if (padding >= sizeof(RecordHeader)) {
+        RecordHeader* skip = reinterpret_cast<RecordHeader*>(queue->buffer.data() + offset);
+        skip->size = static_cast<uint32>(padding);
+        skip->site = nullptr;
+      }
+      head += padding;
+      offset = 0;
+      queue->head.store(head, std::memory_order_release);
+    }
+
+    RecordHeader* header = reinterpret_cast<RecordHeader*>(queue->buffer.data() + offset);
+    header->size = static_cast<uint32>(size);
+    header->arguments = static_cast<uint32>(_size);
+    header->suppressed = _site.suppressed.exchange(0, std::memory_order_relaxed);
+    header->site = &_site;
+    header->format = _format;
+    header->time = Time::now();
+    queue->pending = size;
+    return reinterpret_cast<uint8*>(header + 1);
+  }
+
+  void
+  Logger::endRecord()
+  {
+    LogQueue* queue = t_queue;
+    queue->head.store(queue->head.load(std::memory_order_relaxed) + queue->pending,
+                      std::memory_order_release);
+  }
+}
@@ -1,8 +1,8 @@
-#include "eeMatrix2.h"
-#include "eeVector2.h"
-#include "eeMath.h"
+#include "nfMatrix2.h"
+#include "nfVector2.h"
+#include "nfMath.h"
 
-namespace eeEngineSDK {
+namespace nfEngineSDK {
 const Matrix2f Matrix2f::kZERO = Matrix2f(0.0f, 0.0f, 0.0f, 0.0f);
 const Matrix2f Matrix2f::kONES = Matrix2f(1.0f, 1.0f, 1.0f, 1.0f);
 const Matrix2f Matrix2f::kIDENTITY = Matrix2f(1.0f, 0.0f, 0.0f, 1.0f);
@@ -10,7 +10,7 @@ const Matrix2f Matrix2f::kIDENTITY = Matrix2f(1.0f, 0.0f, 0.0f, 1.0f);
 
 Matrix2f::Matrix2f(float src[4])
 {
-  memcpy(m, src, sizeof(float) * 4);
+  std::memcpy(m, src, sizeof(float) * 4);
 }
 
 float 
@@ -105,7 +105,7 @@ bool
 Matrix2f::operator==(const Matrix2f& other)
 {
   for (int32 i = 0; i < 4; ++i) {
-    if (!Math::checkFloatsEqual(this->m[i], other.m[i])) {
+    if (!Math::checkEqual(this->m[i], other.m[i])) {
       return false;
     }
   }
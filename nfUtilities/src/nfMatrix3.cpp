@@ -1,9 +1,9 @@
-#include "eeMatrix3.h"
-#include "eeMatrix2.h"
-#include "eeVector3.h" 
-#include "eeMath.h"
+#include "nfMatrix3.h"
+#include "nfMatrix2.h"
+#include "nfVector3.h" 
+#include "nfMath.h"
 
-namespace eeEngineSDK {
+namespace nfEngineSDK {
 const Matrix3f Matrix3f::kZERO = Matrix3f(0.0f, 0.0f, 0.0f,
                                           0.0f, 0.0f, 0.0f, 
                                           0.0f, 0.0f, 0.0f );
@@ -52,7 +52,7 @@ Matrix3f::scaleMatrix(const Vector3f& scale)
 
 Matrix3f::Matrix3f(float src[9])
 {
-  memcpy(m, src, sizeof(float) * 9);
+  std::memcpy(m, src, sizeof(float) * 9);
 }
 
 float
@@ -222,7 +222,7 @@ bool
 Matrix3f::operator==(const Matrix3f& other)
 {
   for (int32 i = 0; i < 9; ++i) {
-    if (!Math::checkFloatsEqual(this->m[i], other.m[i])) {
+    if (!Math::checkEqual(this->m[i], other.m[i])) {
       return false;
     }
   }
@@ -1,10 +1,10 @@
-#include "eeMatrix4.h"
-#include "eeMatrix3.h"
-#include "eeVector3.h"
-#include "eeVector4.h"
-#include "eeMath.h"
+#include "nfMatrix4.h"
+#include "nfMatrix3.h"
+#include "nfVector3.h"
+#include "nfVector4.h"
+#include "nfMath.h"
 
-namespace eeEngineSDK {
+namespace nfEngineSDK {
 const Matrix4f Matrix4f::kZERO = Matrix4f(0.0f, 0.0f, 0.0f, 0.0f,
                                           0.0f, 0.0f, 0.0f, 0.0f,
                                           0.0f, 0.0f, 0.0f, 0.0f,
@@ -114,7 +114,7 @@ Matrix4f Matrix4f::perspectiveMatrix(float FovAngleY,
 
 Matrix4f::Matrix4f(float src[16])
 {
-  memcpy(m, src, sizeof(float) * 16);
+  std::memcpy(m, src, sizeof(float) * 16);
 }
 float
 Matrix4f::getDeterminant() const
@@ -403,7 +403,7 @@ bool
 Matrix4f::operator==(const Matrix4f& other)
 {
   for (int32 i = 0; i < 16; ++i) {
-    if (!Math::checkFloatsEqual(this->m[i], other.m[i])) {
+    if (!Math::checkEqual(this->m[i], other.m[i])) {
       return false;
     }
   }
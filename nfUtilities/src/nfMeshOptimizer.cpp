@@ -0,0 +1,499 @@
+#include "nfMeshOptimizer.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace nfEngineSDK
+{
+  namespace {
+    /*
+     * The smallest range of vertices hashed by a thread.
+     */
+    const SIZE_T kMIN_VERTICES_PER_THREAD = 65536;
+
+    /*
+     * Runs _job over [0, _count) split in contiguous ranges, one per thread,
+     * with the calling thread taking the first one.
+     */
+    template<class Job>
+    void
+    parallelRanges(SIZE_T _count, SIZE_T _minPerThread, uint32 _threads, const Job& _job)
+    {
+      SIZE_T threads = 0 == _threads ? std::thread::hardware_concurrency() : _threads;
+      SIZE_T maxThreads = (_count + _minPerThread - 1) / _minPerThread;
+      threads = threads < maxThreads ? threads : maxThreads;
+      if (threads <= 1) {
+        _job(0, _count);
+        return;
+      }
+
+      SIZE_T chunk = (_count + threads - 1) / threads;
+      Vector<std::thread> workers;
+      workers.reserve(threads - 1);
+      for (SIZE_T begin = chunk; begin < _count; begin += chunk) {
+        SIZE_T end = begin + chunk < _count ? begin + chunk : _count;
+        workers.emplace_back([&_job, begin, end]() { _job(begin, end); });
+      }
+      _job(0, chunk);
+      for (std::thread& worker : workers) {
+        worker.join();
+      }
+    }
+
+    /*
+     * Murmur style hash of the bits of a vertex, its size a multiple of 4.
+     */
+    FORCEINLINE uint32
+    hashVertex(const uint8* _vertex, SIZE_T _size)
+    {
+      uint32 h = 0x9747B28Cu;
+      for (SIZE_T i = 0; i < _size; i += 4) {
+        uint32 k;
+        std::memcpy(&k, _vertex + i, sizeof(k));
+        k *= 0x5BD1E995u;
+        k ^= k >> 24;
+        k *= 0x5BD1E995u;
+        h = (h * 0x5BD1E995u) ^ k;
+      }
+      h ^= h >> 13;
+      h *= 0x5BD1E995u;
+      h ^= h >> 15;
+      return h;
+    }
+
+    /*
+     * Tom Forsyth's scores. A vertex is worth more the closer it is to the
+     * front of the cache and the fewer triangles it has left, so isolated
+     * triangles get finished before they are stranded.
+     */
+    const uint32 kCACHE_SIZE = 16;
+    const uint32 kMAX_VALENCE = 32;
+    const float kCACHE_DECAY_POWER = 1.5f;
+    const float kLAST_TRIANGLE_SCORE = 0.75f;
+    const float kVALENCE_BOOST_SCALE = 2.0f;
+    const float kVALENCE_BOOST_POWER = 0.5f;
+
+    struct ForsythTables
+    {
+      ForsythTables()
+      {
+        /* cache[0] is out of the cache, cache[i + 1] is position i. */
+        cache[0] = 0.0f;
+        for (uint32 i = 0; i < kCACHE_SIZE; ++i) {
+          if (i < 3) {
+            cache[i + 1] = kLAST_TRIANGLE_SCORE;
+          }
+          else {
+            float scale = 1.0f / static_cast<float>(kCACHE_SIZE - 3);
+            cache[i + 1] = std::pow(1.0f - static_cast<float>(i - 3) * scale,
+                                    kCACHE_DECAY_POWER);
+          }
+        }
+        valence[0] = 0.0f;
+        for (uint32 i = 1; i <= kMAX_VALENCE; ++i) {
+          valence[i] = kVALENCE_BOOST_SCALE *
+                       std::pow(static_cast<float>(i), -kVALENCE_BOOST_POWER);
+        }
+      }
+
+      FORCEINLINE float
+      score(int32 _cachePosition, uint32 _liveTriangles) const
+      {
+        if (0 == _liveTriangles) {
+          return -1.0f;
+        }
+        uint32 v = _liveTriangles < kMAX_VALENCE ? _liveTriangles : kMAX_VALENCE;
+        return cache[_cachePosition + 1] + valence[v];
+      }
+
+      float cache[kCACHE_SIZE + 1];
+      float valence[kMAX_VALENCE + 1];
+    };
+
+    /*
+     * A triangle on the list of one of its vertices, with its other two
+     * vertices so it can be scored without reading the index buffer.
+     */
+    struct AdjacentTriangle
+    {
+      uint32 triangle;
+      uint32 others[2];
+    };
+
+    /*
+     * What the algorithm keeps of every vertex, together so looking at a
+     * vertex touches a single cache line.
+     */
+    struct CacheVertex
+    {
+      uint32 firstTriangle;
+      uint32 liveTriangles;
+      float score;
+    };
+
+    /*
+     * Forsyth's algorithm: emits the best scored triangle, moves its
+     * vertices to the front of a simulated LRU cache and rescores only the
+     * triangles around the cache.
+     */
+    void
+    optimizeCache(const uint32* _in,
+                  SIZE_T _triangleCount,
+                  SIZE_T _vertexCount,
+                  uint32* _out)
+    {
+      static const ForsythTables tables;
+
+      /* Triangles of every vertex, compacted. */
+      Vector<CacheVertex> vertices(_vertexCount, CacheVertex{ 0, 0, 0.0f });
+      for (SIZE_T i = 0; i < _triangleCount * 3; ++i) {
+        ++vertices[_in[i]].liveTriangles;
+      }
+      Vector<uint32> fill(_vertexCount);
+      uint32 offset = 0;
+      for (SIZE_T v = 0; v < _vertexCount; ++v) {
+        vertices[v].firstTriangle = offset;
+        vertices[v].score = tables.score(-1, vertices[v].liveTriangles);
+        fill[v] = offset;
+        offset += vertices[v].liveTriangles;
+      }
+      Vector<AdjacentTriangle> adjacency(_triangleCount * 3);
+      for (SIZE_T t = 0; t < _triangleCount; ++t) {
+        const uint32* tri = &_in[t * 3];
+        for (uint32 k = 0; k < 3; ++k) {
+          AdjacentTriangle& entry = adjacency[fill[tri[k]]++];
+          entry.triangle = static_cast<uint32>(t);
+          entry.others[0] = tri[(k + 1) % 3];
+          entry.others[1] = tri[(k + 2) % 3];
+        }
+      }
+      Vector<uint8> emitted(_triangleCount, 0);
+
+      uint32 cache[kCACHE_SIZE + 3];
+      uint32 cacheCount = 0;
+      SIZE_T nextUnemitted = 0;
+      SIZE_T best = 0;
+      for (SIZE_T written = 0; written < _triangleCount; ++written) {
+        const uint32* tri = &_in[best * 3];
+        _out[written * 3] = tri[0];
+        _out[written * 3 + 1] = tri[1];
+        _out[written * 3 + 2] = tri[2];
+        emitted[best] = 1;
+
+        /* The triangle vertices go to the front of the cache. */
+        uint32 newCache[kCACHE_SIZE + 3];
+        uint32 newCount = 0;
+        for (uint32 k = 0; k < 3; ++k) {
+          newCache[newCount++] = tri[k];
+        }
+        for (uint32 i = 0; i < cacheCount; ++i) {
+          uint32 v = cache[i];
+          if (v != tri[0] && v != tri[1] && v != tri[2]) {
+            newCache[newCount++] = v;
+          }
+        }
+
+        /* The triangle is not live anymore on its vertices. */
+        for (uint32 k = 0; k < 3; ++k) {
+          CacheVertex& vertex = vertices[tri[k]];
+          AdjacentTriangle* list = &adjacency[vertex.firstTriangle];
+          uint32 count = vertex.liveTriangles;
+          for (uint32 i = 0; i < count; ++i) {
+            if (list[i].triangle == best) {
+              list[i] = list[count - 1];
+              break;
+            }
+          }
+          --vertex.liveTriangles;
+        }
+
+        /*
+         * Rescore the vertices that moved or fell out of the cache. The
+         * triangles are scored when they are looked at, from the scores of
+         * their vertices, so the triangles of the vertices that fell out are
+         * never touched.
+         */
+        for (uint32 i = 0; i < newCount; ++i) {
+          CacheVertex& vertex = vertices[newCache[i]];
+          int32 position = i < kCACHE_SIZE ? static_cast<int32>(i) : -1;
+          vertex.score = tables.score(position, vertex.liveTriangles);
+        }
+        cacheCount = newCount < kCACHE_SIZE ? newCount : kCACHE_SIZE;
+        std::memcpy(cache, newCache, cacheCount * sizeof(uint32));
+
+        /* The next triangle is the best one around the cache. */
+        float bestScore = -1.0f;
+        for (uint32 i = 0; i < cacheCount; ++i) {
+          const CacheVertex& vertex = vertices[cache[i]];
+          const AdjacentTriangle* list = &adjacency[vertex.firstTriangle];
+          for (uint32 j = 0; j < vertex.liveTriangles; ++j) {
+            float score = vertex.score +
+                          vertices[list[j].others[0]].score +
+                          vertices[list[j].others[1]].score;
+            if (score > bestScore) {
+              bestScore = score;
+              best = list[j].triangle;
+            }
+          }
+        }
+
+        /* Nothing left around the cache, start again somewhere else. */
+        if (bestScore < 0.0f) {
+          while (nextUnemitted < _triangleCount && emitted[nextUnemitted]) {
+            ++nextUnemitted;
+          }
+          best = nextUnemitted;
+        }
+      }
+    }
+
+    FORCEINLINE const float*
+    positionAt(const float* _positions, SIZE_T _stride, uint32 _index)
+    {
+      return reinterpret_cast<const float*>(
+        reinterpret_cast<const uint8*>(_positions) + _stride * _index);
+    }
+  }
+
+  void
+  MeshOptimizer::remapIndices(const uint32* _in,
+                              SIZE_T _indexCount,
+                              const uint32* _remap,
+                              uint32* _out)
+  {
+    for (SIZE_T i = 0; i < _indexCount; ++i) {
+      _out[i] = _remap[_in[i]];
+    }
+  }
+
+  SIZE_T
+  MeshOptimizer::generateVertexRemap(const void* _vertices,
+                                     SIZE_T _vertexSize,
+                                     SIZE_T _vertexCount,
+                                     uint32* _remap,
+                                     uint32 _threads)
+  {
+    const uint8* vertices = static_cast<const uint8*>(_vertices);
+    Vector<uint32> hashes(_vertexCount);
+    parallelRanges(_vertexCount, kMIN_VERTICES_PER_THREAD, _threads, [&](SIZE_T _begin, SIZE_T _end) {
+      for (SIZE_T i = _begin; i < _end; ++i) {
+        hashes[i] = hashVertex(vertices + i * _vertexSize, _vertexSize);
+      }
+    });
+
+    /* Open addressing at less than half load, storing the first vertex. */
+    SIZE_T tableSize = 1;
+    while (tableSize < _vertexCount * 2) {
+      tableSize *= 2;
+    }
+    SIZE_T mask = tableSize - 1;
+    Vector<uint32> table(tableSize, kUNUSED);
+
+    uint32 unique = 0;
+    for (SIZE_T i = 0; i < _vertexCount; ++i) {
+      const uint8* vertex = vertices + i * _vertexSize;
+      SIZE_T slot = hashes[i] & mask;
+      for (;;) {
+        uint32 other = table[slot];
+        if (kUNUSED == other) {
+          table[slot] = static_cast<uint32>(i);
+          _remap[i] = unique++;
+          break;
+        }
+        if (hashes[other] == hashes[i] &&
+            0 == std::memcmp(vertices + other * _vertexSize, vertex, _vertexSize)) {
+          _remap[i] = _remap[other];
+          break;
+        }
+        slot = (slot + 1) & mask;
+      }
+    }
+    return unique;
+  }
+
+  void
+  MeshOptimizer::optimizeVertexCache(const uint32* _in,
+                                     SIZE_T _indexCount,
+                                     SIZE_T _vertexCount,
+                                     uint32* _out)
+  {
+    assertm(0 == _indexCount % 3, "The indices must be a triangle list");
+    Vector<uint32> copy;
+    if (_in == _out) {
+      copy.assign(_in, _in + _indexCount);
+      _in = copy.data();
+    }
+    optimizeCache(_in, _indexCount / 3, _vertexCount, _out);
+  }
+
+  void
+  MeshOptimizer::optimizeOverdraw(const uint32* _in,
+                                  SIZE_T _indexCount,
+                                  const float* _positions,
+                                  SIZE_T _stride,
+                                  SIZE_T _vertexCount,
+                                  uint32* _out)
+  {
+    assertm(0 == _indexCount % 3, "The indices must be a triangle list");
+    SIZE_T triangleCount = _indexCount / 3;
+    if (0 == triangleCount) {
+      return;
+    }
+    Vector<uint32> copy;
+    if (_in == _out) {
+      copy.assign(_in, _in + _indexCount);
+      _in = copy.data();
+    }
+
+    /* Cut a cluster where a triangle misses all its vertices. */
+    const uint32 cacheSize = 16;
+    Vector<uint32> cacheTime(_vertexCount, 0);
+    uint32 time = cacheSize + 1;
+    Vector<uint32> clusterStart;
+    for (SIZE_T t = 0; t < triangleCount; ++t) {
+      uint32 misses = 0;
+      for (uint32 k = 0; k < 3; ++k) {
+        uint32 v = _in[t * 3 + k];
+        if (time - cacheTime[v] > cacheSize) {
+          cacheTime[v] = time++;
+          ++misses;
+        }
+      }
+      if (0 == t || 3 == misses) {
+        clusterStart.push_back(static_cast<uint32>(t));
+      }
+    }
+    SIZE_T clusterCount = clusterStart.size();
+    clusterStart.push_back(static_cast<uint32>(triangleCount));
+
+    /* Area weighted centroid and normal of every cluster. */
+    Vector<Vector3f> centroids(clusterCount);
+    Vector<Vector3f> normals(clusterCount);
+    Vector3f meshCentroid(0.0f, 0.0f, 0.0f);
+    float meshArea = 0.0f;
+    for (SIZE_T c = 0; c < clusterCount; ++c) {
+      Vector3f centroid(0.0f, 0.0f, 0.0f);
+      Vector3f normal(0.0f, 0.0f, 0.0f);
+      float area = 0.0f;
+      for (uint32 t = clusterStart[c]; t < clusterStart[c + 1]; ++t) {
+        const float* a = positionAt(_positions, _stride, _in[t * 3]);
+        const float* b = positionAt(_positions, _stride, _in[t * 3 + 1]);
+        const float* d = positionAt(_positions, _stride, _in[t * 3 + 2]);
+        Vector3f p0(a[0], a[1], a[2]);
+        Vector3f p1(b[0], b[1], b[2]);
+        Vector3f p2(d[0], d[1], d[2]);
+        Vector3f n = (p1 - p0).cross(p2 - p0);
+        float triangleArea = n.getMagnitude();
+        centroid = centroid + (p0 + p1 + p2) * (triangleArea / 3.0f);
+        normal = normal + n;
+        area += triangleArea;
+      }
+      meshCentroid = meshCentroid + centroid;
+      meshArea += area;
+      centroids[c] = area > 0.0f ? centroid / area : centroid;
+      float length = normal.getMagnitude();
+      normals[c] = length > 0.0f ? normal / length : normal;
+    }
+    meshCentroid = meshArea > 0.0f ? meshCentroid / meshArea : meshCentroid;
+
+    /* The clusters that face away from the center are drawn first. */
+    Vector<float> keys(clusterCount);
+    Vector<uint32> order(clusterCount);
+    for (SIZE_T c = 0; c < clusterCount; ++c) {
+      keys[c] = (centroids[c] - meshCentroid).dot(normals[c]);
+      order[c] = static_cast<uint32>(c);
+    }
+    std::stable_sort(order.begin(), order.end(), [&keys](uint32 _a, uint32 _b) {
+      return keys[_a] > keys[_b];
+    });
+
+    uint32* out = _out;
+    for (uint32 c : order) {
+      SIZE_T begin = clusterStart[c] * 3;
+      SIZE_T end = clusterStart[c + 1] * 3;
+      std::memcpy(out, _in + begin, (end - begin) * sizeof(uint32));
+      out += end - begin;
+    }
+  }
+
+  SIZE_T
+  MeshOptimizer::generateFetchRemap(const uint32* _indices,
+                                    SIZE_T _indexCount,
+                                    SIZE_T _vertexCount,
+                                    Vector<uint32>& _remap)
+  {
+    _remap.assign(_vertexCount, kUNUSED);
+    uint32 next = 0;
+    for (SIZE_T i = 0; i < _indexCount; ++i) {
+      uint32& id = _remap[_indices[i]];
+      if (kUNUSED == id) {
+        id = next++;
+      }
+    }
+    return next;
+  }
+
+  float
+  MeshOptimizer::getACMR(const uint32* _indices,
+                         SIZE_T _indexCount,
+                         SIZE_T _vertexCount,
+                         uint32 _cacheSize)
+  {
+    if (_indexCount < 3) {
+      return 0.0f;
+    }
+    /* A FIFO cache: a vertex is in it while fewer than _cacheSize misses
+       happened since it was loaded. */
+    Vector<uint32> loadTime(_vertexCount, 0);
+    uint32 time = _cacheSize + 1;
+    SIZE_T misses = 0;
+    for (SIZE_T i = 0; i < _indexCount; ++i) {
+      uint32 v = _indices[i];
+      if (time - loadTime[v] > _cacheSize) {
+        loadTime[v] = time++;
+        ++misses;
+      }
+    }
+    return static_cast<float>(misses) / static_cast<float>(_indexCount / 3);
+  }
+
+  template<class T>
+  void
+  MeshOptimizer::optimizeMesh(Vector<T>& _vertices,
+                              Vector<uint32>& _indices,
+                              uint32 _threads)
+  {
+    Vector<uint32> remap(_vertices.size());
+    SIZE_T unique = generateVertexRemap(_vertices.data(), _vertices.size(),
+                                        remap.data(), _threads);
+    Vector<T> welded(unique);
+    remapVertices(_vertices.data(), _vertices.size(), remap.data(), welded.data());
+    remapIndices(_indices.data(), _indices.size(), remap.data(), _indices.data());
+
+    optimizeVertexCache(_indices.data(), _indices.size(), unique,
+                        _indices.data());
+    optimizeOverdraw(_indices.data(), _indices.size(), welded.data(), unique,
+                     _indices.data());
+
+    _vertices.resize(unique);
+    SIZE_T used = optimizeVertexFetch(welded.data(), unique, _indices.data(),
+                                      _indices.size(), _vertices.data());
+    _vertices.resize(used);
+  }
+
+  void
+  MeshOptimizer::optimize(Vector<SimplexVertex>& _vertices,
+                          Vector<uint32>& _indices,
+                          uint32 _threads)
+  {
+    optimizeMesh(_vertices, _indices, _threads);
+  }
+
+  void
+  MeshOptimizer::optimize(Vector<ComplexVertex>& _vertices,
+                          Vector<uint32>& _indices,
+                          uint32 _threads)
+  {
+    optimizeMesh(_vertices, _indices, _threads);
+  }
+}
@@ -0,0 +1,440 @@
+#include "nfMeshlet.h"
+
+#include <cstring>
+
+#include "nfMath.h"
+
+namespace nfEngineSDK
+{
+  namespace {
+    const uint32 kNOT_LOCAL = 0xFFFFFFFFu;
+    const uint8 kMAGIC[4] = { 'N', 'F', 'M', 'L' };
+    /*
+     * Magic, version, meshlet count, vertex count, triangle count and the
+     * size of the vertex indices.
+     */
+    const SIZE_T kHEADER_SIZE = 4 + 4 * 4 + 1;
+    const SIZE_T kBOUNDS_SIZE = 4 * 4 + 4;
+
+    /*
+     * The normal of a triangle, 0 if it has no area.
+     */
+    Vector3f
+    triangleNormal(const Vector3f& _a, const Vector3f& _b, const Vector3f& _c)
+    {
+      Vector3f n = (_b - _a).cross(_c - _a);
+      float length = n.getMagnitude();
+      return length > 0.0f ? n * (1.0f / length) : Vector3f(0.0f, 0.0f, 0.0f);
+    }
+
+    /*
+     * The narrowest cone around the normals of the triangles, with the
+     * average normal as axis.
+     */
+    void
+    computeCone(const Vector3f* _normals,
+                SIZE_T _count,
+                Vector3f& _axis,
+                float& _cutoff)
+    {
+      Vector3f sum(0.0f, 0.0f, 0.0f);
+      for (SIZE_T i = 0; i < _count; ++i) {
+        sum = sum + _normals[i];
+      }
+      float length = sum.getMagnitude();
+      if (length <= 0.0f) {
+        _axis = Vector3f(0.0f, 0.0f, 1.0f);
+        _cutoff = 1.0f;
+        return;
+      }
+      _axis = sum * (1.0f / length);
+
+      float minDot = 1.0f;
+      for (SIZE_T i = 0; i < _count; ++i) {
+        if (_normals[i].dot(_normals[i]) > 0.0f) {
+          float d = _normals[i].dot(_axis);
+          minDot = d < minDot ? d : minDot;
+        }
+      }
+      /* Wider than a half space, any camera can see some triangle. */
+      _cutoff = minDot <= 0.0f ? 1.0f : Math::sqrt(1.0f - minDot * minDot);
+    }
+
+    FORCEINLINE int8
+    quantizeSnorm8(float _value)
+    {
+      float scaled = _value * 127.0f;
+      return static_cast<int8>(scaled >= 0.0f ? scaled + 0.5f : scaled - 0.5f);
+    }
+
+    /*
+     * Quantizes the cone to 8 bits per value, widening it by the error of
+     * the quantized axis and rounding the cutoff up, so nothing is culled
+     * that the full cone wouldn't cull.
+     */
+    void
+    quantizeCone(const Vector3f& _axis, float _cutoff, int8 _out[4])
+    {
+      for (uint32 i = 0; i < 3; ++i) {
+        _out[i] = quantizeSnorm8(_axis[i]);
+      }
+      Vector3f axis(_out[0] / 127.0f, _out[1] / 127.0f, _out[2] / 127.0f);
+      float length = axis.getMagnitude();
+      float error = 0.0f;
+      if (length > 0.0f) {
+        float d = axis.dot(_axis) / length;
+        error = Math::acos(d < 1.0f ? d : 1.0f);
+      }
+      else {
+        _cutoff = 1.0f;
+      }
+
+      float angle = Math::asin(_cutoff < 1.0f ? _cutoff : 1.0f) + error;
+      float cutoff = angle < Math::kPI_OVER_2 ? Math::sin(angle) : 1.0f;
+      float scaled = Math::ceil(cutoff * 127.0f);
+      _out[3] = static_cast<int8>(scaled < 127.0f ? scaled : 127.0f);
+    }
+
+    FORCEINLINE void
+    writeUint32(Vector<uint8>& _out, uint32 _value)
+    {
+      for (uint32 i = 0; i < 4; ++i) {
+        _out.push_back(static_cast<uint8>(_value >> (i * 8)));
+      }
+    }
+    FORCEINLINE void
+    writeFloat(Vector<uint8>& _out, float _value)
+    {
+      uint32 bits;
+      std::memcpy(&bits, &_value, sizeof(bits));
+      writeUint32(_out, bits);
+    }
+    FORCEINLINE uint32
+    readUint32(const uint8* _data)
+    {
+      return static_cast<uint32>(_data[0]) |
+             static_cast<uint32>(_data[1]) << 8 |
+             static_cast<uint32>(_data[2]) << 16 |
+             static_cast<uint32>(_data[3]) << 24;
+    }
+    FORCEINLINE float
+    readFloat(const uint8* _data)
+    {
+      uint32 bits = readUint32(_data);
+      float value;
+      std::memcpy(&value, &bits, sizeof(value));
+      return value;
+    }
+  }
+
+  void
+  MeshletMesh::build(const uint32* _indices,
+                     SIZE_T _indexCount,
+                     const Vector3f* _positions,
+                     SIZE_T _stride,
+                     SIZE_T _vertexCount,
+                     uint32 _maxVertices,
+                     uint32 _maxTriangles)
+  {
+    assertm(0 == _indexCount % 3, "The indices must be a triangle list");
+    assertm(_maxVertices >= 3 && _maxVertices <= 255,
+            "A meshlet has from 3 to 255 vertices");
+    assertm(_maxTriangles >= 1 && _maxTriangles <= 255,
+            "A meshlet has from 1 to 255 triangles");
+    clear();
+    SIZE_T triangleCount = _indexCount / 3;
+    const uint8* positionBytes = reinterpret_cast<const uint8*>(_positions);
+    auto position = [positionBytes, _stride](uint32 _vertex) -> const Vector3f& {
+      return *reinterpret_cast<const Vector3f*>(positionBytes + _vertex * _stride);
+    };
+
+    /* The triangles not in a meshlet yet of every vertex, compacted. */
+    Vector<uint32> liveTriangles(_vertexCount, 0);
+    for (SIZE_T i = 0; i < _indexCount; ++i) {
+      ++liveTriangles[_indices[i]];
+    }
+    Vector<uint32> firstTriangle(_vertexCount + 1, 0);
+    for (SIZE_T v = 0; v < _vertexCount; ++v) {
+      firstTriangle[v + 1] = firstTriangle[v] + liveTriangles[v];
+    }
+    Vector<uint32> adjacency(_indexCount);
+    {
+      Vector<uint32> fill(firstTriangle.begin(), firstTriangle.end() - 1);
+      for (SIZE_T i = 0; i < _indexCount; ++i) {
+        adjacency[fill[_indices[i]]++] = static_cast<uint32>(i / 3);
+      }
+    }
+
+    Vector<Vector3f> normals(triangleCount);
+    for (SIZE_T t = 0; t < triangleCount; ++t) {
+      normals[t] = triangleNormal(position(_indices[t * 3]),
+                                  position(_indices[t * 3 + 1]),
+                                  position(_indices[t * 3 + 2]));
+    }
+    Vector<Vector3f> centroids(triangleCount);
+    for (SIZE_T t = 0; t < triangleCount; ++t) {
+      centroids[t] = (position(_indices[t * 3]) + position(_indices[t * 3 + 1]) +
+                      position(_indices[t * 3 + 2])) * (1.0f / 3.0f);
+    }
+    Vector<uint8> emitted(triangleCount, 0);
+    Vector<uint32> localIndex(_vertexCount, kNOT_LOCAL);
+
+    Meshlet meshlet{ 0, 0, 0, 0 };
+    Vector3f positionSum(0.0f, 0.0f, 0.0f);
+    Vector<Vector3f> meshletPositions;
+    Vector<Vector3f> meshletNormals;
+    meshletPositions.reserve(_maxVertices);
+    meshletNormals.reserve(_maxTriangles);
+
+    auto flush = [&]() {
+      MeshletBounds bounds;
+      meshletPositions.clear();
+      for (uint32 i = 0; i < meshlet.vertexCount; ++i) {
+        uint32 vertex = m_vertices[meshlet.vertexOffset + i];
+        meshletPositions.push_back(position(vertex));
+        localIndex[vertex] = kNOT_LOCAL;
+      }
+      bounds.sphere = Sphere::fromPoints(meshletPositions.data(),
+                                         sizeof(Vector3f),
+                                         meshletPositions.size());
+      computeCone(meshletNormals.data(), meshletNormals.size(),
+                  bounds.coneAxis, bounds.coneCutoff);
+      m_meshlets.push_back(meshlet);
+      m_bounds.push_back(bounds);
+
+      meshlet.vertexOffset += meshlet.vertexCount;
+      meshlet.triangleOffset += meshlet.triangleCount;
+      meshlet.vertexCount = 0;
+      meshlet.triangleCount = 0;
+      positionSum = Vector3f(0.0f, 0.0f, 0.0f);
+      meshletNormals.clear();
+    };
+    auto newVertices = [&](uint32 _triangle) -> uint32 {
+      const uint32* tri = &_indices[_triangle * 3];
+      return (kNOT_LOCAL == localIndex[tri[0]] ? 1 : 0) +
+             (kNOT_LOCAL == localIndex[tri[1]] ? 1 : 0) +
+             (kNOT_LOCAL == localIndex[tri[2]] ? 1 : 0);
+    };
+
+    SIZE_T nextUnemitted = 0;
+    for (SIZE_T written = 0; written < triangleCount; ++written) {
+      /*
+       * The neighbour that adds less vertices, then the one with less
+       * triangles left around, closing the corners instead of leaving
+       * lonely triangles for later, then the closest one to the center.
+       */
+      uint32 best = kNOT_LOCAL;
+      uint32 bestNew = 4;
+      uint32 bestLive = 0;
+      float bestDistance = 0.0f;
+      Vector3f center = positionSum * (1.0f / static_cast<float>(meshlet.vertexCount + 1));
+      for (uint32 i = 0; i < meshlet.vertexCount; ++i) {
+        uint32 vertex = m_vertices[meshlet.vertexOffset + i];
+        const uint32* list = &adjacency[firstTriangle[vertex]];
+        for (uint32 j = 0; j < liveTriangles[vertex]; ++j) {
+          uint32 t = list[j];
+          const uint32* tri = &_indices[t * 3];
+          uint32 added = newVertices(t);
+          if (meshlet.vertexCount + added > _maxVertices || added > bestNew) {
+            continue;
+          }
+          uint32 live = liveTriangles[tri[0]] + liveTriangles[tri[1]] +
+                        liveTriangles[tri[2]];
+          if (added == bestNew && live > bestLive) {
+            continue;
+          }
+          Vector3f offset = centroids[t] - center;
+          float distance = offset.dot(offset);
+          if (added < bestNew || live < bestLive || distance < bestDistance) {
+            best = t;
+            bestNew = added;
+            bestLive = live;
+            bestDistance = distance;
+          }
+        }
+      }
+
+      /*
+       * No neighbour fits, the next one in the input order starts a new
+       * meshlet or goes on this one if it fits.
+       */
+      if (kNOT_LOCAL == best) {
+        while (emitted[nextUnemitted]) {
+          ++nextUnemitted;
+        }
+        best = static_cast<uint32>(nextUnemitted);
+        if (meshlet.vertexCount + newVertices(best) > _maxVertices) {
+          flush();
+        }
+      }
+
+      const uint32* tri = &_indices[best * 3];
+      for (uint32 k = 0; k < 3; ++k) {
+        uint32 vertex = tri[k];
+        if (kNOT_LOCAL == localIndex[vertex]) {
+          localIndex[vertex] = meshlet.vertexCount++;
+          positionSum = positionSum + position(vertex);
+          m_vertices.push_back(vertex);
+        }
+        m_triangles.push_back(static_cast<uint8>(localIndex[vertex]));
+
+        uint32* list = &adjacency[firstTriangle[vertex]];
+        uint32 count = liveTriangles[vertex];
+        for (uint32 i = 0; i < count; ++i) {
+          if (list[i] == best) {
+            list[i] = list[count - 1];
+            break;
+          }
+        }
+        --liveTriangles[vertex];
+      }
+      ++meshlet.triangleCount;
+      emitted[best] = 1;
+      meshletNormals.push_back(normals[best]);
+
+      if (meshlet.triangleCount == _maxTriangles) {
+        flush();
+      }
+    }
+    if (meshlet.triangleCount > 0) {
+      flush();
+    }
+  }
+
+  SIZE_T
+  MeshletMesh::cullBackfacing(const Vector3f& _cameraPosition,
+                              uint32* _visible) const
+  {
+    SIZE_T count = 0;
+    for (SIZE_T i = 0; i < m_bounds.size(); ++i) {
+      if (!isBackfacing(m_bounds[i], _cameraPosition)) {
+        _visible[count++] = static_cast<uint32>(i);
+      }
+    }
+    return count;
+  }
+
+  void
+  MeshletMesh::serialize(Vector<uint8>& _out) const
+  {
+    uint32 maxVertex = 0;
+    for (uint32 vertex : m_vertices) {
+      maxVertex = vertex > maxVertex ? vertex : maxVertex;
+    }
+    uint8 indexSize = maxVertex <= 0xFFFFu ? 2 : 4;
+
+    _out.reserve(_out.size() + kHEADER_SIZE + m_meshlets.size() * 2 +
+                 m_bounds.size() * kBOUNDS_SIZE +
+                 m_vertices.size() * indexSize + m_triangles.size());
+    _out.insert(_out.end(), kMAGIC, kMAGIC + 4);
+    writeUint32(_out, kFORMAT_VERSION);
+    writeUint32(_out, static_cast<uint32>(m_meshlets.size()));
+    writeUint32(_out, static_cast<uint32>(m_vertices.size()));
+    writeUint32(_out, static_cast<uint32>(m_triangles.size() / 3));
+    _out.push_back(indexSize);
+
+    for (const Meshlet& meshlet : m_meshlets) {
+      _out.push_back(static_cast<uint8>(meshlet.vertexCount));
+      _out.push_back(static_cast<uint8>(meshlet.triangleCount));
+    }
+    for (const MeshletBounds& bounds : m_bounds) {
+      const Vector3f& center = bounds.sphere.getCenter();
+      writeFloat(_out, center.x);
+      writeFloat(_out, center.y);
+      writeFloat(_out, center.z);
+      writeFloat(_out, bounds.sphere.getRadious());
+      int8 cone[4];
+      quantizeCone(bounds.coneAxis, bounds.coneCutoff, cone);
+      for (uint32 i = 0; i < 4; ++i) {
+        _out.push_back(static_cast<uint8>(cone[i]));
+      }
+    }
+    for (uint32 vertex : m_vertices) {
+      for (uint32 i = 0; i < indexSize; ++i) {
+        _out.push_back(static_cast<uint8>(vertex >> (i * 8)));
+      }
+    }
+    _out.insert(_out.end(), m_triangles.begin(), m_triangles.end());
+  }
+
+  bool
+  MeshletMesh::deserialize(const uint8* _data, SIZE_T _size)
+  {
+    clear();
+    if (_size < kHEADER_SIZE || 0 != std::memcmp(_data, kMAGIC, 4) ||
+        kFORMAT_VERSION != readUint32(_data + 4)) {
+      return false;
+    }
+    SIZE_T meshletCount = readUint32(_data + 8);
+    SIZE_T vertexCount = readUint32(_data + 12);
+    SIZE_T triangleCount = readUint32(_data + 16);
+    uint8 indexSize = _data[20];
+    if (2 != indexSize && 4 != indexSize) {
+      return false;
+    }
+    SIZE_T expected = kHEADER_SIZE + meshletCount * (2 + kBOUNDS_SIZE) +
+                      vertexCount * indexSize + triangleCount * 3;
+    if (_size < expected) {
+      return false;
+    }
+
+    const uint8* data = _data + kHEADER_SIZE;
+    m_meshlets.resize(meshletCount);
+    Meshlet meshlet{ 0, 0, 0, 0 };
+    for (SIZE_T i = 0; i < meshletCount; ++i) {
+      meshlet.vertexOffset += meshlet.vertexCount;
+      meshlet.triangleOffset += meshlet.triangleCount;
+      meshlet.vertexCount = data[i * 2];
+      meshlet.triangleCount = data[i * 2 + 1];
+      m_meshlets[i] = meshlet;
+    }
+    if (meshlet.vertexOffset + meshlet.vertexCount != vertexCount ||
+        meshlet.triangleOffset + meshlet.triangleCount != triangleCount) {
+      clear();
+      return false;
+    }
+    data += meshletCount * 2;
+
+    m_bounds.resize(meshletCount);
+    for (SIZE_T i = 0; i < meshletCount; ++i, data += kBOUNDS_SIZE) {
+      MeshletBounds& bounds = m_bounds[i];
+      bounds.sphere = Sphere(Vector3f(readFloat(data), readFloat(data + 4),
+                                      readFloat(data + 8)),
+                             readFloat(data + 12));
+      const int8* cone = reinterpret_cast<const int8*>(data + 16);
+      Vector3f axis(cone[0] / 127.0f, cone[1] / 127.0f, cone[2] / 127.0f);
+      float length = axis.getMagnitude();
+      bounds.coneAxis = length > 0.0f ? axis * (1.0f / length) : axis;
+      bounds.coneCutoff = length > 0.0f ? cone[3] / 127.0f : 1.0f;
+    }
+
+    m_vertices.resize(vertexCount);
+    for (SIZE_T i = 0; i < vertexCount; ++i, data += indexSize) {
+      m_vertices[i] = 2 == indexSize ?
+                      static_cast<uint32>(data[0]) | static_cast<uint32>(data[1]) << 8 :
+                      readUint32(data);
+    }
+    m_triangles.assign(data, data + triangleCount * 3);
+
+    /* The local indices must stay inside the vertices of their meshlet. */
+    for (const Meshlet& local : m_meshlets) {
+      const uint8* indices = m_triangles.data() + local.triangleOffset * 3;
+      for (SIZE_T i = 0; i < local.triangleCount * 3; ++i) {
+        if (indices[i] >= local.vertexCount) {
+          clear();
+          return false;
+        }
+      }
+    }
+    return true;
+  }
+
+  void
+  MeshletMesh::clear()
+  {
+    m_meshlets.clear();
+    m_bounds.clear();
+    m_vertices.clear();
+    m_triangles.clear();
+  }
+}
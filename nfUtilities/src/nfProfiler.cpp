@@ -0,0 +1,427 @@
+#include "nfProfiler.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include "nfStringConversion.h"
+
+namespace nfEngineSDK
+{
+  namespace {
+    /*
+     * The ring buffer of a thread. Only its thread writes the events and
+     * moves the head, only endFrame() moves the tail.
+     */
+    struct ThreadBuffer
+    {
+      Vector<ProfileEvent> events = Vector<ProfileEvent>(Profiler::kEVENTS_PER_THREAD);
+      std::atomic<uint64> head{ 0 };
+      std::atomic<uint64> tail{ 0 };
+      std::atomic<uint64> dropped{ 0 };
+      /* Set when the thread ends, the buffer is given to the next thread. */
+      std::atomic<bool> retired{ false };
+      /* The scopes open, only used by the thread. */
+      uint32 depth = 0;
+      uint32 index = 0;
+      String name;
+    };
+
+    struct Registry
+    {
+      std::mutex mutex;
+      Vector<SPtr<ThreadBuffer>> threads;
+      /* The capture. */
+      Vector<ProfileEvent> events;
+      Vector<uint64> frameEnds;
+      Vector<ProfileNode> lastFrame;
+      uint64 captureStart = 0;
+      uint32 framesLeft = 0;
+    };
+
+    /*
+     * Never destroyed, the threads can still end scopes while the statics
+     * are destroyed.
+     */
+    Registry&
+    getRegistry()
+    {
+      static Registry* registry = new Registry();
+      return *registry;
+    }
+
+    NF_THREADLOCAL ThreadBuffer* t_buffer = nullptr;
+
+    /*
+     * Retires the buffer of a thread when it ends, so the threads made and
+     * destroyed all the time don't keep a buffer each. The events use the
+     * plain pointer, this only exists for its destructor.
+     */
+    struct ThreadRetire
+    {
+      ~ThreadRetire()
+      {
+        if (nullptr != t_buffer) {
+          t_buffer->retired.store(true, std::memory_order_release);
+          t_buffer = nullptr;
+        }
+      }
+    };
+
+    ThreadBuffer*
+    getThreadBuffer()
+    {
+      ThreadBuffer* buffer = t_buffer;
+      if (nullptr != buffer) {
+        return buffer;
+      }
+
+      static thread_local ThreadRetire retire;
+      (void)retire;
+
+      Registry& registry = getRegistry();
+      std::lock_guard<std::mutex> lock(registry.mutex);
+      /* A retired buffer is taken once endFrame() has taken its events. */
+      for (const SPtr<ThreadBuffer>& thread : registry.threads) {
+        if (thread->retired.load(std::memory_order_acquire) &&
+            thread->head.load(std::memory_order_relaxed) ==
+            thread->tail.load(std::memory_order_relaxed)) {
+          buffer = thread.get();
+          buffer->retired.store(false, std::memory_order_relaxed);
+          buffer->depth = 0;
+          buffer->name.clear();
+          break;
+        }
+      }
+      if (nullptr == buffer) {
+        SPtr<ThreadBuffer> created = std::make_shared<ThreadBuffer>();
+        created->index = static_cast<uint32>(registry.threads.size());
+        registry.threads.push_back(created);
+        buffer = created.get();
+      }
+      t_buffer = buffer;
+      return buffer;
+    }
+
+    /*
+     * A node of the frame tree while it is built.
+     */
+    struct BuildNode
+    {
+      ProfileNode node;
+      Vector<uint32> children;
+    };
+
+    /*
+     * Finds the child of _parent (or the root of the thread) with the name of
+     * the event, adding it if there is none.
+     */
+    uint32
+    findChild(Vector<BuildNode>& _nodes,
+              Vector<uint32>& _roots,
+              uint32 _parent,
+              const ProfileEvent& _event)
+    {
+      Vector<uint32>& children = ProfileNode::kNO_PARENT == _parent ?
+                                 _roots : _nodes[_parent].children;
+      for (uint32 child : children) {
+        if (0 == std::strcmp(_nodes[child].node.name, _event.name)) {
+          return child;
+        }
+      }
+      /* Added to the children before _nodes grows and moves them. */
+      uint32 index = static_cast<uint32>(_nodes.size());
+      children.push_back(index);
+      BuildNode created;
+      created.node = ProfileNode{ _event.name, _parent, _event.depth,
+                                  _event.thread, 0, 0.0 };
+      _nodes.push_back(std::move(created));
+      return index;
+    }
+
+    void
+    flatten(const Vector<BuildNode>& _nodes,
+            uint32 _index,
+            uint32 _parent,
+            Vector<ProfileNode>& _out)
+    {
+      uint32 index = static_cast<uint32>(_out.size());
+      _out.push_back(_nodes[_index].node);
+      _out.back().parent = _parent;
+      for (uint32 child : _nodes[_index].children) {
+        flatten(_nodes, child, index, _out);
+      }
+    }
+
+    /*
+     * Adds up the events of a frame by their path of names, per thread.
+     */
+    Vector<ProfileNode>
+    aggregate(Vector<ProfileEvent> _events)
+    {
+      std::sort(_events.begin(), _events.end(),
+                [](const ProfileEvent& _a, const ProfileEvent& _b) {
+                  if (_a.thread != _b.thread) {
+                    return _a.thread < _b.thread;
+                  }
+                  if (_a.begin != _b.begin) {
+                    return _a.begin < _b.begin;
+                  }
+                  return _a.depth < _b.depth;
+                });
+
+      Vector<BuildNode> nodes;
+      Vector<uint32> roots;
+      /* The roots of the thread being built, only they merge by name. */
+      Vector<uint32> threadRoots;
+      Vector<uint32> stack;
+      uint32 thread = ProfileNode::kNO_PARENT;
+      for (const ProfileEvent& event : _events) {
+        if (event.thread != thread) {
+          thread = event.thread;
+          roots.insert(roots.end(), threadRoots.begin(), threadRoots.end());
+          threadRoots.clear();
+          stack.clear();
+        }
+        while (!stack.empty() && nodes[stack.back()].node.depth >= event.depth) {
+          stack.pop_back();
+        }
+
+        uint32 parent = stack.empty() ? ProfileNode::kNO_PARENT : stack.back();
+        uint32 index = findChild(nodes, threadRoots, parent, event);
+        ProfileNode& node = nodes[index].node;
+        ++node.calls;
+        node.seconds += Time::toSeconds(event.end - event.begin);
+        stack.push_back(index);
+      }
+
+      roots.insert(roots.end(), threadRoots.begin(), threadRoots.end());
+
+      Vector<ProfileNode> flat;
+      flat.reserve(nodes.size());
+      for (uint32 root : roots) {
+        flatten(nodes, root, ProfileNode::kNO_PARENT, flat);
+      }
+      return flat;
+    }
+
+    /*
+     * Writes a name as a JSON string.
+     */
+    void
+    writeJSONString(TextWriter& _writer, const char* _text)
+    {
+      _writer.write("\"", 1);
+      for (const char* c = _text; 0 != *c; ++c) {
+        if ('"' == *c || '\\' == *c) {
+          _writer.write("\\", 1);
+        }
+        if (static_cast<uint8>(*c) >= 0x20) {
+          _writer.write(c, 1);
+        }
+      }
+      _writer.write("\"", 1);
+    }
+
+    /*
+     * Writes ticks as the microseconds of the trace, with 3 decimals.
+     */
+    void
+    writeMicroseconds(TextWriter& _writer, uint64 _ticks)
+    {
+      uint64 nanoseconds = static_cast<uint64>(Time::toSeconds(_ticks) * 1e9);
+      _writer.write(nanoseconds / 1000);
+      uint32 fraction = static_cast<uint32>(nanoseconds % 1000);
+      char digits[4] = { '.',
+                         static_cast<char>('0' + fraction / 100),
+                         static_cast<char>('0' + fraction / 10 % 10),
+                         static_cast<char>('0' + fraction % 10) };
+      _writer.write(digits, 4);
+    }
+
+    void
+    writeEvent(TextWriter& _writer,
+               const char* _name,
+               uint32 _thread,
+               uint64 _begin,
+               uint64 _end)
+    {
+      _writer.write(",\n{\"name\":");
+      writeJSONString(_writer, _name);
+      _writer.write(",\"ph\":\"X\",\"pid\":0,\"tid\":");
+      _writer.write(_thread);
+      _writer.write(",\"ts\":");
+      writeMicroseconds(_writer, _begin);
+      _writer.write(",\"dur\":");
+      writeMicroseconds(_writer, _end - _begin);
+      _writer.write("}");
+    }
+  }
+
+  std::atomic<bool> Profiler::s_capturing{ false };
+
+  void
+  Profiler::beginCapture(uint32 _frames)
+  {
+    Registry& registry = getRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    /* The events recorded before the capture are not part of it. */
+    for (const SPtr<ThreadBuffer>& thread : registry.threads) {
+      thread->tail.store(thread->head.load(std::memory_order_acquire),
+                         std::memory_order_release);
+    }
+    registry.events.clear();
+    registry.frameEnds.clear();
+    registry.lastFrame.clear();
+    registry.captureStart = Time::now();
+    registry.framesLeft = _frames;
+    s_capturing.store(true, std::memory_order_relaxed);
+  }
+
+  void
+  Profiler::endCapture()
+  {
+    s_capturing.store(false, std::memory_order_relaxed);
+  }
+
+  void
+  Profiler::endFrame()
+  {
+    Registry& registry = getRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    uint64 frameEnd = Time::now();
+    bool capturing = isCapturing();
+
+    SIZE_T frameStart = registry.events.size();
+    for (const SPtr<ThreadBuffer>& thread : registry.threads) {
+      uint64 tail = thread->tail.load(std::memory_order_relaxed);
+      uint64 head = thread->head.load(std::memory_order_acquire);
+      if (capturing) {
+        for (uint64 i = tail; i < head; ++i) {
+          registry.events.push_back(thread->events[i & (kEVENTS_PER_THREAD - 1)]);
+        }
+      }
+      thread->tail.store(head, std::memory_order_release);
+    }
+    if (!capturing) {
+      return;
+    }
+
+    registry.frameEnds.push_back(frameEnd);
+    registry.lastFrame = aggregate(Vector<ProfileEvent>(registry.events.begin() + frameStart,
+                                                        registry.events.end()));
+    if (0 != registry.framesLeft && 0 == --registry.framesLeft) {
+      s_capturing.store(false, std::memory_order_relaxed);
+    }
+  }
+
+  void
+  Profiler::setThreadName(const String& _name)
+  {
+    ThreadBuffer* buffer = getThreadBuffer();
+    std::lock_guard<std::mutex> lock(getRegistry().mutex);
+    buffer->name = _name;
+  }
+
+  Vector<ProfileNode>
+  Profiler::getLastFrame()
+  {
+    Registry& registry = getRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    return registry.lastFrame;
+  }
+
+  Vector<ProfileEvent>
+  Profiler::getEvents()
+  {
+    Registry& registry = getRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    return registry.events;
+  }
+
+  uint64
+  Profiler::getDroppedEvents()
+  {
+    Registry& registry = getRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    uint64 dropped = 0;
+    for (const SPtr<ThreadBuffer>& thread : registry.threads) {
+      dropped += thread->dropped.load(std::memory_order_relaxed);
+    }
+    return dropped;
+  }
+
+  bool
+  Profiler::exportChromeTrace(const String& _path)
+  {
+    OFStream file(_path, std::ios::binary | std::ios::trunc);
+    if (!file) {
+      return false;
+    }
+
+    Registry& registry = getRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    uint64 start = registry.captureStart;
+    /* The frames go on a track of their own, after the threads. */
+    uint32 frameTrack = static_cast<uint32>(registry.threads.size());
+    {
+      TextWriter writer(file);
+      writer.write("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n");
+      writer.write("{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":");
+      writer.write(frameTrack);
+      writer.write(",\"args\":{\"name\":\"Frames\"}}");
+      for (const SPtr<ThreadBuffer>& thread : registry.threads) {
+        if (thread->name.empty()) {
+          continue;
+        }
+        writer.write(",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":");
+        writer.write(thread->index);
+        writer.write(",\"args\":{\"name\":");
+        writeJSONString(writer, thread->name.c_str());
+        writer.write("}}");
+      }
+
+      uint64 frameBegin = start;
+      for (uint64 frameEnd : registry.frameEnds) {
+        writeEvent(writer, "Frame", frameTrack, frameBegin - start, frameEnd - start);
+        frameBegin = frameEnd;
+      }
+      for (const ProfileEvent& event : registry.events) {
+        /* Scopes that started before the capture are cut to its start. */
+        uint64 begin = event.begin > start ? event.begin - start : 0;
+        uint64 end = event.end > start ? event.end - start : 0;
+        writeEvent(writer, event.name, event.thread, begin, end);
+      }
+      writer.write("\n]}\n");
+    }
+    return static_cast<bool>(file);
+  }
+
+  uint64
+  Profiler::enterScope()
+  {
+    ++getThreadBuffer()->depth;
+    return Time::now();
+  }
+
+  void
+  Profiler::exitScope(const char* _name, uint64 _begin)
+  {
+    uint64 end = Time::now();
+    /* enterScope() made the buffer. */
+    ThreadBuffer* buffer = getThreadBuffer();
+    uint32 depth = --buffer->depth;
+
+    uint64 head = buffer->head.load(std::memory_order_relaxed);
+    if (head - buffer->tail.load(std::memory_order_acquire) >= kEVENTS_PER_THREAD) {
+      buffer->dropped.fetch_add(1, std::memory_order_relaxed);
+      return;
+    }
+    ProfileEvent& event = buffer->events[head & (kEVENTS_PER_THREAD - 1)];
+    event.name = _name;
+    event.begin = _begin;
+    event.end = end;
+    event.depth = depth;
+    event.thread = buffer->index;
+    buffer->head.store(head + 1, std::memory_order_release);
+  }
+}
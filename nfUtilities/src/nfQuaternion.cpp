@@ -0,0 +1,138 @@
+#include "nfQuaternion.h"
+
+#include "nfMatrix4.h"
+#include "nfMath.h"
+
+namespace nfEngineSDK
+{
+  const Quaternion Quaternion::kIDENTITY = Quaternion(0.0f, 0.0f, 0.0f, 1.0f);
+
+  Quaternion::Quaternion(const Matrix4f& _matrix)
+  {
+    /*
+     * Takes the square root of the biggest of w, x, y, z so the division
+     * never goes near 0.
+     */
+    const Matrix4f& m = _matrix;
+    float trace = m.m_00 + m.m_11 + m.m_22;
+    if (trace > 0.0f) {
+      float s = Math::sqrt(trace + 1.0f) * 2.0f;
+      w = 0.25f * s;
+      x = (m.m_21 - m.m_12) / s;
+      y = (m.m_02 - m.m_20) / s;
+      z = (m.m_10 - m.m_01) / s;
+    }
+    else if (m.m_00 > m.m_11 && m.m_00 > m.m_22) {
+      float s = Math::sqrt(1.0f + m.m_00 - m.m_11 - m.m_22) * 2.0f;
+      w = (m.m_21 - m.m_12) / s;
+      x = 0.25f * s;
+      y = (m.m_01 + m.m_10) / s;
+      z = (m.m_02 + m.m_20) / s;
+    }
+    else if (m.m_11 > m.m_22) {
+      float s = Math::sqrt(1.0f + m.m_11 - m.m_00 - m.m_22) * 2.0f;
+      w = (m.m_02 - m.m_20) / s;
+      x = (m.m_01 + m.m_10) / s;
+      y = 0.25f * s;
+      z = (m.m_12 + m.m_21) / s;
+    }
+    else {
+      float s = Math::sqrt(1.0f + m.m_22 - m.m_00 - m.m_11) * 2.0f;
+      w = (m.m_10 - m.m_01) / s;
+      x = (m.m_02 + m.m_20) / s;
+      y = (m.m_12 + m.m_21) / s;
+      z = 0.25f * s;
+    }
+  }
+
+  Quaternion
+  Quaternion::fromAxisAngle(const Vector3f& _axis, float _angle)
+  {
+    float s = Math::sin(_angle * 0.5f);
+    return Quaternion(_axis.x * s, _axis.y * s, _axis.z * s,
+                      Math::cos(_angle * 0.5f));
+  }
+
+  float
+  Quaternion::getMagnitude() const
+  {
+    return Math::sqrt(dot(*this));
+  }
+  Quaternion
+  Quaternion::getNormalized() const
+  {
+    return *this * (1.0f / getMagnitude());
+  }
+  Quaternion&
+  Quaternion::normalize()
+  {
+    *this = getNormalized();
+    return *this;
+  }
+  Quaternion
+  Quaternion::getInverse() const
+  {
+    return getConjugate() * (1.0f / dot(*this));
+  }
+
+  Vector3f
+  Quaternion::rotate(const Vector3f& _v) const
+  {
+    /* v + 2 q.xyz x (q.xyz x v + w v) */
+    Vector3f q(x, y, z);
+    Vector3f t = q.cross(_v) + _v * w;
+    return _v + q.cross(t) * 2.0f;
+  }
+  Matrix4f
+  Quaternion::toMatrix4() const
+  {
+    float xx = x * x, yy = y * y, zz = z * z;
+    float xy = x * y, xz = x * z, yz = y * z;
+    float wx = w * x, wy = w * y, wz = w * z;
+    return Matrix4f(1.0f - 2.0f * (yy + zz), 2.0f * (xy - wz), 2.0f * (xz + wy), 0.0f,
+                    2.0f * (xy + wz), 1.0f - 2.0f * (xx + zz), 2.0f * (yz - wx), 0.0f,
+                    2.0f * (xz - wy), 2.0f * (yz + wx), 1.0f - 2.0f * (xx + yy), 0.0f,
+                    0.0f, 0.0f, 0.0f, 1.0f);
+  }
+
+  Quaternion
+  Quaternion::nlerp(const Quaternion& _a, const Quaternion& _b, float _t)
+  {
+    Quaternion b = _a.dot(_b) < 0.0f ? -_b : _b;
+    return (_a + (b - _a) * _t).getNormalized();
+  }
+  Quaternion
+  Quaternion::slerp(const Quaternion& _a, const Quaternion& _b, float _t)
+  {
+    float cosTheta = _a.dot(_b);
+    Quaternion b = _b;
+    if (cosTheta < 0.0f) {
+      b = -_b;
+      cosTheta = -cosTheta;
+    }
+    /* Almost the same rotation, the sine below would divide by 0. */
+    if (cosTheta > 0.9995f) {
+      return nlerp(_a, b, _t);
+    }
+    float theta = Math::acos(cosTheta);
+    float invSin = 1.0f / Math::sin(theta);
+    return _a * (Math::sin((1.0f - _t) * theta) * invSin) +
+           b * (Math::sin(_t * theta) * invSin);
+  }
+
+  Quaternion
+  Quaternion::operator*(const Quaternion& other) const
+  {
+    return Quaternion(w * other.x + x * other.w + y * other.z - z * other.y,
+                      w * other.y - x * other.z + y * other.w + z * other.x,
+                      w * other.z + x * other.y - y * other.x + z * other.w,
+                      w * other.w - x * other.x - y * other.y - z * other.z);
+  }
+
+  bool
+  Quaternion::operator==(const Quaternion& other) const
+  {
+    return Math::checkEqual(x, other.x) && Math::checkEqual(y, other.y) &&
+           Math::checkEqual(z, other.z) && Math::checkEqual(w, other.w);
+  }
+}
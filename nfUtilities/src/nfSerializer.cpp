@@ -0,0 +1,263 @@
+#include "nfSerializer.h"
+
+#if NF_SIMD_AVX2
+# include <immintrin.h>
+#elif NF_SIMD_SSE2
+# include <emmintrin.h>
+#endif
+
+namespace nfEngineSDK
+{
+  namespace {
+    FORCEINLINE uint16
+    reverse16(uint16 _value)
+    {
+      return static_cast<uint16>((_value << 8) | (_value >> 8));
+    }
+    FORCEINLINE uint32
+    reverse32(uint32 _value)
+    {
+      return (_value << 24) | ((_value << 8) & 0x00FF0000u) |
+             ((_value >> 8) & 0x0000FF00u) | (_value >> 24);
+    }
+    FORCEINLINE uint64
+    reverse64(uint64 _value)
+    {
+      return (static_cast<uint64>(reverse32(static_cast<uint32>(_value))) << 32) |
+             reverse32(static_cast<uint32>(_value >> 32));
+    }
+
+    /*
+     * The scalar tail, through memcpy so the values can be unaligned.
+     */
+    template<class T, T(*reverse)(T)>
+    void
+    swapTail(uint8* _bytes, SIZE_T _count)
+    {
+      for (SIZE_T i = 0; i < _count; ++i, _bytes += sizeof(T)) {
+        T value;
+        std::memcpy(&value, _bytes, sizeof(T));
+        value = reverse(value);
+        std::memcpy(_bytes, &value, sizeof(T));
+      }
+    }
+
+#if NF_SIMD_AVX2
+    template<SIZE_T size>
+    SIZE_T
+    swapVectors(uint8* _bytes, SIZE_T _count)
+    {
+      static const __m256i mask = size == 2 ?
+        _mm256_setr_epi8(1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14,
+                         1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14) :
+        size == 4 ?
+        _mm256_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12,
+                         3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12) :
+        _mm256_setr_epi8(7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8,
+                         7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8);
+      const SIZE_T perVector = 32 / size;
+      SIZE_T vectors = _count / perVector;
+      for (SIZE_T i = 0; i < vectors; ++i, _bytes += 32) {
+        __m256i* p = reinterpret_cast<__m256i*>(_bytes);
+        _mm256_storeu_si256(p, _mm256_shuffle_epi8(_mm256_loadu_si256(p), mask));
+      }
+      return vectors * perVector;
+    }
+#elif NF_SIMD_SSE2
+    /*
+     * SSE2 has no byte shuffle, the bytes are swapped with shifts inside the
+     * 16 bits lanes and the lanes with shuffles.
+     */
+    template<SIZE_T size>
+    SIZE_T
+    swapVectors(uint8* _bytes, SIZE_T _count)
+    {
+      const SIZE_T perVector = 16 / size;
+      SIZE_T vectors = _count / perVector;
+      for (SIZE_T i = 0; i < vectors; ++i, _bytes += 16) {
+        __m128i* p = reinterpret_cast<__m128i*>(_bytes);
+        __m128i v = _mm_loadu_si128(p);
+        v = _mm_or_si128(_mm_slli_epi16(v, 8), _mm_srli_epi16(v, 8));
+        if (size >= 4) {
+          v = _mm_shufflelo_epi16(v, _MM_SHUFFLE(2, 3, 0, 1));
+          v = _mm_shufflehi_epi16(v, _MM_SHUFFLE(2, 3, 0, 1));
+        }
+        if (size == 8) {
+          v = _mm_shuffle_epi32(v, _MM_SHUFFLE(2, 3, 0, 1));
+        }
+        _mm_storeu_si128(p, v);
+      }
+      return vectors * perVector;
+    }
+#else
+    template<SIZE_T size>
+    SIZE_T
+    swapVectors(uint8*, SIZE_T)
+    {
+      return 0;
+    }
+#endif
+  }
+
+  void
+  ByteSwap::swap16(void* _data, SIZE_T _count)
+  {
+    uint8* bytes = static_cast<uint8*>(_data);
+    SIZE_T done = swapVectors<2>(bytes, _count);
+    swapTail<uint16, reverse16>(bytes + done * 2, _count - done);
+  }
+
+  void
+  ByteSwap::swap32(void* _data, SIZE_T _count)
+  {
+    uint8* bytes = static_cast<uint8*>(_data);
+    SIZE_T done = swapVectors<4>(bytes, _count);
+    swapTail<uint32, reverse32>(bytes + done * 4, _count - done);
+  }
+
+  void
+  ByteSwap::swap64(void* _data, SIZE_T _count)
+  {
+    uint8* bytes = static_cast<uint8*>(_data);
+    SIZE_T done = swapVectors<8>(bytes, _count);
+    swapTail<uint64, reverse64>(bytes + done * 8, _count - done);
+  }
+
+  uint8*
+  Serializer::reserveBytes(SIZE_T _size)
+  {
+    SIZE_T position = m_buffer.size();
+    m_buffer.resize(position + _size);
+    return m_buffer.data() + position;
+  }
+
+  void
+  Serializer::write(const String& _value)
+  {
+    write(static_cast<uint64>(_value.size()));
+    writeBytes(_value.data(), _value.size());
+  }
+
+  void
+  Serializer::writeBytes(const void* _data, SIZE_T _size)
+  {
+    if (0 != _size) {
+      std::memcpy(reserveBytes(_size), _data, _size);
+    }
+  }
+
+  void
+  Serializer::beginObject(uint32 _version)
+  {
+    write(_version);
+    m_objects.push_back(m_buffer.size());
+    write(static_cast<uint32>(0));
+  }
+
+  void
+  Serializer::endObject()
+  {
+    assertm(!m_objects.empty(), "endObject without beginObject");
+    SIZE_T sizePosition = m_objects.back();
+    m_objects.pop_back();
+    SIZE_T size = m_buffer.size() - sizePosition - sizeof(uint32);
+    assertm(size <= 0xFFFFFFFFu, "Objects are up to 4 GB");
+    uint32 size32 = static_cast<uint32>(size);
+#if NF_ENDIAN != NF_ENDIAN_LITTLE
+    size32 = reverse32(size32);
+#endif
+    std::memcpy(&m_buffer[sizePosition], &size32, sizeof(size32));
+  }
+
+  void
+  Serializer::clear()
+  {
+    m_buffer.clear();
+    m_objects.clear();
+  }
+
+  bool
+  Serializer::saveToFile(const String& _path) const
+  {
+    OFStream file(_path, std::ios::binary | std::ios::trunc);
+    if (!file) {
+      return false;
+    }
+    file.write(reinterpret_cast<const char*>(m_buffer.data()),
+               static_cast<std::streamsize>(m_buffer.size()));
+    return static_cast<bool>(file);
+  }
+
+  const uint8*
+  Deserializer::takeBytes(SIZE_T _size)
+  {
+    if (!m_valid || _size > m_end - m_position) {
+      fail();
+      return nullptr;
+    }
+    const uint8* bytes = m_data + m_position;
+    m_position += _size;
+    return bytes;
+  }
+
+  bool
+  Deserializer::fail()
+  {
+    m_valid = false;
+    return false;
+  }
+
+  bool
+  Deserializer::read(String& _value)
+  {
+    uint64 size = 0;
+    if (!read(size)) {
+      return false;
+    }
+    const uint8* bytes = takeBytes(static_cast<SIZE_T>(size));
+    if (nullptr == bytes) {
+      return false;
+    }
+    _value.assign(reinterpret_cast<const char*>(bytes), static_cast<SIZE_T>(size));
+    return true;
+  }
+
+  bool
+  Deserializer::readBytes(void* _out, SIZE_T _size)
+  {
+    const uint8* bytes = takeBytes(_size);
+    if (nullptr == bytes) {
+      return false;
+    }
+    if (0 != _size) {
+      std::memcpy(_out, bytes, _size);
+    }
+    return true;
+  }
+
+  uint32
+  Deserializer::beginObject()
+  {
+    uint32 version = 0;
+    uint32 size = 0;
+    m_objects.push_back(m_end);
+    if (!read(version) || !read(size) || size > getRemaining()) {
+      fail();
+      return 0;
+    }
+    m_end = m_position + size;
+    return version;
+  }
+
+  void
+  Deserializer::endObject()
+  {
+    assertm(!m_objects.empty(), "endObject without beginObject");
+    /* Skips the fields of newer versions. */
+    if (m_valid) {
+      m_position = m_end;
+    }
+    m_end = m_objects.back();
+    m_objects.pop_back();
+  }
+}
@@ -0,0 +1,163 @@
+#include "nfSkinning.h"
+
+#include "nfBatchMath.h"
+
+namespace nfEngineSDK
+{
+  void
+  Skinning::preparePalette(const Matrix4f* _bones,
+                           SkinningMatrix* _palette,
+                           SIZE_T _count)
+  {
+    for (SIZE_T i = 0; i < _count; ++i) {
+      _palette[i] = SkinningMatrix(_bones[i]);
+    }
+  }
+
+  void
+  Skinning::preparePalette(const Matrix4f* _bones,
+                           SkinningDualQuaternion* _palette,
+                           SIZE_T _count)
+  {
+    for (SIZE_T i = 0; i < _count; ++i) {
+      _palette[i] = SkinningDualQuaternion(_bones[i]);
+    }
+  }
+
+  void
+  Skinning::skin(const SkinningMatrix* _palette,
+                 const SimpleAnimVertex* _in,
+                 Vector3f* _positions,
+                 Vector3f* _normals,
+                 SIZE_T _count,
+                 uint32 _threads)
+  {
+    if (0 == _count) {
+      return;
+    }
+    Streams streams{};
+    streams.positions = &_in[0].position.x;
+    streams.normals = &_in[0].normal.x;
+    streams.indices = _in[0].boneIndices.data();
+    streams.weights = _in[0].boneWeights.data();
+    streams.stride = sizeof(SimpleAnimVertex);
+    Outputs outputs{ _positions, _normals, nullptr, nullptr };
+    run(BatchMath::getKernels().skinLinear[3], _palette, streams, outputs, _count, _threads);
+  }
+
+  void
+  Skinning::skin(const SkinningMatrix* _palette,
+                 const ComplexAnimVertex* _in,
+                 Vector3f* _positions,
+                 Vector3f* _normals,
+                 Vector3f* _tangents,
+                 Vector3f* _binormals,
+                 SIZE_T _count,
+                 uint32 _threads)
+  {
+    if (0 == _count) {
+      return;
+    }
+    Streams streams{};
+    streams.positions = &_in[0].position.x;
+    streams.normals = &_in[0].normal.x;
+    streams.tangents = &_in[0].tangent.x;
+    streams.binormals = &_in[0].binormal.x;
+    streams.indices = _in[0].boneIndices.data();
+    streams.weights = _in[0].boneWeights.data();
+    streams.stride = sizeof(ComplexAnimVertex);
+    Outputs outputs{ _positions, _normals, _tangents, _binormals };
+    run(BatchMath::getKernels().skinLinearTangents, _palette, streams, outputs, _count,
+        _threads);
+  }
+
+  void
+  Skinning::skin(const SkinningDualQuaternion* _palette,
+                 const SimpleAnimVertex* _in,
+                 Vector3f* _positions,
+                 Vector3f* _normals,
+                 SIZE_T _count,
+                 uint32 _threads)
+  {
+    if (0 == _count) {
+      return;
+    }
+    Streams streams{};
+    streams.positions = &_in[0].position.x;
+    streams.normals = &_in[0].normal.x;
+    streams.indices = _in[0].boneIndices.data();
+    streams.weights = _in[0].boneWeights.data();
+    streams.stride = sizeof(SimpleAnimVertex);
+    Outputs outputs{ _positions, _normals, nullptr, nullptr };
+    run(BatchMath::getKernels().skinDualQuaternion, _palette, streams, outputs, _count,
+        _threads);
+  }
+
+  void
+  Skinning::skin(const SkinningDualQuaternion* _palette,
+                 const ComplexAnimVertex* _in,
+                 Vector3f* _positions,
+                 Vector3f* _normals,
+                 Vector3f* _tangents,
+                 Vector3f* _binormals,
+                 SIZE_T _count,
+                 uint32 _threads)
+  {
+    if (0 == _count) {
+      return;
+    }
+    Streams streams{};
+    streams.positions = &_in[0].position.x;
+    streams.normals = &_in[0].normal.x;
+    streams.tangents = &_in[0].tangent.x;
+    streams.binormals = &_in[0].binormal.x;
+    streams.indices = _in[0].boneIndices.data();
+    streams.weights = _in[0].boneWeights.data();
+    streams.stride = sizeof(ComplexAnimVertex);
+    Outputs outputs{ _positions, _normals, _tangents, _binormals };
+    run(BatchMath::getKernels().skinDualQuaternionTangents, _palette, streams, outputs,
+        _count, _threads);
+  }
+
+  Skinning::RangeKernel<SkinningMatrix>
+  Skinning::getLinearKernel(uint32 _size)
+  {
+    return BatchMath::getKernels().skinLinear[_size - 1];
+  }
+
+  template<class Palette>
+  void
+  Skinning::run(RangeKernel<Palette> _kernel,
+                const Palette* _palette,
+                const Streams& _streams,
+                const Outputs& _outputs,
+                SIZE_T _count,
+                uint32 _threads)
+  {
+    SIZE_T threads = 0 == _threads ? std::thread::hardware_concurrency() : _threads;
+    SIZE_T maxThreads = (_count + kMIN_VERTICES_PER_THREAD - 1) / kMIN_VERTICES_PER_THREAD;
+    threads = threads < maxThreads ? threads : maxThreads;
+    threads = threads < 1 ? 1 : threads;
+
+    if (1 == threads) {
+      _kernel(_palette, _streams, _outputs, 0, _count);
+      return;
+    }
+
+    /* The calling thread takes the first chunk. */
+    SIZE_T chunk = (_count + threads - 1) / threads;
+    Vector<std::thread> workers;
+    workers.reserve(threads - 1);
+    for (SIZE_T begin = chunk; begin < _count; begin += chunk) {
+      SIZE_T end = begin + chunk < _count ? begin + chunk : _count;
+      workers.emplace_back(_kernel, _palette, std::cref(_streams),
+                           std::cref(_outputs), begin, end);
+    }
+    _kernel(_palette, _streams, _outputs, 0, chunk);
+    for (std::thread& worker : workers) {
+      worker.join();
+    }
+  }
+
+  template void Skinning::run<SkinningMatrix>(RangeKernel<SkinningMatrix>, const SkinningMatrix*, const Streams&, const Outputs&, SIZE_T, uint32);
+}
@@ -0,0 +1,61 @@
+#include "nfSphere.h"
+
+#include "nfMath.h"
+
+namespace nfEngineSDK
+{
+  Sphere
+  Sphere::fromPoints(const Vector3f* _points, SIZE_T _stride, SIZE_T _count)
+  {
+    if (0 == _count) {
+      return Sphere(Vector3f(0.0f, 0.0f, 0.0f), 0.0f);
+    }
+    const uint8* bytes = reinterpret_cast<const uint8*>(_points);
+    auto point = [bytes, _stride](SIZE_T _i) -> const Vector3f& {
+      return *reinterpret_cast<const Vector3f*>(bytes + _i * _stride);
+    };
+
+    /* The points with the smallest and biggest x, y and z. */
+    SIZE_T minIndex[3] = { 0, 0, 0 };
+    SIZE_T maxIndex[3] = { 0, 0, 0 };
+    for (SIZE_T i = 1; i < _count; ++i) {
+      const Vector3f& p = point(i);
+      for (uint32 axis = 0; axis < 3; ++axis) {
+        if (p[axis] < point(minIndex[axis])[axis]) {
+          minIndex[axis] = i;
+        }
+        if (p[axis] > point(maxIndex[axis])[axis]) {
+          maxIndex[axis] = i;
+        }
+      }
+    }
+
+    /* The start is the sphere over the most separated pair. */
+    uint32 widest = 0;
+    float widestDistance = -1.0f;
+    for (uint32 axis = 0; axis < 3; ++axis) {
+      Vector3f d = point(maxIndex[axis]) - point(minIndex[axis]);
+      float distance = d.dot(d);
+      if (distance > widestDistance) {
+        widestDistance = distance;
+        widest = axis;
+      }
+    }
+    Vector3f center = (point(minIndex[widest]) + point(maxIndex[widest])) * 0.5f;
+    float radious = Math::sqrt(widestDistance) * 0.5f;
+
+    /* Grows the sphere just enough to take every point outside. */
+    for (SIZE_T i = 0; i < _count; ++i) {
+      const Vector3f& p = point(i);
+      Vector3f d = p - center;
+      float distance2 = d.dot(d);
+      if (distance2 > radious * radious) {
+        float distance = Math::sqrt(distance2);
+        float newRadious = (radious + distance) * 0.5f;
+        center = center + d * ((newRadious - radious) / distance);
+        radious = newRadious;
+      }
+    }
+    return Sphere(center, radious);
+  }
+}
@@ -0,0 +1,324 @@
+#include "nfStringConversion.h"
+
+#include <charconv>
+#include <cstring>
+
+#include "nfMatrix2.h"
+#include "nfMatrix3.h"
+#include "nfMatrix4.h"
+
+namespace nfEngineSDK
+{
+  namespace {
+    FORCEINLINE char*
+    writeText(char* _first, char* _last, const char* _text, SIZE_T _size)
+    {
+      if (nullptr == _first || static_cast<SIZE_T>(_last - _first) < _size) {
+        return nullptr;
+      }
+      std::memcpy(_first, _text, _size);
+      return _first + _size;
+    }
+
+    template<class T>
+    FORCEINLINE char*
+    writeNumber(char* _first, char* _last, T _value)
+    {
+      if (nullptr == _first) {
+        return nullptr;
+      }
+      std::to_chars_result result = std::to_chars(_first, _last, _value);
+      return std::errc() == result.ec ? result.ptr : nullptr;
+    }
+
+    FORCEINLINE const char*
+    skipSpaces(const char* _first, const char* _last)
+    {
+      while (_first != _last &&
+             (' ' == *_first || '\t' == *_first || '\n' == *_first || '\r' == *_first)) {
+        ++_first;
+      }
+      return _first;
+    }
+
+    /*
+     * Skips the spaces and then _char, null if it is not there.
+     */
+    FORCEINLINE const char*
+    expect(const char* _first, const char* _last, char _char)
+    {
+      if (nullptr == _first) {
+        return nullptr;
+      }
+      _first = skipSpaces(_first, _last);
+      return _first != _last && _char == *_first ? _first + 1 : nullptr;
+    }
+
+    template<class T>
+    FORCEINLINE const char*
+    readNumber(const char* _first, const char* _last, T& _value)
+    {
+      if (nullptr == _first) {
+        return nullptr;
+      }
+      _first = skipSpaces(_first, _last);
+      /* from_chars doesn't take the sign '+', to_chars never writes it. */
+      std::from_chars_result result = std::from_chars(_first, _last, _value);
+      return std::errc() == result.ec ? result.ptr : nullptr;
+    }
+
+    template<class T>
+    char*
+    writeList(char* _first, char* _last, const T* _values, uint32 _count)
+    {
+      _first = writeText(_first, _last, "{ ", 2);
+      for (uint32 i = 0; i < _count; ++i) {
+        if (i > 0) {
+          _first = writeText(_first, _last, ", ", 2);
+        }
+        _first = writeNumber(_first, _last, _values[i]);
+      }
+      return writeText(_first, _last, " }", 2);
+    }
+
+    template<class T>
+    const char*
+    readList(const char* _first, const char* _last, T* _values, uint32 _count)
+    {
+      _first = expect(_first, _last, '{');
+      for (uint32 i = 0; i < _count; ++i) {
+        if (i > 0) {
+          _first = expect(_first, _last, ',');
+        }
+        _first = readNumber(_first, _last, _values[i]);
+      }
+      return expect(_first, _last, '}');
+    }
+  }
+
+  char*
+  StringConversion::toChars(char* _first, char* _last, float _value)
+  {
+    return writeNumber(_first, _last, _value);
+  }
+
+  char*
+  StringConversion::toChars(char* _first, char* _last, int32 _value)
+  {
+    return writeNumber(_first, _last, _value);
+  }
+
+  char*
+  StringConversion::toChars(char* _first, char* _last, uint32 _value)
+  {
+    return writeNumber(_first, _last, _value);
+  }
+
+  char*
+  StringConversion::toChars(char* _first, char* _last, int64 _value)
+  {
+    return writeNumber(_first, _last, _value);
+  }
+
+  char*
+  StringConversion::toChars(char* _first, char* _last, uint64 _value)
+  {
+    return writeNumber(_first, _last, _value);
+  }
+
+  char*
+  StringConversion::toChars(char* _first, char* _last, const Matrix2f& _matrix)
+  {
+    return toCharsMatrix(_first, _last, _matrix.m, 2);
+  }
+
+  char*
+  StringConversion::toChars(char* _first, char* _last, const Matrix3f& _matrix)
+  {
+    return toCharsMatrix(_first, _last, _matrix.m, 3);
+  }
+
+  char*
+  StringConversion::toChars(char* _first, char* _last, const Matrix4f& _matrix)
+  {
+    return toCharsMatrix(_first, _last, _matrix.m, 4);
+  }
+
+  const char*
+  StringConversion::fromChars(const char* _first, const char* _last, float& _value)
+  {
+    return readNumber(_first, _last, _value);
+  }
+
+  const char*
+  StringConversion::fromChars(const char* _first, const char* _last, int32& _value)
+  {
+    return readNumber(_first, _last, _value);
+  }
+
+  const char*
+  StringConversion::fromChars(const char* _first, const char* _last, uint32& _value)
+  {
+    return readNumber(_first, _last, _value);
+  }
+
+  const char*
+  StringConversion::fromChars(const char* _first, const char* _last, Matrix2f& _matrix)
+  {
+    return fromCharsMatrix(_first, _last, _matrix.m, 2);
+  }
+
+  const char*
+  StringConversion::fromChars(const char* _first, const char* _last, Matrix3f& _matrix)
+  {
+    return fromCharsMatrix(_first, _last, _matrix.m, 3);
+  }
+
+  const char*
+  StringConversion::fromChars(const char* _first, const char* _last, Matrix4f& _matrix)
+  {
+    return fromCharsMatrix(_first, _last, _matrix.m, 4);
+  }
+
+  char*
+  StringConversion::toCharsList(char* _first, char* _last, const float* _values, uint32 _count)
+  {
+    return writeList(_first, _last, _values, _count);
+  }
+
+  char*
+  StringConversion::toCharsList(char* _first, char* _last, const int32* _values, uint32 _count)
+  {
+    return writeList(_first, _last, _values, _count);
+  }
+
+  char*
+  StringConversion::toCharsList(char* _first, char* _last, const uint32* _values, uint32 _count)
+  {
+    return writeList(_first, _last, _values, _count);
+  }
+
+  const char*
+  StringConversion::fromCharsList(const char* _first,
+                                  const char* _last,
+                                  float* _values,
+                                  uint32 _count)
+  {
+    return readList(_first, _last, _values, _count);
+  }
+
+  const char*
+  StringConversion::fromCharsList(const char* _first,
+                                  const char* _last,
+                                  int32* _values,
+                                  uint32 _count)
+  {
+    return readList(_first, _last, _values, _count);
+  }
+
+  const char*
+  StringConversion::fromCharsList(const char* _first,
+                                  const char* _last,
+                                  uint32* _values,
+                                  uint32 _count)
+  {
+    return readList(_first, _last, _values, _count);
+  }
+
+  char*
+  StringConversion::toCharsMatrix(char* _first,
+                                  char* _last,
+                                  const float* _values,
+                                  uint32 _size)
+  {
+    _first = writeText(_first, _last, "{ ", 2);
+    for (uint32 row = 0; row < _size; ++row) {
+      if (row > 0) {
+        _first = writeText(_first, _last, ", ", 2);
+      }
+      _first = writeList(_first, _last, _values + row * _size, _size);
+    }
+    return writeText(_first, _last, " }", 2);
+  }
+
+  const char*
+  StringConversion::fromCharsMatrix(const char* _first,
+                                    const char* _last,
+                                    float* _values,
+                                    uint32 _size)
+  {
+    /* Parsed aside, so _values is left as it was on an error. */
+    float values[16];
+    _first = expect(_first, _last, '{');
+    for (uint32 row = 0; row < _size; ++row) {
+      if (row > 0) {
+        _first = expect(_first, _last, ',');
+      }
+      _first = readList(_first, _last, values + row * _size, _size);
+    }
+    _first = expect(_first, _last, '}');
+    if (nullptr != _first) {
+      std::memcpy(_values, values, _size * _size * sizeof(float));
+    }
+    return _first;
+  }
+
+  TextWriter::TextWriter(const Sink& _sink, SIZE_T _bufferSize)
+    : m_sink(_sink),
+      m_buffer(_bufferSize)
+  {
+    m_position = m_buffer.data();
+    m_end = m_buffer.data() + m_buffer.size();
+  }
+
+  TextWriter::TextWriter(OFStream& _stream, SIZE_T _bufferSize)
+    : TextWriter([&_stream](const char* _text, SIZE_T _size) {
+                   _stream.write(_text, static_cast<std::streamsize>(_size));
+                 },
+                 _bufferSize) {}
+
+  TextWriter::~TextWriter()
+  {
+    flush();
+  }
+
+  TextWriter&
+  TextWriter::write(const char* _text, SIZE_T _size)
+  {
+    while (_size > 0) {
+      SIZE_T room = static_cast<SIZE_T>(m_end - m_position);
+      if (0 == room) {
+        flush();
+        continue;
+      }
+      SIZE_T chunk = _size < room ? _size : room;
+      std::memcpy(m_position, _text, chunk);
+      m_position += chunk;
+      _text += chunk;
+      _size -= chunk;
+    }
+    return *this;
+  }
+
+  TextWriter&
+  TextWriter::write(const char* _text)
+  {
+    return write(_text, std::strlen(_text));
+  }
+
+  TextWriter&
+  TextWriter::write(const String& _text)
+  {
+    return write(_text.data(), _text.size());
+  }
+
+  void
+  TextWriter::flush()
+  {
+    SIZE_T size = static_cast<SIZE_T>(m_position - m_buffer.data());
+    if (size > 0) {
+      m_sink(m_buffer.data(), size);
+      m_position = m_buffer.data();
+    }
+  }
+}
@@ -0,0 +1,146 @@
+#include "nfStringId.h"
+
+#include <cstring>
+#include <shared_mutex>
+
+namespace nfEngineSDK
+{
+  namespace {
+    /*
+     * The strings are copied to blocks of this size, the longer ones get a
+     * block of their own.
+     */
+    const SIZE_T kBLOCK_SIZE = 64 * 1024;
+
+    /*
+     * The text of an id, with its size to compare the strings with '\0'
+     * inside.
+     */
+    struct InternedString
+    {
+      const char* string;
+      SIZE_T size;
+    };
+
+    struct Registry
+    {
+      /*
+       * Shared to find the ids already interned, the usual case, and
+       * exclusive to add one.
+       */
+      std::shared_mutex mutex;
+      FlatHashMap<StringId, InternedString> strings;
+      /*
+       * The block being filled, the older ones are full.
+       */
+      char* block = nullptr;
+      SIZE_T blockUsed = kBLOCK_SIZE;
+    };
+
+    /*
+     * Never destroyed, the strings must live until the end of the program
+     * and can be asked while the statics are destroyed.
+     */
+    Registry&
+    getRegistry()
+    {
+      static Registry* registry = new Registry();
+      return *registry;
+    }
+
+    /*
+     * Copies the string with a '\0' to the blocks, with the lock held.
+     */
+    const char*
+    store(Registry& _registry, const char* _string, SIZE_T _size)
+    {
+      SIZE_T bytes = _size + 1;
+      char* copy;
+      if (bytes > kBLOCK_SIZE / 4) {
+        copy = new char[bytes];
+      }
+      else {
+        if (_registry.blockUsed + bytes > kBLOCK_SIZE) {
+          _registry.block = new char[kBLOCK_SIZE];
+          _registry.blockUsed = 0;
+        }
+        copy = _registry.block + _registry.blockUsed;
+        _registry.blockUsed += bytes;
+      }
+      std::memcpy(copy, _string, _size);
+      copy[_size] = '\0';
+      return copy;
+    }
+
+    /*
+     * Two different strings with the same id would be the same key.
+     */
+    FORCEINLINE void
+    checkCollision(const InternedString& _interned, const char* _string, SIZE_T _size)
+    {
+      NF_ASSERT(_interned.size == _size && 0 == std::memcmp(_interned.string, _string, _size));
+      (void)_interned;
+      (void)_string;
+      (void)_size;
+    }
+  }
+
+  StringId
+  StringInterner::intern(const char* _string, SIZE_T _size)
+  {
+    StringId id(_string, _size);
+    Registry& registry = getRegistry();
+    {
+      std::shared_lock<std::shared_mutex> lock(registry.mutex);
+      auto found = registry.strings.find(id);
+      if (registry.strings.end() != found) {
+        checkCollision(found->second, _string, _size);
+        return id;
+      }
+    }
+
+    std::unique_lock<std::shared_mutex> lock(registry.mutex);
+    auto inserted = registry.strings.try_emplace(id, InternedString{ nullptr, _size });
+    if (inserted.second) {
+      inserted.first->second.string = store(registry, _string, _size);
+    }
+    else {
+      checkCollision(inserted.first->second, _string, _size);
+    }
+    return id;
+  }
+
+  const char*
+  StringInterner::getString(StringId _id)
+  {
+    Registry& registry = getRegistry();
+    std::shared_lock<std::shared_mutex> lock(registry.mutex);
+    auto found = registry.strings.find(_id);
+    return registry.strings.end() != found ? found->second.string : nullptr;
+  }
+
+  String
+  StringInterner::toString(StringId _id)
+  {
+    const char* string = getString(_id);
+    if (nullptr != string) {
+      return string;
+    }
+
+    const char kDIGITS[] = "0123456789ABCDEF";
+    String hex = "0x0000000000000000";
+    uint64 value = _id.getId();
+    for (SIZE_T i = hex.size() - 1; value != 0; --i, value >>= 4) {
+      hex[i] = kDIGITS[value & 0xF];
+    }
+    return hex;
+  }
+
+  SIZE_T
+  StringInterner::getCount()
+  {
+    Registry& registry = getRegistry();
+    std::shared_lock<std::shared_mutex> lock(registry.mutex);
+    return registry.strings.size();
+  }
+}
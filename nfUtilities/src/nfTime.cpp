@@ -0,0 +1,161 @@
+#include "nfTime.h"
+
+#include "nfCPUFeatures.h"
+
+#if NF_ARCH_X86
+# define NF_TIME_TSC 1
+# if NF_COMPILER == NF_COMPILER_MSVC
+#   include <intrin.h>
+# else
+#   include <x86intrin.h>
+# endif
+#else
+# define NF_TIME_TSC 0
+#endif
+
+namespace nfEngineSDK
+{
+  namespace {
+    using SteadyClock = std::chrono::steady_clock;
+
+    /*
+     * How long the time stamp counter is measured against steady_clock.
+     */
+    const double kCALIBRATION_SECONDS = 0.01;
+
+    struct Clock
+    {
+      bool usingTSC;
+      double ticksPerSecond;
+      double secondsPerTick;
+    };
+
+    FORCEINLINE uint64
+    steadyNanoseconds()
+    {
+      return static_cast<uint64>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        SteadyClock::now().time_since_epoch()).count());
+    }
+
+    Clock
+    calibrate()
+    {
+      Clock clock{ false, 1e9, 1e-9 };
+#if NF_TIME_TSC
+      if (!CPUFeatures::hasInvariantTSC()) {
+        return clock;
+      }
+      /* Both clocks are read back to back at the start and at the end. */
+      SteadyClock::time_point steadyStart = SteadyClock::now();
+      uint64 tscStart = __rdtsc();
+      SteadyClock::time_point steadyEnd;
+      uint64 tscEnd;
+      do {
+        steadyEnd = SteadyClock::now();
+        tscEnd = __rdtsc();
+      } while (std::chrono::duration<double>(steadyEnd - steadyStart).count() <
+               kCALIBRATION_SECONDS);
+
+      double seconds = std::chrono::duration<double>(steadyEnd - steadyStart).count();
+      double ticks = static_cast<double>(tscEnd - tscStart);
+      if (tscEnd <= tscStart || seconds <= 0.0) {
+        return clock;
+      }
+      clock.usingTSC = true;
+      clock.ticksPerSecond = ticks / seconds;
+      clock.secondsPerTick = seconds / ticks;
+#endif
+      return clock;
+    }
+
+    /*
+     * Calibrated on the first use, the static is thread safe.
+     */
+    const Clock&
+    getClock()
+    {
+      static const Clock clock = calibrate();
+      return clock;
+    }
+  }
+
+  Time::Time()
+  {
+    reset();
+  }
+
+  void
+  Time::reset()
+  {
+    m_start = now();
+    m_last = m_start;
+    m_elapsed = 0.0;
+    m_accumulator = 0.0;
+    m_delta = 0.0f;
+    m_frameCount = 0;
+  }
+
+  void
+  Time::update()
+  {
+    uint64 current = now();
+    double delta = toSeconds(current - m_last);
+    m_last = current;
+    m_elapsed = toSeconds(current - m_start);
+    m_delta = static_cast<float>(delta < m_maxDelta ? delta : m_maxDelta);
+    m_accumulator += m_delta;
+    ++m_frameCount;
+  }
+
+  void
+  Time::setFixedStep(float _seconds)
+  {
+    assertm(_seconds > 0.0f, "The fixed step must be bigger than 0");
+    m_fixedStep = _seconds;
+  }
+
+  bool
+  Time::consumeFixedStep()
+  {
+    if (m_accumulator < m_fixedStep) {
+      return false;
+    }
+    m_accumulator -= m_fixedStep;
+    return true;
+  }
+
+  uint64
+  Time::now()
+  {
+#if NF_TIME_TSC
+    if (getClock().usingTSC) {
+      return __rdtsc();
+    }
+#endif
+    return steadyNanoseconds();
+  }
+
+  double
+  Time::toSeconds(uint64 _ticks)
+  {
+    return static_cast<double>(_ticks) * getClock().secondsPerTick;
+  }
+
+  uint64
+  Time::fromSeconds(double _seconds)
+  {
+    return static_cast<uint64>(_seconds * getClock().ticksPerSecond);
+  }
+
+  double
+  Time::getTicksPerSecond()
+  {
+    return getClock().ticksPerSecond;
+  }
+
+  bool
+  Time::isUsingTSC()
+  {
+    return getClock().usingTSC;
+  }
+}
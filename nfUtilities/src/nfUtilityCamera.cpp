@@ -0,0 +1,148 @@
+#include "nfUtilityCamera.h"
+
+#include "nfMath.h"
+
+namespace nfEngineSDK
+{
+  UtilityCamera::UtilityCamera()
+    : m_eye(0.0f, 0.0f, 0.0f),
+      m_target(0.0f, 0.0f, 1.0f),
+      m_up(0.0f, 1.0f, 0.0f),
+      m_fovY(Math::kPI / 3.0f),
+      m_aspectRatio(1.0f),
+      m_near(0.1f),
+      m_far(1000.0f),
+      m_reverseZ(false),
+      m_infiniteFar(false),
+      m_dirty(kVIEW_CHANGED | kPROJECTION_CHANGED) {}
+
+  const Matrix4f&
+  UtilityCamera::getView() const
+  {
+    if (m_dirty & kVIEW) {
+      m_view = Matrix4f::viewMatrix(m_eye, m_target, m_up);
+      m_dirty &= ~kVIEW;
+    }
+    return m_view;
+  }
+
+  const Matrix4f&
+  UtilityCamera::getProjection() const
+  {
+    if (m_dirty & kPROJECTION) {
+      m_projection = perspectiveMatrix(m_fovY, m_aspectRatio, m_near, m_far,
+                                       m_reverseZ, m_infiniteFar);
+      m_dirty &= ~kPROJECTION;
+    }
+    return m_projection;
+  }
+
+  const Matrix4f&
+  UtilityCamera::getViewProjection() const
+  {
+    if (m_dirty & kVIEW_PROJECTION) {
+      m_viewProjection = getView() * getProjection();
+      m_dirty &= ~kVIEW_PROJECTION;
+    }
+    return m_viewProjection;
+  }
+
+  /*
+   * The view is a rotation and a translation, its inverse is the transposed
+   * rotation and the eye.
+   */
+  const Matrix4f&
+  UtilityCamera::getInverseView() const
+  {
+    if (m_dirty & kINVERSE_VIEW) {
+      const Matrix4f& v = getView();
+      m_inverseView = Matrix4f(v.m_00, v.m_10, v.m_20, 0.0f,
+                               v.m_01, v.m_11, v.m_21, 0.0f,
+                               v.m_02, v.m_12, v.m_22, 0.0f,
+                               m_eye.x, m_eye.y, m_eye.z, 1.0f);
+      m_dirty &= ~kINVERSE_VIEW;
+    }
+    return m_inverseView;
+  }
+
+  /*
+   * The projection only has the diagonal scales and the depth terms, its
+   * inverse is written directly instead of the general one.
+   */
+  const Matrix4f&
+  UtilityCamera::getInverseProjection() const
+  {
+    if (m_dirty & kINVERSE_PROJECTION) {
+      const Matrix4f& p = getProjection();
+      float invDepth = 1.0f / p.m_32;
+      m_inverseProjection = Matrix4f(1.0f / p.m_00, 0.0f, 0.0f, 0.0f,
+                                     0.0f, 1.0f / p.m_11, 0.0f, 0.0f,
+                                     0.0f, 0.0f, 0.0f, invDepth,
+                                     0.0f, 0.0f, 1.0f, -p.m_22 * invDepth);
+      m_dirty &= ~kINVERSE_PROJECTION;
+    }
+    return m_inverseProjection;
+  }
+
+  const Matrix4f&
+  UtilityCamera::getInverseViewProjection() const
+  {
+    if (m_dirty & kINVERSE_VIEW_PROJECTION) {
+      m_inverseViewProjection = getInverseProjection() * getInverseView();
+      m_dirty &= ~kINVERSE_VIEW_PROJECTION;
+    }
+    return m_inverseViewProjection;
+  }
+
+  const Frustum&
+  UtilityCamera::getFrustum() const
+  {
+    if (m_dirty & kFRUSTUM) {
+      m_frustum = Frustum(getViewProjection(), m_reverseZ);
+      m_dirty &= ~kFRUSTUM;
+    }
+    return m_frustum;
+  }
+
+  void
+  UtilityCamera::update() const
+  {
+    getInverseViewProjection();
+    getFrustum();
+  }
+
+  /*
+   * The depth is z' / w with w = z and z' = z * c + d:
+   * - normal: c = f / (f - n), d = -n * f / (f - n)
+   * - reverse-Z: c = -n / (f - n), d = n * f / (f - n)
+   * - infinite: the limits of the above, c = 1, d = -n and c = 0, d = n.
+   */
+  Matrix4f
+  UtilityCamera::perspectiveMatrix(float _fovY,
+                                   float _aspectRatio,
+                                   float _near,
+                                   float _far,
+                                   bool _reverseZ,
+                                   bool _infiniteFar)
+  {
+    float height = Math::cos(_fovY * 0.5f) / Math::sin(_fovY * 0.5f);
+    float width = height / _aspectRatio;
+
+    float c;
+    float d;
+    if (_infiniteFar) {
+      c = _reverseZ ? 0.0f : 1.0f;
+      d = _reverseZ ? _near : -_near;
+    }
+    else {
+      float invRange = 1.0f / (_far - _near);
+      c = _reverseZ ? -_near * invRange : _far * invRange;
+      d = (_reverseZ ? _near : -_near) * _far * invRange;
+    }
+
+    return Matrix4f(width,   0.0f, 0.0f, 0.0f,
+                     0.0f, height, 0.0f, 0.0f,
+                     0.0f,   0.0f,    c, 1.0f,
+                     0.0f,   0.0f,    d, 0.0f);
+  }
+}
@@ -0,0 +1,326 @@
+#include "nfVectorBatch.h"
+
+#include "nfVector2.h"
+#include "nfVector3.h"
+
+#if NF_SIMD_AVX2
+# include <immintrin.h>
+#elif NF_SIMD_SSE4_1
+# include <smmintrin.h>
+#endif
+
+namespace nfEngineSDK
+{
+  static_assert(sizeof(Vector2i) == sizeof(int32) * 2, "Vector2i has padding");
+  static_assert(sizeof(Vector3i) == sizeof(int32) * 3, "Vector3i has padding");
+  static_assert(sizeof(Vector3u) == sizeof(int32) * 3, "Vector3u has padding");
+
+  namespace {
+#if NF_SIMD_AVX2
+    using IntReg = __m256i;
+    const SIZE_T kLANES = 8;
+
+    FORCEINLINE IntReg
+    loadReg(const int32* p)
+    {
+      return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+    }
+    FORCEINLINE void
+    storeReg(int32* p, IntReg v)
+    {
+      _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), v);
+    }
+    FORCEINLINE IntReg
+    addReg(IntReg a, IntReg b) { return _mm256_add_epi32(a, b); }
+    FORCEINLINE IntReg
+    subReg(IntReg a, IntReg b) { return _mm256_sub_epi32(a, b); }
+    FORCEINLINE IntReg
+    mulReg(IntReg a, IntReg b) { return _mm256_mullo_epi32(a, b); }
+    /*
+     * int32 fits exactly on a double, and so does the quotient of two of
+     * them, so the floor of the double division is exact.
+     */
+    FORCEINLINE IntReg
+    floorDivReg(IntReg a, IntReg b)
+    {
+      __m256d lo = _mm256_div_pd(_mm256_cvtepi32_pd(_mm256_castsi256_si128(a)),
+                                 _mm256_cvtepi32_pd(_mm256_castsi256_si128(b)));
+      __m256d hi = _mm256_div_pd(_mm256_cvtepi32_pd(_mm256_extracti128_si256(a, 1)),
+                                 _mm256_cvtepi32_pd(_mm256_extracti128_si256(b, 1)));
+      __m128i qlo = _mm256_cvttpd_epi32(_mm256_floor_pd(lo));
+      __m128i qhi = _mm256_cvttpd_epi32(_mm256_floor_pd(hi));
+      return _mm256_inserti128_si256(_mm256_castsi128_si256(qlo), qhi, 1);
+    }
+# define NF_BATCH_SIMD 1
+#elif NF_SIMD_SSE4_1
+    using IntReg = __m128i;
+    const SIZE_T kLANES = 4;
+
+    FORCEINLINE IntReg
+    loadReg(const int32* p)
+    {
+      return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+    }
+    FORCEINLINE void
+    storeReg(int32* p, IntReg v)
+    {
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(p), v);
+    }
+    FORCEINLINE IntReg
+    addReg(IntReg a, IntReg b) { return _mm_add_epi32(a, b); }
+    FORCEINLINE IntReg
+    subReg(IntReg a, IntReg b) { return _mm_sub_epi32(a, b); }
+    FORCEINLINE IntReg
+    mulReg(IntReg a, IntReg b) { return _mm_mullo_epi32(a, b); }
+    /*
+     * int32 fits exactly on a double, and so does the quotient of two of
+     * them, so the floor of the double division is exact.
+     */
+    FORCEINLINE IntReg
+    floorDivReg(IntReg a, IntReg b)
+    {
+      IntReg aHi = _mm_shuffle_epi32(a, _MM_SHUFFLE(1, 0, 3, 2));
+      IntReg bHi = _mm_shuffle_epi32(b, _MM_SHUFFLE(1, 0, 3, 2));
+      __m128d lo = _mm_div_pd(_mm_cvtepi32_pd(a), _mm_cvtepi32_pd(b));
+      __m128d hi = _mm_div_pd(_mm_cvtepi32_pd(aHi), _mm_cvtepi32_pd(bHi));
+      return _mm_unpacklo_epi64(_mm_cvttpd_epi32(_mm_floor_pd(lo)),
+                                _mm_cvttpd_epi32(_mm_floor_pd(hi)));
+    }
+# define NF_BATCH_SIMD 1
+#else
+# define NF_BATCH_SIMD 0
+#endif
+
+    FORCEINLINE int32
+    floorDivScalar(int32 a, int32 b)
+    {
+      int32 q = a / b;
+      return q - static_cast<int32>((a % b != 0) && ((a ^ b) < 0));
+    }
+
+    struct AddOp
+    {
+#if NF_BATCH_SIMD
+      static FORCEINLINE IntReg
+      simd(IntReg a, IntReg b) { return addReg(a, b); }
+#endif
+      static FORCEINLINE int32
+      scalar(int32 a, int32 b)
+      {
+        return static_cast<int32>(static_cast<uint32>(a) + static_cast<uint32>(b));
+      }
+    };
+    struct SubOp
+    {
+#if NF_BATCH_SIMD
+      static FORCEINLINE IntReg
+      simd(IntReg a, IntReg b) { return subReg(a, b); }
+#endif
+      static FORCEINLINE int32
+      scalar(int32 a, int32 b)
+      {
+        return static_cast<int32>(static_cast<uint32>(a) - static_cast<uint32>(b));
+      }
+    };
+    struct MulOp
+    {
+#if NF_BATCH_SIMD
+      static FORCEINLINE IntReg
+      simd(IntReg a, IntReg b) { return mulReg(a, b); }
+#endif
+      static FORCEINLINE int32
+      scalar(int32 a, int32 b)
+      {
+        return static_cast<int32>(static_cast<uint32>(a) * static_cast<uint32>(b));
+      }
+    };
+    struct FloorDivOp
+    {
+#if NF_BATCH_SIMD
+      static FORCEINLINE IntReg
+      simd(IntReg a, IntReg b) { return floorDivReg(a, b); }
+#endif
+      static FORCEINLINE int32
+      scalar(int32 a, int32 b) { return floorDivScalar(a, b); }
+    };
+    struct FloorModOp
+    {
+#if NF_BATCH_SIMD
+      static FORCEINLINE IntReg
+      simd(IntReg a, IntReg b) { return subReg(a, mulReg(floorDivReg(a, b), b)); }
+#endif
+      static FORCEINLINE int32
+      scalar(int32 a, int32 b) { return a - floorDivScalar(a, b) * b; }
+    };
+
+    /*
+     * Applies Op between two flat arrays of n integers.
+     */
+    template<class Op>
+    void
+    binaryKernel(const int32* a, const int32* b, int32* r, SIZE_T n)
+    {
+      SIZE_T i = 0;
+#if NF_BATCH_SIMD
+      for (; i + kLANES <= n; i += kLANES) {
+        storeReg(r + i, Op::simd(loadReg(a + i), loadReg(b + i)));
+      }
+#endif
+      for (; i < n; ++i) {
+        r[i] = Op::scalar(a[i], b[i]);
+      }
+    }
+
+    /*
+     * Applies Op between a flat array of n integers and the P components of a
+     * vector, repeated. P registers hold the components rotated so every one
+     * lines up with its lanes.
+     */
+    template<class Op, uint32 P>
+    void
+    patternKernel(const int32* a, const int32* comp, int32* r, SIZE_T n)
+    {
+      SIZE_T i = 0;
+#if NF_BATCH_SIMD
+      int32 lanes[kLANES * P];
+      for (SIZE_T j = 0; j < kLANES * P; ++j) {
+        lanes[j] = comp[j % P];
+      }
+      IntReg pattern[P];
+      for (uint32 k = 0; k < P; ++k) {
+        pattern[k] = loadReg(lanes + k * kLANES);
+      }
+      for (; i + kLANES * P <= n; i += kLANES * P) {
+        for (uint32 k = 0; k < P; ++k) {
+          storeReg(r + i + k * kLANES,
+                   Op::simd(loadReg(a + i + k * kLANES), pattern[k]));
+        }
+      }
+#endif
+      for (; i < n; ++i) {
+        r[i] = Op::scalar(a[i], comp[i % P]);
+      }
+    }
+
+    template<class V>
+    FORCEINLINE const int32*
+    flat(const V* v)
+    {
+      return reinterpret_cast<const int32*>(v);
+    }
+    template<class V>
+    FORCEINLINE int32*
+    flat(V* v)
+    {
+      return reinterpret_cast<int32*>(v);
+    }
+  }
+
+  //////////////////////
+  //     Vector3i     //
+  //////////////////////
+
+  void
+  VectorBatch::add(const Vector3i* a, const Vector3i* b, Vector3i* out, SIZE_T count)
+  {
+    binaryKernel<AddOp>(flat(a), flat(b), flat(out), count * 3);
+  }
+  void
+  VectorBatch::sub(const Vector3i* a, const Vector3i* b, Vector3i* out, SIZE_T count)
+  {
+    binaryKernel<SubOp>(flat(a), flat(b), flat(out), count * 3);
+  }
+  void
+  VectorBatch::mul(const Vector3i* a, const Vector3i* b, Vector3i* out, SIZE_T count)
+  {
+    binaryKernel<MulOp>(flat(a), flat(b), flat(out), count * 3);
+  }
+  void
+  VectorBatch::add(const Vector3i* a, const Vector3i& offset, Vector3i* out, SIZE_T count)
+  {
+    patternKernel<AddOp, 3>(flat(a), offset.xyz, flat(out), count * 3);
+  }
+  void
+  VectorBatch::floorDivide(const Vector3i* a,
+                           const Vector3i& cellSize,
+                           Vector3i* out,
+                           SIZE_T count)
+  {
+    patternKernel<FloorDivOp, 3>(flat(a), cellSize.xyz, flat(out), count * 3);
+  }
+  void
+  VectorBatch::floorModulo(const Vector3i* a,
+                           const Vector3i& cellSize,
+                           Vector3i* out,
+                           SIZE_T count)
+  {
+    patternKernel<FloorModOp, 3>(flat(a), cellSize.xyz, flat(out), count * 3);
+  }
+
+  //////////////////////
+  //     Vector2i     //
+  //////////////////////
+
+  void
+  VectorBatch::add(const Vector2i* a, const Vector2i* b, Vector2i* out, SIZE_T count)
+  {
+    binaryKernel<AddOp>(flat(a), flat(b), flat(out), count * 2);
+  }
+  void
+  VectorBatch::sub(const Vector2i* a, const Vector2i* b, Vector2i* out, SIZE_T count)
+  {
+    binaryKernel<SubOp>(flat(a), flat(b), flat(out), count * 2);
+  }
+  void
+  VectorBatch::mul(const Vector2i* a, const Vector2i* b, Vector2i* out, SIZE_T count)
+  {
+    binaryKernel<MulOp>(flat(a), flat(b), flat(out), count * 2);
+  }
+  void
+  VectorBatch::add(const Vector2i* a, const Vector2i& offset, Vector2i* out, SIZE_T count)
+  {
+    patternKernel<AddOp, 2>(flat(a), offset.xy, flat(out), count * 2);
+  }
+  void
+  VectorBatch::floorDivide(const Vector2i* a,
+                           const Vector2i& cellSize,
+                           Vector2i* out,
+                           SIZE_T count)
+  {
+    patternKernel<FloorDivOp, 2>(flat(a), cellSize.xy, flat(out), count * 2);
+  }
+  void
+  VectorBatch::floorModulo(const Vector2i* a,
+                           const Vector2i& cellSize,
+                           Vector2i* out,
+                           SIZE_T count)
+  {
+    patternKernel<FloorModOp, 2>(flat(a), cellSize.xy, flat(out), count * 2);
+  }
+
+  //////////////////////
+  //     Vector3u     //
+  //////////////////////
+
+  void
+  VectorBatch::add(const Vector3u* a, const Vector3u* b, Vector3u* out, SIZE_T count)
+  {
+    binaryKernel<AddOp>(flat(a), flat(b), flat(out), count * 3);
+  }
+  void
+  VectorBatch::sub(const Vector3u* a, const Vector3u* b, Vector3u* out, SIZE_T count)
+  {
+    binaryKernel<SubOp>(flat(a), flat(b), flat(out), count * 3);
+  }
+  void
+  VectorBatch::mul(const Vector3u* a, const Vector3u* b, Vector3u* out, SIZE_T count)
+  {
+    binaryKernel<MulOp>(flat(a), flat(b), flat(out), count * 3);
+  }
+  void
+  VectorBatch::add(const Vector3u* a, const Vector3u& offset, Vector3u* out, SIZE_T count)
+  {
+    const int32* comp = reinterpret_cast<const int32*>(offset.xyz);
+    patternKernel<AddOp, 3>(flat(a), comp, flat(out), count * 3);
+  }
+}
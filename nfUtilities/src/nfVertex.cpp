@@ -0,0 +1,151 @@
+#include "nfVertex.h"
+
+namespace nfEngineSDK
+{
+  namespace {
+    /*
+     * The part every quantized vertex shares: position, texture coordinates
+     * and normal.
+     */
+    template<class V, class Q>
+    FORCEINLINE void
+    encodeBase(const V& _v, Q& _q)
+    {
+      _q.position = _v.position;
+      _q.texCoords[0] = VertexQuantization::encodeHalf(_v.texCoords.x);
+      _q.texCoords[1] = VertexQuantization::encodeHalf(_v.texCoords.y);
+      _q.normal = VertexQuantization::encodeOctahedral(_v.normal);
+    }
+    template<class Q, class V>
+    FORCEINLINE void
+    decodeBase(const Q& _q, V& _v)
+    {
+      _v.position = _q.position;
+      _v.texCoords = Vector2f(VertexQuantization::decodeHalf(_q.texCoords[0]),
+                              VertexQuantization::decodeHalf(_q.texCoords[1]));
+      _v.normal = VertexQuantization::decodeOctahedral(_q.normal);
+    }
+
+    template<class V, class Q>
+    FORCEINLINE void
+    encodeTangentSpace(const V& _v, Q& _q)
+    {
+      _q.tangent = VertexQuantization::encodeOctahedral(_v.tangent);
+      _q.binormal = VertexQuantization::encodeOctahedral(_v.binormal);
+    }
+    template<class Q, class V>
+    FORCEINLINE void
+    decodeTangentSpace(const Q& _q, V& _v)
+    {
+      _v.tangent = VertexQuantization::decodeOctahedral(_q.tangent);
+      _v.binormal = VertexQuantization::decodeOctahedral(_q.binormal);
+    }
+
+    template<class V, class Q>
+    FORCEINLINE void
+    encodeBones(const V& _v, Q& _q)
+    {
+      VertexQuantization::encodeWeights<4>(_v.boneWeights.data(), _q.boneWeights);
+      VertexQuantization::encodeIndices<4>(_v.boneIndices.data(), _q.boneIndices);
+    }
+    template<class Q, class V>
+    FORCEINLINE void
+    decodeBones(const Q& _q, V& _v)
+    {
+      _v.boneIndices = Vector4i(_q.boneIndices[0], _q.boneIndices[1],
+                                _q.boneIndices[2], _q.boneIndices[3]);
+      _v.boneWeights = Vector4f(VertexQuantization::decodeUnorm16(_q.boneWeights[0]),
+                                VertexQuantization::decodeUnorm16(_q.boneWeights[1]),
+                                VertexQuantization::decodeUnorm16(_q.boneWeights[2]),
+                                VertexQuantization::decodeUnorm16(_q.boneWeights[3]));
+    }
+  }
+
+  void
+  VertexQuantization::encode(const SimplexVertex* _in,
+                             QuantizedSimplexVertex* _out,
+                             SIZE_T _count)
+  {
+    for (SIZE_T i = 0; i < _count; ++i) {
+      encodeBase(_in[i], _out[i]);
+    }
+  }
+
+  void
+  VertexQuantization::decode(const QuantizedSimplexVertex* _in,
+                             SimplexVertex* _out,
+                             SIZE_T _count)
+  {
+    for (SIZE_T i = 0; i < _count; ++i) {
+      decodeBase(_in[i], _out[i]);
+    }
+  }
+
+  void
+  VertexQuantization::encode(const ComplexVertex* _in,
+                             QuantizedComplexVertex* _out,
+                             SIZE_T _count)
+  {
+    for (SIZE_T i = 0; i < _count; ++i) {
+      encodeBase(_in[i], _out[i]);
+      encodeTangentSpace(_in[i], _out[i]);
+    }
+  }
+
+  void
+  VertexQuantization::decode(const QuantizedComplexVertex* _in,
+                             ComplexVertex* _out,
+                             SIZE_T _count)
+  {
+    for (SIZE_T i = 0; i < _count; ++i) {
+      decodeBase(_in[i], _out[i]);
+      decodeTangentSpace(_in[i], _out[i]);
+    }
+  }
+
+  void
+  VertexQuantization::encode(const SimpleAnimVertex* _in,
+                             QuantizedSimpleAnimVertex* _out,
+                             SIZE_T _count)
+  {
+    for (SIZE_T i = 0; i < _count; ++i) {
+      encodeBase(_in[i], _out[i]);
+      encodeBones(_in[i], _out[i]);
+    }
+  }
+
+  void
+  VertexQuantization::decode(const QuantizedSimpleAnimVertex* _in,
+                             SimpleAnimVertex* _out,
+                             SIZE_T _count)
+  {
+    for (SIZE_T i = 0; i < _count; ++i) {
+      decodeBase(_in[i], _out[i]);
+      decodeBones(_in[i], _out[i]);
+    }
+  }
+
+  void
+  VertexQuantization::encode(const ComplexAnimVertex* _in,
+                             QuantizedComplexAnimVertex* _out,
+                             SIZE_T _count)
+  {
+    for (SIZE_T i = 0; i < _count; ++i) {
+      encodeBase(_in[i], _out[i]);
+      encodeTangentSpace(_in[i], _out[i]);
+      encodeBones(_in[i], _out[i]);
+    }
+  }
+
+  void
+  VertexQuantization::decode(const QuantizedComplexAnimVertex* _in,
+                             ComplexAnimVertex* _out,
+                             SIZE_T _count)
+  {
+    for (SIZE_T i = 0; i < _count; ++i) {
+      decodeBase(_in[i], _out[i]);
+      decodeTangentSpace(_in[i], _out[i]);
+      decodeBones(_in[i], _out[i]);
+    }
+  }
+}